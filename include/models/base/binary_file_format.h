@@ -0,0 +1,172 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_BASE_BINARY_FILE_FORMAT_H_
+#define MODELS_BASE_BINARY_FILE_FORMAT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// \par OVERVIEW
+///
+/// This namespace contains the shared layout of the memory-mappable binary
+/// files (cable library, transmission line snapshot, stretch state cache).
+///
+/// \par LAYOUT
+///
+/// Each file starts with a common header record, which is followed by any
+/// file-specific header values and then the data. Sectioned files store a
+/// section record for each section in their header. Every section starts on
+/// an 8 byte boundary, so the records can be read in place from the mapped
+/// file.
+///
+/// The files are written in native byte order and layout. A byte order marker
+/// is stored in the header so that a file from a platform with a different
+/// byte order is rejected instead of being misread.
+namespace binary_file {
+
+/// \var kMarkerByteOrder
+///   A value used to detect a file with a different byte order.
+const std::uint32_t kMarkerByteOrder = 0x01020304;
+
+/// \par OVERVIEW
+///
+/// This struct is the common file header.
+struct HeaderRecord {
+  char magic[8];
+  std::uint32_t marker_byte_order;
+  std::uint32_t version;
+  std::uint64_t size_file;
+};
+
+/// \par OVERVIEW
+///
+/// This struct locates a section in the file.
+struct SectionRecord {
+  std::uint64_t offset;
+  std::uint64_t count;
+};
+
+/// \par OVERVIEW
+///
+/// This class hashes values using 64-bit FNV-1a.
+class Hasher {
+ public:
+  /// \brief Default constructor.
+  Hasher();
+
+  /// \brief Adds bytes to the hash.
+  /// \param[in] data
+  ///   The bytes.
+  /// \param[in] size
+  ///   The number of bytes.
+  void AddBytes(const void* data, const std::size_t& size);
+
+  /// \brief Adds a double to the hash.
+  /// \param[in] value
+  ///   The value. Negative zero is hashed as zero.
+  void AddDouble(const double& value);
+
+  /// \brief Adds an integer to the hash.
+  /// \param[in] value
+  ///   The value.
+  void AddInt(const std::int64_t& value);
+
+  /// \brief Gets the hash.
+  /// \return The hash.
+  std::uint64_t hash() const;
+
+ private:
+  /// \var hash_
+  ///   The hash.
+  std::uint64_t hash_;
+};
+
+/// \brief Appends a section to a file buffer.
+/// \param[in] records
+///   The section records.
+/// \param[out] section
+///   The section location.
+/// \param[in,out] buffer
+///   The file buffer. The buffer is padded so the section is aligned.
+template <class T>
+void AppendSection(const std::vector<T>& records, SectionRecord* section,
+                   std::vector<char>* buffer) {
+  // pads the buffer so every section is aligned
+  while (buffer->size() % 8 != 0) {
+    buffer->push_back(0);
+  }
+
+  section->offset = buffer->size();
+  section->count = records.size();
+
+  const char* data = reinterpret_cast<const char*>(records.data());
+  buffer->insert(buffer->end(), data, data + records.size() * sizeof(T));
+}
+
+/// \brief Gets a common file header.
+/// \param[in] magic
+///   The 8 characters that identify the file type.
+/// \param[in] version
+///   The file format version.
+/// \return The header. The file size is zero, and must be set once the file
+///   buffer is complete.
+HeaderRecord Header(const char* magic, const int& version);
+
+/// \brief Determines if the file data has a valid common header.
+/// \param[in] data
+///   The file data, which must be aligned to 8 bytes.
+/// \param[in] size
+///   The file size, in bytes.
+/// \param[in] magic
+///   The 8 characters that identify the file type.
+/// \param[in] version
+///   The file format version.
+/// \return If the magic, byte order, version, and file size match.
+bool IsValidHeader(const char* data, const std::size_t& size,
+                   const char* magic, const int& version);
+
+/// \brief Determines if a range of records fits within a section.
+/// \param[in] begin
+///   The first record index.
+/// \param[in] count
+///   The number of records.
+/// \param[in] size
+///   The number of records in the section.
+/// \return If the range fits within the section.
+bool IsValidRange(const std::uint64_t& begin, const std::uint64_t& count,
+                  const std::uint64_t& size);
+
+/// \brief Determines if the sections are aligned and fit within the file.
+/// \param[in] sections
+///   The section records.
+/// \param[in] sizes_record
+///   The record size of each section, in bytes.
+/// \param[in] size_sections
+///   The number of sections.
+/// \param[in] size_header
+///   The full header size, in bytes. Sections cannot overlap the header.
+/// \param[in] size
+///   The file size, in bytes.
+/// \return If every section is valid.
+bool IsValidSections(const SectionRecord* sections,
+                     const std::size_t* sizes_record,
+                     const int& size_sections,
+                     const std::size_t& size_header,
+                     const std::size_t& size);
+
+/// \brief Gets the records of a section.
+/// \param[in] data
+///   The file data.
+/// \param[in] section
+///   The section, which must be validated.
+/// \return The first record.
+template <class T>
+const T* Records(const char* data, const SectionRecord& section) {
+  return reinterpret_cast<const T*>(data + section.offset);
+}
+
+}  // namespace binary_file
+
+#endif  // MODELS_BASE_BINARY_FILE_FORMAT_H_
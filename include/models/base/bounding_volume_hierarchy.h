@@ -0,0 +1,149 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_BASE_BOUNDING_VOLUME_HIERARCHY_H_
+#define MODELS_BASE_BOUNDING_VOLUME_HIERARCHY_H_
+
+#include <functional>
+#include <vector>
+
+#include "models/base/point.h"
+
+/// \par OVERVIEW
+///
+/// This struct is an axis-aligned 3D bounding box.
+struct BoundingBox3d {
+ public:
+  /// \brief Default constructor.
+  /// The box is initialized as empty, so that adding the first point makes the
+  /// box equal to that point.
+  BoundingBox3d();
+
+  /// \brief Gets the minimum distance to another box.
+  /// \param[in] other
+  ///   The other box.
+  /// \return The minimum distance. If the boxes overlap, zero is returned.
+  double Distance(const BoundingBox3d& other) const;
+
+  /// \brief Expands the box to include a point.
+  /// \param[in] point
+  ///   The point.
+  void Expand(const Point3d<double>& point);
+
+  /// \brief Expands the box to include another box.
+  /// \param[in] other
+  ///   The other box.
+  void Expand(const BoundingBox3d& other);
+
+  /// \var point_max
+  ///   The maximum corner point.
+  Point3d<double> point_max;
+
+  /// \var point_min
+  ///   The minimum corner point.
+  Point3d<double> point_min;
+};
+
+/// \par OVERVIEW
+///
+/// This class is a bounding volume hierarchy, which is a binary tree of
+/// bounding boxes. Each leaf contains the box of a single item, and each
+/// branch contains the combined box of its children.
+///
+/// \par BUILD
+///
+/// The tree is built top-down. The items in each branch are split at the
+/// median box center along the axis with the largest spread of centers.
+///
+/// \par DISTANCE QUERIES
+///
+/// The minimum distance between the items of two hierarchies is found by
+/// traversing both trees together. A pair of nodes is skipped when the box
+/// distance is not less than the best item distance found so far, so the item
+/// distance function is only called for nearby item pairs. The item distance
+/// must not be less than the distance between the item boxes.
+class BoundingVolumeHierarchy {
+ public:
+  /// \brief Default constructor.
+  BoundingVolumeHierarchy();
+
+  /// \brief Destructor.
+  ~BoundingVolumeHierarchy();
+
+  /// \brief Builds the hierarchy.
+  /// \param[in] boxes
+  ///   The bounding box for each item. The item indexes match the vector
+  ///   indexes.
+  void Build(const std::vector<BoundingBox3d>& boxes);
+
+  /// \brief Clears the hierarchy.
+  void Clear();
+
+  /// \brief Gets the minimum distance between items of two hierarchies.
+  /// \param[in] a
+  ///   The first hierarchy.
+  /// \param[in] b
+  ///   The second hierarchy.
+  /// \param[in] distance_items
+  ///   A function that returns the distance between an item in the first
+  ///   hierarchy and an item in the second hierarchy.
+  /// \return The minimum item distance. If either hierarchy is empty, -999999
+  ///   is returned.
+  static double DistanceMinimum(
+      const BoundingVolumeHierarchy& a,
+      const BoundingVolumeHierarchy& b,
+      const std::function<double(const int&, const int&)>& distance_items);
+
+  /// \brief Gets the number of items.
+  /// \return The number of items.
+  int size() const;
+
+ private:
+  /// \par OVERVIEW
+  ///
+  /// This struct is a node in the tree. Leaf nodes have an item index, and
+  /// branch nodes have child node indexes.
+  struct Node {
+    /// \var box
+    ///   The bounding box of the node.
+    BoundingBox3d box;
+
+    /// \var index_child_left
+    ///   The left child node index, or -1 for a leaf.
+    int index_child_left;
+
+    /// \var index_child_right
+    ///   The right child node index, or -1 for a leaf.
+    int index_child_right;
+
+    /// \var index_item
+    ///   The item index, or -1 for a branch.
+    int index_item;
+  };
+
+  /// \brief Builds a node and its children.
+  /// \param[in] boxes
+  ///   The item bounding boxes.
+  /// \param[in] index_begin
+  ///   The first position in the item index vector.
+  /// \param[in] index_end
+  ///   The position after the last item in the item index vector.
+  /// \return The node index.
+  int BuildNode(const std::vector<BoundingBox3d>& boxes,
+                const int& index_begin,
+                const int& index_end);
+
+  /// \var indexes_item_
+  ///   The item indexes, which are reordered while building.
+  std::vector<int> indexes_item_;
+
+  /// \var nodes_
+  ///   The nodes. The root is the first node.
+  std::vector<Node> nodes_;
+
+  /// \var size_items_
+  ///   The number of items.
+  int size_items_;
+};
+
+#endif  // MODELS_BASE_BOUNDING_VOLUME_HIERARCHY_H_
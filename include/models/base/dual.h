@@ -0,0 +1,181 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_BASE_DUAL_H_
+#define MODELS_BASE_DUAL_H_
+
+#include <cmath>
+
+/// \par OVERVIEW
+///
+/// This is a forward-mode dual number, which carries a value and its
+/// derivative with respect to a single seeded input.
+///
+/// \par SEEDING
+///
+/// The input that derivatives are taken with respect to is constructed with a
+/// derivative of 1. All other inputs are constructed with a derivative of 0.
+/// After evaluating a function, the derivative member holds the derivative of
+/// the function with respect to the seeded input.
+///
+/// \par MATH FUNCTIONS
+///
+/// The math functions are found by argument-dependent lookup, so templated
+/// code should call them unqualified after a using-declaration for the std
+/// function (ex: using std::sinh; sinh(x);).
+template <class T>
+struct Dual {
+ public:
+  /// \brief Default constructor.
+  Dual() {
+    value = -999999;
+    derivative = 0;
+  }
+
+  /// \brief Alternate constructor.
+  /// \param[in] value_input
+  ///   The value.
+  /// \param[in] derivative_input
+  ///   The derivative.
+  Dual(const T& value_input, const T& derivative_input = 0) {
+    value = value_input;
+    derivative = derivative_input;
+  }
+
+  Dual& operator+=(const Dual& other) {
+    value += other.value;
+    derivative += other.derivative;
+    return *this;
+  }
+
+  Dual& operator-=(const Dual& other) {
+    value -= other.value;
+    derivative -= other.derivative;
+    return *this;
+  }
+
+  Dual& operator*=(const Dual& other) {
+    derivative = derivative * other.value + value * other.derivative;
+    value *= other.value;
+    return *this;
+  }
+
+  Dual& operator/=(const Dual& other) {
+    derivative = (derivative * other.value - value * other.derivative)
+                 / (other.value * other.value);
+    value /= other.value;
+    return *this;
+  }
+
+  // the operators are defined as friends so that plain scalars (including
+  // integer literals) are implicitly converted to constant dual numbers
+  friend Dual operator-(const Dual& a) {
+    return Dual(-a.value, -a.derivative);
+  }
+
+  friend Dual operator+(Dual a, const Dual& b) {
+    return a += b;
+  }
+
+  friend Dual operator-(Dual a, const Dual& b) {
+    return a -= b;
+  }
+
+  friend Dual operator*(Dual a, const Dual& b) {
+    return a *= b;
+  }
+
+  friend Dual operator/(Dual a, const Dual& b) {
+    return a /= b;
+  }
+
+  // comparisons only use the value, so branches follow the same path as the
+  // scalar evaluation
+  friend bool operator<(const Dual& a, const Dual& b) {
+    return a.value < b.value;
+  }
+
+  friend bool operator>(const Dual& a, const Dual& b) {
+    return a.value > b.value;
+  }
+
+  friend bool operator<=(const Dual& a, const Dual& b) {
+    return a.value <= b.value;
+  }
+
+  friend bool operator>=(const Dual& a, const Dual& b) {
+    return a.value >= b.value;
+  }
+
+  friend bool operator==(const Dual& a, const Dual& b) {
+    return a.value == b.value;
+  }
+
+  friend bool operator!=(const Dual& a, const Dual& b) {
+    return a.value != b.value;
+  }
+
+  friend Dual abs(const Dual& a) {
+    return (a.value < 0) ? -a : a;
+  }
+
+  friend Dual asinh(const Dual& a) {
+    return Dual(std::asinh(a.value),
+                a.derivative / std::sqrt(a.value * a.value + 1));
+  }
+
+  friend Dual atan(const Dual& a) {
+    return Dual(std::atan(a.value),
+                a.derivative / (a.value * a.value + 1));
+  }
+
+  friend Dual cos(const Dual& a) {
+    return Dual(std::cos(a.value), -a.derivative * std::sin(a.value));
+  }
+
+  friend Dual cosh(const Dual& a) {
+    return Dual(std::cosh(a.value), a.derivative * std::sinh(a.value));
+  }
+
+  friend Dual exp(const Dual& a) {
+    const T value_exp = std::exp(a.value);
+    return Dual(value_exp, a.derivative * value_exp);
+  }
+
+  friend Dual log(const Dual& a) {
+    return Dual(std::log(a.value), a.derivative / a.value);
+  }
+
+  friend Dual pow(const Dual& a, const T& exponent) {
+    return Dual(std::pow(a.value, exponent),
+                a.derivative * exponent * std::pow(a.value, exponent - 1));
+  }
+
+  friend Dual sin(const Dual& a) {
+    return Dual(std::sin(a.value), a.derivative * std::cos(a.value));
+  }
+
+  friend Dual sinh(const Dual& a) {
+    return Dual(std::sinh(a.value), a.derivative * std::cosh(a.value));
+  }
+
+  friend Dual sqrt(const Dual& a) {
+    const T value_sqrt = std::sqrt(a.value);
+    return Dual(value_sqrt, a.derivative / (2 * value_sqrt));
+  }
+
+  friend Dual tan(const Dual& a) {
+    const T value_cos = std::cos(a.value);
+    return Dual(std::tan(a.value), a.derivative / (value_cos * value_cos));
+  }
+
+  /// \var derivative
+  ///   The derivative with respect to the seeded input.
+  T derivative;
+
+  /// \var value
+  ///   The value.
+  T value;
+};
+
+#endif  // MODELS_BASE_DUAL_H_
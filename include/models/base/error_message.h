@@ -9,6 +9,12 @@
 /// \par OVERVIEW
 ///
 /// This struct contains information for an error message.
+///
+/// \par ALLOCATION
+///
+/// Classes only assign the title and build the description when a message
+/// list is provided, so validating without a message list does not allocate
+/// unless the class itself needs to update.
 struct ErrorMessage {
  public:
   /// \var description
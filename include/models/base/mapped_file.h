@@ -0,0 +1,70 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_BASE_MAPPED_FILE_H_
+#define MODELS_BASE_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// \par OVERVIEW
+///
+/// This class provides read-only access to the contents of a file.
+///
+/// \par MAPPING
+///
+/// Where POSIX memory mapping is available, the file is mapped read-only, so
+/// the pages are loaded on demand and are shared through the page cache with
+/// every other process that maps the same file. Otherwise, the file is read
+/// into a single buffer.
+///
+/// The data is always aligned to at least 8 bytes.
+class MappedFile {
+ public:
+  /// \brief Default constructor.
+  MappedFile();
+
+  /// \brief Destructor.
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /// \brief Closes the file.
+  void Close();
+
+  /// \brief Opens a file.
+  /// \param[in] filepath
+  ///   The file path.
+  /// \return If the file opened successfully. An empty file is not opened.
+  bool Open(const std::string& filepath);
+
+  /// \brief Gets the file data.
+  /// \return The file data. If no file is open, a nullptr is returned.
+  const char* data() const;
+
+  /// \brief Gets the file size.
+  /// \return The file size, in bytes.
+  std::size_t size() const;
+
+ private:
+  /// \var buffer_
+  ///   The file contents, if the file could not be mapped.
+  std::vector<std::uint64_t> buffer_;
+
+  /// \var data_
+  ///   The file data.
+  const char* data_;
+
+  /// \var is_mapped_
+  ///   An indicator that tells if the data is memory mapped.
+  bool is_mapped_;
+
+  /// \var size_
+  ///   The file size, in bytes.
+  std::size_t size_;
+};
+
+#endif  // MODELS_BASE_MAPPED_FILE_H_
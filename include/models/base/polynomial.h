@@ -7,6 +7,7 @@
 #include <list>
 #include <vector>
 
+#include "models/base/dual.h"
 #include "models/base/error_message.h"
 
 /// \par OVERVIEW
@@ -72,6 +73,13 @@ class Polynomial {
   /// \return The y value.
   double Y(const double& x) const;
 
+  /// \brief Gets the y value and its derivative.
+  /// \param[in] x
+  ///   The x value, with its derivative with respect to the seeded input.
+  /// \return The y value, with its derivative with respect to the seeded
+  ///   input.
+  Dual<double> Y(const Dual<double>& x) const;
+
   /// \brief Gets the polynomial coefficients.
   /// \return The polynomial coefficients.
   const std::vector<double>* coefficients() const;
@@ -0,0 +1,148 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_BASE_RANDOM_GENERATOR_H_
+#define MODELS_BASE_RANDOM_GENERATOR_H_
+
+#include <cstdint>
+#include <list>
+
+#include "models/base/error_message.h"
+
+/// \par OVERVIEW
+///
+/// This class is a counter-based random number generator.
+///
+/// \par COUNTER-BASED GENERATION
+///
+/// Each value is a hash of a key and a counter, so the generator has no
+/// internal state other than the counter. The key is built from a seed and a
+/// stream number. Giving every sample its own stream makes the values for that
+/// sample independent of the order that samples are drawn in, or the thread
+/// that draws them.
+///
+/// \par HASH
+///
+/// The hash is the SplitMix64 finalizer, applied to the key plus a multiple of
+/// the counter.
+class CounterRandomGenerator {
+ public:
+  /// \brief Default constructor.
+  /// The seed and stream are zero.
+  CounterRandomGenerator();
+
+  /// \brief Alternate constructor.
+  /// \param[in] seed
+  ///   The seed.
+  /// \param[in] stream
+  ///   The stream number.
+  CounterRandomGenerator(const uint64_t& seed, const uint64_t& stream);
+
+  /// \brief Destructor.
+  ~CounterRandomGenerator();
+
+  /// \brief Gets the next value and advances the counter.
+  /// \return A value that is uniformly distributed over all 64 bit values.
+  uint64_t Next();
+
+  /// \brief Gets the next standard normal value.
+  /// \return A normally distributed value with a mean of zero and a standard
+  ///   deviation of one.
+  /// This uses the Box-Muller transform, and always advances the counter by
+  /// two.
+  double Normal();
+
+  /// \brief Gets the next uniform value.
+  /// \return A value that is uniformly distributed between zero and one,
+  ///   excluding both end points.
+  double Uniform();
+
+  /// \brief Gets the counter.
+  /// \return The counter.
+  uint64_t counter() const;
+
+  /// \brief Sets the counter.
+  /// \param[in] counter
+  ///   The counter.
+  void set_counter(const uint64_t& counter);
+
+ private:
+  /// \brief Mixes the bits of a value.
+  /// \param[in] value
+  ///   The value.
+  /// \return The mixed value.
+  static uint64_t Mix(const uint64_t& value);
+
+  /// \var counter_
+  ///   The number of values that have been generated.
+  uint64_t counter_;
+
+  /// \var key_
+  ///   The key, which is built from the seed and stream.
+  uint64_t key_;
+};
+
+/// \par OVERVIEW
+///
+/// This struct is a probability distribution for a sampled value.
+///
+/// \par BOUNDS
+///
+/// The lower and upper bounds are the range of a uniform distribution. Normal
+/// samples are clamped to the bounds, which keeps values such as ice thickness
+/// from becoming negative.
+struct RandomDistribution {
+ public:
+  /// \par OVERVIEW
+  ///
+  /// This enum contains types of distributions.
+  enum class DistributionType {
+    kNull,
+    kNormal,
+    kUniform
+  };
+
+  /// \brief Default constructor.
+  RandomDistribution();
+
+  /// \brief Destructor.
+  ~RandomDistribution();
+
+  /// \brief Draws a sample.
+  /// \param[in,out] generator
+  ///   The random number generator.
+  /// \return The sampled value.
+  double Sample(CounterRandomGenerator* generator) const;
+
+  /// \brief Validates member variables.
+  /// \param[in] is_included_warnings
+  ///   A flag that tightens the acceptable value range.
+  /// \param[in,out] messages
+  ///   A list of detailed error messages. If this is provided, any validation
+  ///   errors will be appended to the list.
+  /// \return A boolean value indicating status of member variables.
+  bool Validate(const bool& is_included_warnings = true,
+                std::list<ErrorMessage>* messages = nullptr) const;
+
+  /// \var deviation
+  ///   The standard deviation of a normal distribution.
+  double deviation;
+
+  /// \var lower
+  ///   The lower bound. The default is negative infinity.
+  double lower;
+
+  /// \var mean
+  ///   The mean of a normal distribution.
+  double mean;
+
+  /// \var type
+  ///   The distribution type.
+  DistributionType type;
+
+  /// \var upper
+  ///   The upper bound. The default is positive infinity.
+  double upper;
+};
+
+#endif  // MODELS_BASE_RANDOM_GENERATOR_H_
@@ -0,0 +1,481 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_BASE_SLOT_VECTOR_H_
+#define MODELS_BASE_SLOT_VECTOR_H_
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <unordered_map>
+#include <vector>
+
+/// \par OVERVIEW
+///
+/// This struct is a handle to an element in a slot vector.
+///
+/// \par GENERATION
+///
+/// Every time an element is erased, the generation of its slot is incremented.
+/// A handle is only valid if its generation matches the slot generation, so a
+/// handle to an erased element is never resolved to an element that later
+/// reuses the slot.
+struct SlotHandle {
+ public:
+  /// \brief Default constructor.
+  SlotHandle() {
+    generation = -1;
+    slot = -1;
+  }
+
+  /// \var generation
+  ///   The slot generation when the handle was created.
+  int generation;
+
+  /// \var slot
+  ///   The slot index.
+  int slot;
+};
+
+/// \par OVERVIEW
+///
+/// This class is an ordered sequence of elements that are stored in stable
+/// slots.
+///
+/// \par STORAGE
+///
+/// Elements are stored in slots that never move in memory, so pointers and
+/// references to an element remain valid until the element is erased. An erased
+/// slot is reset to a default value, so the erased element does not keep any
+/// resources, and the slot is reused by later insertions. The sequence order
+/// is kept in a separate contiguous index array, so accessing an element by
+/// position is constant time, and inserting or erasing only shifts integer
+/// slot indexes.
+///
+/// \par ADDRESS LOOKUP
+///
+/// The position of an element can be found from its memory address in constant
+/// time. An address is only meaningful while the element exists, because the
+/// address of an erased element is resolved to the element that reuses its
+/// slot. A handle should be kept instead if the element may be erased, since
+/// handles are checked against the slot generation.
+template <class T>
+class SlotVector {
+ public:
+  /// \par OVERVIEW
+  ///
+  /// This class is a random access iterator over the sequence order.
+  template <class Container, class Value>
+  class Iterator {
+   public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef Value value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef Value* pointer;
+    typedef Value& reference;
+
+    /// \brief Default constructor.
+    Iterator() {
+      container_ = nullptr;
+      position_ = 0;
+    }
+
+    /// \brief Alternate constructor.
+    /// \param[in] container
+    ///   The slot vector.
+    /// \param[in] position
+    ///   The sequence position.
+    Iterator(Container* container, const difference_type& position) {
+      container_ = container;
+      position_ = position;
+    }
+
+    /// \brief Converts a mutable iterator to a constant iterator.
+    operator Iterator<const Container, const Value>() const {
+      return Iterator<const Container, const Value>(container_, position_);
+    }
+
+    reference operator*() const {
+      return (*container_)[position_];
+    }
+
+    pointer operator->() const {
+      return &(*container_)[position_];
+    }
+
+    reference operator[](const difference_type& offset) const {
+      return (*container_)[position_ + offset];
+    }
+
+    Iterator& operator++() {
+      position_++;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator iter = *this;
+      position_++;
+      return iter;
+    }
+
+    Iterator& operator--() {
+      position_--;
+      return *this;
+    }
+
+    Iterator operator--(int) {
+      Iterator iter = *this;
+      position_--;
+      return iter;
+    }
+
+    Iterator& operator+=(const difference_type& offset) {
+      position_ += offset;
+      return *this;
+    }
+
+    Iterator& operator-=(const difference_type& offset) {
+      position_ -= offset;
+      return *this;
+    }
+
+    Iterator operator+(const difference_type& offset) const {
+      return Iterator(container_, position_ + offset);
+    }
+
+    Iterator operator-(const difference_type& offset) const {
+      return Iterator(container_, position_ - offset);
+    }
+
+    difference_type operator-(const Iterator& that) const {
+      return position_ - that.position_;
+    }
+
+    bool operator==(const Iterator& that) const {
+      return position_ == that.position_;
+    }
+
+    bool operator!=(const Iterator& that) const {
+      return position_ != that.position_;
+    }
+
+    bool operator<(const Iterator& that) const {
+      return position_ < that.position_;
+    }
+
+    bool operator>(const Iterator& that) const {
+      return position_ > that.position_;
+    }
+
+    bool operator<=(const Iterator& that) const {
+      return position_ <= that.position_;
+    }
+
+    bool operator>=(const Iterator& that) const {
+      return position_ >= that.position_;
+    }
+
+    /// \brief Gets the sequence position.
+    /// \return The sequence position.
+    difference_type position() const {
+      return position_;
+    }
+
+   private:
+    /// \var container_
+    ///   The slot vector.
+    Container* container_;
+
+    /// \var position_
+    ///   The sequence position.
+    difference_type position_;
+  };
+
+  typedef Iterator<SlotVector<T>, T> iterator;
+  typedef Iterator<const SlotVector<T>, const T> const_iterator;
+
+  /// \brief Default constructor.
+  SlotVector() {
+  }
+
+  /// \brief Copy constructor.
+  /// \param[in] that
+  ///   The slot vector to copy from.
+  /// The copied elements keep the same slots and sequence order.
+  SlotVector(const SlotVector<T>& that) {
+    *this = that;
+  }
+
+  /// \brief Copy assignment operator.
+  /// \param[in] that
+  ///   The slot vector to copy from.
+  /// \return A reference to the slot vector.
+  SlotVector<T>& operator=(const SlotVector<T>& that) {
+    if (this == &that) {
+      return *this;
+    }
+
+    generations_ = that.generations_;
+    order_ = that.order_;
+    positions_ = that.positions_;
+    slots_free_ = that.slots_free_;
+    values_ = that.values_;
+
+    // rebuilds the address lookup for the new slots
+    slots_address_.clear();
+    const int kSizeSlots = values_.size();
+    for (int slot = 0; slot < kSizeSlots; slot++) {
+      slots_address_[&values_[slot]] = slot;
+    }
+
+    return *this;
+  }
+
+  /// \brief Destructor.
+  ~SlotVector() {
+  }
+
+  /// \brief Gets an element.
+  /// \param[in] position
+  ///   The sequence position. This is not checked.
+  /// \return The element.
+  T& operator[](const std::ptrdiff_t& position) {
+    return values_[order_[position]];
+  }
+
+  /// \brief Gets an element.
+  /// \param[in] position
+  ///   The sequence position. This is not checked.
+  /// \return The element.
+  const T& operator[](const std::ptrdiff_t& position) const {
+    return values_[order_[position]];
+  }
+
+  /// \brief Gets an element.
+  /// \param[in] position
+  ///   The sequence position.
+  /// \return The element.
+  const T& at(const int& position) const {
+    return values_[order_.at(position)];
+  }
+
+  /// \brief Gets an element.
+  /// \param[in] position
+  ///   The sequence position.
+  /// \return The element.
+  T& at(const int& position) {
+    return values_[order_.at(position)];
+  }
+
+  /// \brief Gets the last element.
+  /// \return The last element.
+  const T& back() const {
+    return values_[order_.back()];
+  }
+
+  /// \brief Gets an iterator to the first element.
+  /// \return An iterator to the first element.
+  iterator begin() {
+    return iterator(this, 0);
+  }
+
+  /// \brief Gets an iterator to the first element.
+  /// \return An iterator to the first element.
+  const_iterator begin() const {
+    return const_iterator(this, 0);
+  }
+
+  /// \brief Gets an iterator to the first element.
+  /// \return An iterator to the first element.
+  const_iterator cbegin() const {
+    return const_iterator(this, 0);
+  }
+
+  /// \brief Gets an iterator past the last element.
+  /// \return An iterator past the last element.
+  const_iterator cend() const {
+    return const_iterator(this, order_.size());
+  }
+
+  /// \brief Erases all elements and slots.
+  void clear() {
+    generations_.clear();
+    order_.clear();
+    positions_.clear();
+    slots_address_.clear();
+    slots_free_.clear();
+    values_.clear();
+  }
+
+  /// \brief Determines if the sequence is empty.
+  /// \return If the sequence is empty.
+  bool empty() const {
+    return order_.empty();
+  }
+
+  /// \brief Gets an iterator past the last element.
+  /// \return An iterator past the last element.
+  iterator end() {
+    return iterator(this, order_.size());
+  }
+
+  /// \brief Gets an iterator past the last element.
+  /// \return An iterator past the last element.
+  const_iterator end() const {
+    return const_iterator(this, order_.size());
+  }
+
+  /// \brief Erases an element.
+  /// \param[in] iter
+  ///   The iterator to the element.
+  /// \return An iterator to the element that followed the erased element.
+  iterator erase(const_iterator iter) {
+    const int position = iter.position();
+    const int slot = order_[position];
+
+    // removes from the sequence and shifts the following positions
+    order_.erase(order_.begin() + position);
+    UpdatePositions(position);
+
+    // frees the slot and releases the erased value
+    generations_[slot]++;
+    positions_[slot] = -1;
+    values_[slot] = T();
+    slots_free_.push_back(slot);
+
+    return iterator(this, position);
+  }
+
+  /// \brief Gets the first element.
+  /// \return The first element.
+  const T& front() const {
+    return values_[order_.front()];
+  }
+
+  /// \brief Gets a handle to an element.
+  /// \param[in] position
+  ///   The sequence position.
+  /// \return A handle to the element. If the position is invalid, a default
+  ///   handle is returned.
+  SlotHandle Handle(const int& position) const {
+    SlotHandle handle;
+    const int kSize = order_.size();
+    if ((position < 0) || (kSize <= position)) {
+      return handle;
+    }
+
+    handle.slot = order_[position];
+    handle.generation = generations_[handle.slot];
+    return handle;
+  }
+
+  /// \brief Gets the sequence position of an element.
+  /// \param[in] value
+  ///   The element address.
+  /// \return The sequence position. If the element is not found, -1 is
+  ///   returned.
+  int IndexOf(const T* value) const {
+    auto iter = slots_address_.find(value);
+    if (iter == slots_address_.cend()) {
+      return -1;
+    }
+
+    return positions_[iter->second];
+  }
+
+  /// \brief Gets the sequence position of a handle.
+  /// \param[in] handle
+  ///   The element handle.
+  /// \return The sequence position. If the handle is no longer valid, -1 is
+  ///   returned.
+  int IndexOf(const SlotHandle& handle) const {
+    const int kSizeSlots = values_.size();
+    if ((handle.slot < 0) || (kSizeSlots <= handle.slot)
+        || (generations_[handle.slot] != handle.generation)) {
+      return -1;
+    }
+
+    return positions_[handle.slot];
+  }
+
+  /// \brief Inserts an element.
+  /// \param[in] iter
+  ///   The iterator to insert before.
+  /// \param[in] value
+  ///   The element.
+  /// \return An iterator to the inserted element.
+  iterator insert(const_iterator iter, const T& value) {
+    const int position = iter.position();
+
+    // gets a free slot, or creates a new one
+    int slot = -1;
+    if (slots_free_.empty() == false) {
+      slot = slots_free_.back();
+      slots_free_.pop_back();
+      values_[slot] = value;
+    } else {
+      slot = values_.size();
+      values_.push_back(value);
+      generations_.push_back(0);
+      positions_.push_back(-1);
+      slots_address_[&values_.back()] = slot;
+    }
+
+    // adds to the sequence and shifts the following positions
+    order_.insert(order_.begin() + position, slot);
+    UpdatePositions(position);
+
+    return iterator(this, position);
+  }
+
+  /// \brief Adds an element to the end of the sequence.
+  /// \param[in] value
+  ///   The element.
+  void push_back(const T& value) {
+    insert(cend(), value);
+  }
+
+  /// \brief Gets the number of elements.
+  /// \return The number of elements.
+  std::size_t size() const {
+    return order_.size();
+  }
+
+ private:
+  /// \brief Updates the slot positions.
+  /// \param[in] position
+  ///   The first sequence position to update.
+  void UpdatePositions(const int& position) {
+    const int kSize = order_.size();
+    for (int index = position; index < kSize; index++) {
+      positions_[order_[index]] = index;
+    }
+  }
+
+  /// \var generations_
+  ///   The generation of each slot.
+  std::vector<int> generations_;
+
+  /// \var order_
+  ///   The slot index at each sequence position.
+  std::vector<int> order_;
+
+  /// \var positions_
+  ///   The sequence position of each slot. Free slots are set to -1.
+  std::vector<int> positions_;
+
+  /// \var slots_address_
+  ///   The slot index for each element address.
+  std::unordered_map<const T*, int> slots_address_;
+
+  /// \var slots_free_
+  ///   The slots that can be reused.
+  std::vector<int> slots_free_;
+
+  /// \var values_
+  ///   The element slots. A deque is used because it does not move existing
+  ///   elements when growing at the end.
+  std::deque<T> values_;
+};
+
+#endif  // MODELS_BASE_SLOT_VECTOR_H_
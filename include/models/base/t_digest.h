@@ -0,0 +1,130 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_BASE_T_DIGEST_H_
+#define MODELS_BASE_T_DIGEST_H_
+
+#include <vector>
+
+/// \par OVERVIEW
+///
+/// This class is a t-digest, which summarizes a stream of values so that
+/// quantiles can be estimated without storing every value.
+///
+/// \par CENTROIDS
+///
+/// The values are grouped into centroids, which store a mean and a weight. The
+/// centroid size is limited by a scale function, so centroids near the tails
+/// are small and centroids near the median are large. This keeps the tail
+/// quantiles accurate, which are usually the quantiles of interest. The
+/// number of centroids is roughly the compression parameter, regardless of
+/// the number of values.
+///
+/// \par BUFFERING
+///
+/// Added values are buffered, and merged into the centroids when the buffer is
+/// full or when the digest is queried. Digests that are built separately, such
+/// as on separate threads, can be merged.
+///
+/// \par EXACT STATISTICS
+///
+/// The count, mean, minimum, and maximum are tracked exactly.
+class TDigest {
+ public:
+  /// \brief Default constructor.
+  /// The compression is 100.
+  TDigest();
+
+  /// \brief Alternate constructor.
+  /// \param[in] compression
+  ///   The compression parameter. Larger values give more accurate quantiles
+  ///   and use more memory.
+  explicit TDigest(const double& compression);
+
+  /// \brief Destructor.
+  ~TDigest();
+
+  /// \brief Adds a value.
+  /// \param[in] value
+  ///   The value.
+  void Add(const double& value);
+
+  /// \brief Clears all values.
+  void Clear();
+
+  /// \brief Gets the mean.
+  /// \return The mean of all values. If there are no values, -999999 is
+  ///   returned.
+  double Mean() const;
+
+  /// \brief Merges another digest into this one.
+  /// \param[in] other
+  ///   The other digest.
+  void Merge(const TDigest& other);
+
+  /// \brief Gets an estimated quantile.
+  /// \param[in] fraction
+  ///   The quantile fraction, between zero and one.
+  /// \return The estimated value at the quantile. If there are no values,
+  ///   -999999 is returned.
+  double Quantile(const double& fraction) const;
+
+  /// \brief Gets the number of values.
+  /// \return The number of values.
+  int count() const;
+
+  /// \brief Gets the maximum value.
+  /// \return The maximum value. If there are no values, -999999 is returned.
+  double max() const;
+
+  /// \brief Gets the minimum value.
+  /// \return The minimum value. If there are no values, -999999 is returned.
+  double min() const;
+
+ private:
+  /// \par OVERVIEW
+  ///
+  /// This struct is a group of values.
+  struct Centroid {
+    /// \var mean
+    ///   The mean of the values.
+    double mean;
+
+    /// \var weight
+    ///   The number of values.
+    double weight;
+  };
+
+  /// \brief Merges the buffered values into the centroids.
+  void Compress() const;
+
+  /// \var buffer_
+  ///   The values that have not been merged into the centroids.
+  mutable std::vector<Centroid> buffer_;
+
+  /// \var centroids_
+  ///   The centroids, sorted by mean.
+  mutable std::vector<Centroid> centroids_;
+
+  /// \var compression_
+  ///   The compression parameter.
+  double compression_;
+
+  /// \var count_
+  ///   The number of values.
+  int count_;
+
+  /// \var max_
+  ///   The maximum value.
+  double max_;
+
+  /// \var min_
+  ///   The minimum value.
+  double min_;
+
+  /// \var sum_
+  ///   The sum of all values.
+  double sum_;
+};
+
+#endif  // MODELS_BASE_T_DIGEST_H_
@@ -0,0 +1,153 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_BASE_THREAD_POOL_H_
+#define MODELS_BASE_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// \par OVERVIEW
+///
+/// This class is a pool of worker threads that execute indexed tasks.
+///
+/// \par WORK STEALING
+///
+/// Each worker has its own task queue. The tasks are dealt out to the queues
+/// before the workers are woken up. A worker takes tasks from the front of its
+/// own queue, and when that is empty it steals tasks from the back of the other
+/// queues. This keeps all workers busy when the task durations are uneven.
+///
+/// \par CALLING THREAD
+///
+/// The thread that calls ParallelFor also executes tasks until all queues are
+/// empty, and then waits for the workers to finish.
+class ThreadPool {
+ public:
+  /// \brief Default constructor.
+  /// The number of threads is set to the hardware concurrency.
+  ThreadPool();
+
+  /// \brief Alternate constructor.
+  /// \param[in] num_threads
+  ///   The number of threads that execute tasks, including the calling thread.
+  ///   If this is less than one, the hardware concurrency is used.
+  explicit ThreadPool(const int& num_threads);
+
+  /// \brief Destructor.
+  /// This stops and joins all worker threads.
+  ~ThreadPool();
+
+  /// \brief Executes a task for every index in a range.
+  /// \param[in] num_tasks
+  ///   The number of tasks. The task is called with indexes from zero to one
+  ///   less than this value.
+  /// \param[in] task
+  ///   The task function. This must be safe to call from multiple threads at
+  ///   the same time.
+  /// This function blocks until all tasks have completed. It should not be
+  /// called from within a task.
+  void ParallelFor(const int& num_tasks,
+                   const std::function<void(const int&)>& task);
+
+  /// \brief Executes a task for every index in a range, with an optional pool.
+  /// \param[in] pool
+  ///   The thread pool. If this is nullptr, the tasks are executed serially on
+  ///   the calling thread.
+  /// \param[in] num_tasks
+  ///   The number of tasks.
+  /// \param[in] task
+  ///   The task function.
+  /// This is for classes that accept an optional pool.
+  static void Run(ThreadPool* pool, const int& num_tasks,
+                  const std::function<void(const int&)>& task);
+
+  /// \brief Gets the number of threads that execute tasks.
+  /// \return The number of threads, including the calling thread.
+  int num_threads() const;
+
+ private:
+  /// \par OVERVIEW
+  ///
+  /// This struct is a task queue that is owned by a single worker.
+  struct TaskQueue {
+    /// \var indexes
+    ///   The task indexes.
+    std::deque<int> indexes;
+
+    /// \var mutex
+    ///   The mutex that guards the indexes.
+    std::mutex mutex;
+  };
+
+  /// \brief Executes tasks until all queues are empty.
+  /// \param[in] index_queue
+  ///   The index of the preferred queue. This is the first queue that is
+  ///   searched for tasks.
+  void ExecuteTasks(const int& index_queue);
+
+  /// \brief Initializes the worker threads.
+  /// \param[in] num_threads
+  ///   The number of threads that execute tasks, including the calling thread.
+  void Initialize(const int& num_threads);
+
+  /// \brief Gets a task index.
+  /// \param[in] index_queue
+  ///   The index of the preferred queue.
+  /// \param[out] index_task
+  ///   The task index.
+  /// \return If a task was found. The preferred queue is searched from the
+  ///   front, and the other queues are searched from the back.
+  bool PopTask(const int& index_queue, int* index_task);
+
+  /// \brief Runs the worker loop.
+  /// \param[in] index_queue
+  ///   The index of the queue owned by the worker.
+  void RunWorker(const int& index_queue);
+
+  /// \var condition_done_
+  ///   The condition that is signaled when all tasks have completed.
+  std::condition_variable condition_done_;
+
+  /// \var condition_work_
+  ///   The condition that is signaled when new tasks are queued, or when the
+  ///   workers are stopping.
+  std::condition_variable condition_work_;
+
+  /// \var generation_
+  ///   The number of times that tasks have been queued. The workers use this
+  ///   to detect new tasks.
+  int generation_;
+
+  /// \var is_stopping_
+  ///   An indicator that tells the workers to exit.
+  bool is_stopping_;
+
+  /// \var mutex_
+  ///   The mutex that guards the generation, stopping indicator, and task.
+  std::mutex mutex_;
+
+  /// \var num_remaining_
+  ///   The number of tasks that have not completed.
+  std::atomic<int> num_remaining_;
+
+  /// \var queues_
+  ///   The task queues. The last queue belongs to the calling thread.
+  std::vector<std::unique_ptr<TaskQueue>> queues_;
+
+  /// \var task_
+  ///   The task function that is currently being executed.
+  const std::function<void(const int&)>* task_;
+
+  /// \var workers_
+  ///   The worker threads.
+  std::vector<std::thread> workers_;
+};
+
+#endif  // MODELS_BASE_THREAD_POOL_H_
@@ -4,6 +4,8 @@
 #ifndef MODELS_BASE_UNITS_H_
 #define MODELS_BASE_UNITS_H_
 
+#include <type_traits>
+
 // This namespace separates unit types (angles, force, length, etc) to make the
 // interface easier to use and more extensible. Where unit conversions require
 // addition/subtraction, the order of operations is important and easier to
@@ -109,9 +111,50 @@ enum class UnitSystem {
   kMetric
 };
 
-const double kGravityImperial = 1.0 / 0.0310810;
-const double kGravityMetric = 1.0 / 0.101972;
-const double kPi = 3.14159265358979;
+constexpr double kGravityImperial = 1.0 / 0.0310810;
+constexpr double kGravityMetric = 1.0 / 0.101972;
+constexpr double kPi = 3.14159265358979;
+
+// angle conversion factors
+constexpr double kAngleDegreesToRadians = kPi / 180.0;
+constexpr double kAngleRadiansToDegrees = 180.0 / kPi;
+
+// force conversion factors
+constexpr double kForceNewtonsToPounds = 1.0 / 4.4482216152605;
+constexpr double kForcePoundsToNewtons = 4.4482216152605;
+
+// length conversion factors
+constexpr double kLengthCentimetersToMeters = 1.0 / 100;
+constexpr double kLengthFeetToInches = 12.0;
+constexpr double kLengthFeetToMeters = 0.3048;
+constexpr double kLengthFeetToMiles = 1.0 / 5280.0;
+constexpr double kLengthInchesToFeet = 1.0 / 12.0;
+constexpr double kLengthKilometersToMeters = 1000.0;
+constexpr double kLengthMetersToCentimeters = 100.0;
+constexpr double kLengthMetersToFeet = 1.0 / 0.3048;
+constexpr double kLengthMetersToKilometers = 1.0 / 1000.0;
+constexpr double kLengthMetersToMillimeters = 1000.0;
+constexpr double kLengthMilesToFeet = 5280.0;
+constexpr double kLengthMillimetersToMeters = 1.0 / 1000.0;
+
+// pressure conversion factors
+constexpr double kStressMegaPascalToPascal = 1000000;
+constexpr double kStressPascalToMegaPascal = 1.0 / 1000000;
+constexpr double kStressPascalToPsf = 1.0 / 47.88026;
+constexpr double kStressPsfToPascal = 47.88026;
+constexpr double kStressPsfToPsi = 1.0 / 144.0;
+constexpr double kStressPsiToPsf = 144.0;
+
+// temperature conversion factors
+constexpr double kTemperatureKelvinToRankine = 1.8;
+constexpr double kTemperatureRankineToKelvin = 1.0 / 1.8;
+
+constexpr double kTemperatureShiftCelsiusToFahrenheit = 32;
+constexpr double kTemperatureShiftCelsiusToKelvin = 273.15;
+constexpr double kTemperatureShiftFahrenheitToCelsius = -32;
+constexpr double kTemperatureShiftFahrenheitToRankine = 459.67;
+constexpr double kTemperatureShiftKelvinToCelsius = -273.15;
+constexpr double kTemperatureShiftRankineToFahrenheit = -459.67;
 
 /// \brief Converts the angle value.
 /// \param[in] value
@@ -198,6 +241,180 @@ double ConvertTemperature(const double& value,
                           const int& exponent = 1,
                           const bool& is_numerator = true);
 
+/// \par OVERVIEW
+///
+/// These are the measurement dimensions of the compile-time unit types.
+struct AngleDimension {};
+struct ForceDimension {};
+struct LengthDimension {};
+struct StressDimension {};
+
+/// \par OVERVIEW
+///
+/// These are the compile-time unit types. Every unit is defined relative to
+/// the metric base unit of its dimension (radians, newtons, meters, pascals),
+/// as a scale that is divided by a divisor:
+///   base value = value * Scale() / Divisor()
+///
+/// The scale and divisor are kept separate so that a conversion factor
+/// between two units is solved with the same operations as the named
+/// conversion factors. Ex: the degrees to radians factor is kPi / 180, and
+/// the radians to degrees factor is 180 / kPi.
+///
+/// Temperatures are not included because most of the conversions require a
+/// shift, which does not apply to temperature differences.
+struct Degrees {
+  typedef AngleDimension Dimension;
+  static constexpr double Divisor() { return 180.0; }
+  static constexpr double Scale() { return kPi; }
+};
+
+struct Radians {
+  typedef AngleDimension Dimension;
+  static constexpr double Divisor() { return 1.0; }
+  static constexpr double Scale() { return 1.0; }
+};
+
+struct Newtons {
+  typedef ForceDimension Dimension;
+  static constexpr double Divisor() { return 1.0; }
+  static constexpr double Scale() { return 1.0; }
+};
+
+struct Pounds {
+  typedef ForceDimension Dimension;
+  static constexpr double Divisor() { return 1.0; }
+  static constexpr double Scale() { return kForcePoundsToNewtons; }
+};
+
+struct Centimeters {
+  typedef LengthDimension Dimension;
+  static constexpr double Divisor() { return 100.0; }
+  static constexpr double Scale() { return 1.0; }
+};
+
+struct Feet {
+  typedef LengthDimension Dimension;
+  static constexpr double Divisor() { return 1.0; }
+  static constexpr double Scale() { return kLengthFeetToMeters; }
+};
+
+struct Inches {
+  typedef LengthDimension Dimension;
+  static constexpr double Divisor() { return 12.0; }
+  static constexpr double Scale() { return kLengthFeetToMeters; }
+};
+
+struct Kilometers {
+  typedef LengthDimension Dimension;
+  static constexpr double Divisor() { return 1.0; }
+  static constexpr double Scale() { return 1000.0; }
+};
+
+struct Meters {
+  typedef LengthDimension Dimension;
+  static constexpr double Divisor() { return 1.0; }
+  static constexpr double Scale() { return 1.0; }
+};
+
+struct Miles {
+  typedef LengthDimension Dimension;
+  static constexpr double Divisor() { return 1.0; }
+  static constexpr double Scale() { return kLengthFeetToMeters * 5280.0; }
+};
+
+struct Millimeters {
+  typedef LengthDimension Dimension;
+  static constexpr double Divisor() { return 1000.0; }
+  static constexpr double Scale() { return 1.0; }
+};
+
+struct MegaPascals {
+  typedef StressDimension Dimension;
+  static constexpr double Divisor() { return 1.0; }
+  static constexpr double Scale() { return 1000000.0; }
+};
+
+struct Pascals {
+  typedef StressDimension Dimension;
+  static constexpr double Divisor() { return 1.0; }
+  static constexpr double Scale() { return 1.0; }
+};
+
+struct Psf {
+  typedef StressDimension Dimension;
+  static constexpr double Divisor() { return 1.0; }
+  static constexpr double Scale() { return kStressPsfToPascal; }
+};
+
+struct Psi {
+  typedef StressDimension Dimension;
+  static constexpr double Divisor() { return 1.0; }
+  static constexpr double Scale() { return kStressPsfToPascal * 144.0; }
+};
+
+/// \brief Gets the factor that converts between two units.
+/// \return The conversion factor.
+/// The factor is a constant expression, so it is folded into the caller.
+template <class UnitFrom, class UnitTo>
+constexpr double Factor() {
+  static_assert(std::is_same<typename UnitFrom::Dimension,
+                             typename UnitTo::Dimension>::value,
+                "Units must have the same dimension");
+  return (UnitFrom::Scale() * UnitTo::Divisor())
+      / (UnitFrom::Divisor() * UnitTo::Scale());
+}
+
+/// \brief Converts a value between two units.
+/// \param[in] value
+///   The starting value to convert.
+/// \return The converted value.
+/// This compiles to a multiplication by a constant, and should be preferred
+/// over the enum-based conversion functions in frequently called code.
+template <class UnitFrom, class UnitTo>
+constexpr double Convert(const double& value) {
+  return value * Factor<UnitFrom, UnitTo>();
+}
+
+/// \par OVERVIEW
+///
+/// This class is a value with a compile-time unit. Quantities implicitly
+/// convert to other units of the same dimension, and fail to compile when
+/// converted to a different dimension.
+///
+/// \par EXAMPLE
+///
+///   const units::Quantity<units::Degrees> angle(30);
+///   const units::Quantity<units::Radians> angle_radians = angle;
+///   const double x = std::cos(angle_radians.value());
+template <class Unit>
+class Quantity {
+ public:
+  /// \brief Default constructor.
+  constexpr Quantity() : value_(0) {}
+
+  /// \brief Alternate constructor.
+  /// \param[in] value
+  ///   The value, in the unit of the quantity.
+  constexpr explicit Quantity(const double& value) : value_(value) {}
+
+  /// \brief Converting constructor.
+  /// \param[in] quantity
+  ///   A quantity with another unit of the same dimension.
+  template <class UnitOther>
+  constexpr Quantity(const Quantity<UnitOther>& quantity)
+      : value_(Convert<UnitOther, Unit>(quantity.value())) {}
+
+  /// \brief Gets the value.
+  /// \return The value, in the unit of the quantity.
+  constexpr double value() const { return value_; }
+
+ private:
+  /// \var value_
+  ///   The value, in the unit of the quantity.
+  double value_;
+};
+
 }  // namespace units
 
 #endif  // MODELS_BASE_UNITS_H_
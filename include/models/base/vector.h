@@ -68,6 +68,15 @@ class Vector2d {
   ///   counter-clockwise, while negative values rotate clockwise.
   void Rotate(const double& angle_rotation);
 
+  /// \brief Rotates the vector using a precomputed sine and cosine.
+  /// \param[in] sin_rotation
+  ///   The sine of the rotation angle.
+  /// \param[in] cos_rotation
+  ///   The cosine of the rotation angle.
+  /// This applies the rotation matrix directly, so no trigonometric functions
+  /// are evaluated. Positive angles rotate counter-clockwise.
+  void RotateSinCos(const double& sin_rotation, const double& cos_rotation);
+
   /// \brief Scales the vector by increasing or decreasing the magnitude.
   /// \param[in] factor_scale
   ///   The scaling factor for adjusting the magnitude.
@@ -150,6 +159,19 @@ class Vector3d {
   ///   counter-clockwise, while negative values rotate clockwise.
   void Rotate(const Plane2dType& plane, const double& angle_rotation);
 
+  /// \brief Rotates the vector in a specific plane using a precomputed sine
+  ///   and cosine.
+  /// \param[in] plane
+  ///   The 2D plane which is referenced. The first axis is the horizontal
+  ///   axis.
+  /// \param[in] sin_rotation
+  ///   The sine of the rotation angle.
+  /// \param[in] cos_rotation
+  ///   The cosine of the rotation angle.
+  void RotateSinCos(const Plane2dType& plane,
+                    const double& sin_rotation,
+                    const double& cos_rotation);
+
   /// \brief Scales the vector by increasing or decreasing the magnitude.
   /// \param[in] factor_scale
   ///   The scaling factor for adjusting the magnitude.
@@ -7,6 +7,7 @@
 #include <list>
 #include <vector>
 
+#include "models/base/dual.h"
 #include "models/base/point.h"
 #include "models/transmissionline/catenary.h"
 #include "models/transmissionline/line_cable.h"
@@ -50,6 +51,14 @@
 /// back-on-line, while positive numbers indicate that the offset is
 /// ahead-on-line.
 ///
+/// \par PULLEY STATE SOLUTION
+///
+/// The horizontal tension of the first span is iterated until the pulley
+/// state length matches the clipped state length. Each downstream span
+/// horizontal tension is inverted directly from the previous span support
+/// tension, and the derivatives are chained along the spans, so the iteration
+/// can use Newton steps.
+///
 /// \par ASSUMPTIONS
 ///
 /// This class assumes that the cable attachment points do not change between
@@ -125,8 +134,12 @@ class CableSagPositionCorrector {
   /// \brief Solves the catenary tensions for the pulley state.
   /// \param[in] tension_horizontal_start
   ///   The horizontal tension for the starting catenary.
+  /// \param[out] length
+  ///   The total length of the pulley state catenaries, with its derivative
+  ///   with respect to the starting horizontal tension.
   /// \return If the pulley state tensions were successfully solved for.
-  bool SolvePulleyStateTensions(const double& tension_horizontal_start) const;
+  bool SolvePulleyStateTensions(const double& tension_horizontal_start,
+                                Dual<double>* length) const;
 
   /// \brief Updates cached member variables and modifies control variables if
   ///    update is required.
@@ -5,10 +5,34 @@
 #define MODELS_SAGGING_TRANSIT_SAGGER_H_
 
 #include <list>
+#include <vector>
 
 #include "models/base/point.h"
 #include "models/transmissionline/catenary.h"
 
+/// \par OVERVIEW
+///
+/// This struct contains the transit set-up for a span.
+struct TransitSetup {
+ public:
+  /// \var angle_low
+  ///   The lowest angle from the transit to the catenary.
+  double angle_low;
+
+  /// \var factor_control
+  ///   The control factor for the low angle point.
+  double factor_control;
+
+  /// \var point_catenary_low
+  ///   The catenary position of the low angle point.
+  Point3d<double> point_catenary_low;
+
+  /// \var point_target
+  ///   The target point. This is only valid if the transit is located along
+  ///   the x-z plane.
+  Point3d<double> point_target;
+};
+
 /// \par OVERVIEW
 ///
 /// This class solves for the transit angle to be used for sagging a
@@ -50,6 +74,17 @@
 /// position can only be calculated if the transit is positioned along the x-z
 /// plane (i.e. y coordinate = 0), and there no transverse catenary loading
 /// (i.e. y component of unit load = 0).
+///
+/// \par LOW POINT SOLUTION
+///
+/// The lowest angle point is where the sight line from the transit is tangent
+/// to the catenary. This tangency condition is solved directly with a Newton
+/// iteration on the catenary x coordinate, safeguarded by bisection.
+///
+/// \par SECTIONS
+///
+/// The transit set-ups for every span in a section can be solved at once,
+/// which reuses a single sagger for all of the spans.
 class TransitSagger {
  public:
   /// \brief Default constructor.
@@ -76,6 +111,20 @@ class TransitSagger {
   /// x-z plane (i.e. zero y coordinate).
   Point3d<double> PointTarget() const;
 
+  /// \brief Solves the transit set-ups for a set of spans.
+  /// \param[in] catenaries
+  ///   The span catenaries.
+  /// \param[in] points_transit
+  ///   The transit positions, which are in the coordinate system of the
+  ///   matching span catenary.
+  /// \param[out] setups
+  ///   The transit set-ups, in the same order as the catenaries. If a span
+  ///   does not solve, its set-up values are invalid (-999999).
+  /// \return If every span set-up was solved.
+  static bool SolveSetups(const std::vector<Catenary3d>& catenaries,
+                          const std::vector<Point3d<double>>& points_transit,
+                          std::vector<TransitSetup>* setups);
+
   /// \brief Validates member variables.
   /// \param[in] is_included_warnings
   ///   A flag that tightens the acceptable value range.
@@ -120,18 +169,6 @@ class TransitSagger {
   /// \return A boolean indicating if class is updated.
   bool IsUpdated() const;
 
-  /// \brief Searches for the catenary position with the lowest angle.
-  /// \param[in] position_back
-  ///   The back catenary position boundary.
-  /// \param[in] position_ahead
-  ///   The ahead catenary position boundary.
-  /// \param[in] num_points
-  ///   The number of points to model within the specified range.
-  /// \return The catenary position with the lowest angle.
-  double PositionCatenaryLowAngle(const double& position_back,
-                                  const double& position_ahead,
-                                  const int& num_points) const;
-
   /// \brief Updates cached member variables and modifies control variables if
   ///    update is required.
   /// \return A boolean indicating if class updates completed successfully.
@@ -7,6 +7,7 @@
 #include <list>
 #include <vector>
 
+#include "models/base/dual.h"
 #include "models/base/error_message.h"
 #include "models/base/point.h"
 #include "models/base/polynomial.h"
@@ -99,6 +100,14 @@ class CableComponentElongationModel {
   /// \return A load value.
   double Load(const double& strain) const;
 
+  /// \brief Gets the load and its derivative.
+  /// \param[in] strain
+  ///   The strain value (x-axis), with its derivative with respect to the
+  ///   seeded input.
+  /// \return A load value, with its derivative with respect to the seeded
+  ///   input.
+  Dual<double> Load(const Dual<double>& strain) const;
+
   /// \brief Gets the region boundary points for the component state.
   /// \return A vector of points at the region boundaries.
   /// The region boundaries are at the following locations:
@@ -119,6 +128,14 @@ class CableComponentElongationModel {
   /// \return A strain value.
   double Strain(const double& load) const;
 
+  /// \brief Gets the strain and its derivative.
+  /// \param[in] load
+  ///   The load value (y-axis), with its derivative with respect to the
+  ///   seeded input.
+  /// \return A strain value, with its derivative with respect to the seeded
+  ///   input. The derivative is not finite where the slope is zero.
+  Dual<double> Strain(const Dual<double>& load) const;
+
   /// \brief Gets the thermal strain.
   /// \return The thermal strain.
   double StrainThermal() const;
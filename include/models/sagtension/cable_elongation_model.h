@@ -85,6 +85,17 @@ class CableElongationModel {
   double Load(const CableElongationModel::ComponentType& type_component,
               const double& strain) const;
 
+  /// \brief Gets the load and its derivative.
+  /// \param[in] type_component
+  ///   The model component type.
+  /// \param[in] strain
+  ///   The strain value (x-axis), with its derivative with respect to the
+  ///   seeded input.
+  /// \return The load (y-axis), with its derivative with respect to the
+  ///   seeded input.
+  Dual<double> Load(const CableElongationModel::ComponentType& type_component,
+                    const Dual<double>& strain) const;
+
   /// \brief Gets the slope.
   /// \param[in] type_component
   ///   The model component type.
@@ -103,6 +114,17 @@ class CableElongationModel {
   double Strain(const CableElongationModel::ComponentType& type_component,
                 const double& load) const;
 
+  /// \brief Gets the strain and its derivative.
+  /// \param[in] type_component
+  ///   The model component type.
+  /// \param[in] load
+  ///   The load value (y-axis), with its derivative with respect to the
+  ///   seeded input.
+  /// \return The strain (x-axis), with its derivative with respect to the
+  ///   seeded input. The derivative is not finite where the slope is zero.
+  Dual<double> Strain(const CableElongationModel::ComponentType& type_component,
+                      const Dual<double>& load) const;
+
   /// \brief Validates member variables.
   /// \param[in] is_included_warnings
   ///   A flag that tightens the acceptable value range.
@@ -35,6 +35,44 @@ class CableStrainer {
   /// \return The length in the finish state.
   double LengthFinish() const;
 
+  /// \brief Gets the length of the cable in the finish state and its
+  ///   derivative.
+  /// \param[in] load_finish
+  ///   The load of the cable at the finish state, with its derivative with
+  ///   respect to the seeded input. This is used instead of the finish load
+  ///   member variable.
+  /// \return The length in the finish state, with its derivative with respect
+  ///   to the seeded input.
+  Dual<double> LengthFinish(const Dual<double>& load_finish) const;
+
+  /// \brief Gets the length of the cable in the finish state and its
+  ///   derivative, using a known start strain.
+  /// \param[in] load_finish
+  ///   The load of the cable at the finish state, with its derivative with
+  ///   respect to the seeded input.
+  /// \param[in] strain_start
+  ///   The strain of the cable at the start state. This is used instead of
+  ///   solving the start model, so it can be calculated once for repeated
+  ///   solutions.
+  /// \return The length in the finish state, with its derivative with respect
+  ///   to the seeded input.
+  Dual<double> LengthFinish(const Dual<double>& load_finish,
+                            const double& strain_start) const;
+
+  /// \brief Gets the length of the cable after a strain transition.
+  /// \param[in] length_start
+  ///   The length of the cable at the start state.
+  /// \param[in] strain_start
+  ///   The strain of the cable at the start state.
+  /// \param[in] strain_finish
+  ///   The strain of the cable at the finish state.
+  /// \return The length in the finish state.
+  /// This uses the same strain equation as LengthFinish(), so strains that are
+  /// solved once can be combined for many start lengths.
+  static double LengthFromStrains(const double& length_start,
+                                  const double& strain_start,
+                                  const double& strain_finish);
+
   /// \brief Validates member variables.
   /// \param[in] is_included_warnings
   ///   A flag that tightens the acceptable value range.
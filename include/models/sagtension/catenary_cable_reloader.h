@@ -6,6 +6,7 @@
 
 #include <list>
 
+#include "models/base/dual.h"
 #include "models/base/error_message.h"
 #include "models/base/vector.h"
 #include "models/sagtension/cable_strainer.h"
@@ -34,6 +35,18 @@
 /// model. The horizontal tension of the reloaded catenary is numerically
 /// solved. The horizontal tension solution will have a catenary length and
 /// cable length (as predicted by the cable strainer) that match.
+///
+/// \par SOLUTION
+///
+/// The horizontal tension is solved with a Newton iteration. The catenary
+/// length, average tension, and cable length are evaluated together with dual
+/// numbers, so each iteration gets the length difference and its derivative
+/// in a single pass. The reference state does not change during the solution,
+/// so the start strain is only calculated once.
+///
+/// The iteration starts at the minimum catenary constant, unless a horizontal
+/// tension guess is provided. Repeated solutions that change slightly, such as
+/// during an outer iteration, can use the previous solution as the guess.
 class CatenaryCableReloader {
  public:
   /// \brief Default constructor.
@@ -52,6 +65,13 @@ class CatenaryCableReloader {
   ///   model.
   double LengthUnloaded() const;
 
+  /// \brief Solves the class without validating member variables.
+  /// \return If the class solved successfully.
+  /// This is intended for repeated solutions where the member variables are
+  /// known to be valid, such as when only the reloaded cable model or unit
+  /// weight changes between solutions.
+  bool Solve() const;
+
   /// \brief Gets the horizontal tension of the reloaded catenary.
   /// \return The horizontal tension of the reloaded catenary.
   double TensionHorizontal() const;
@@ -93,11 +113,21 @@ class CatenaryCableReloader {
   ///   The reloaded cable model.
   void set_model_reloaded(const CableElongationModel* model_reloaded);
 
+  /// \brief Sets the horizontal tension guess.
+  /// \param[in] tension_horizontal_guess
+  ///   The initial guess for the reloaded catenary horizontal tension. If
+  ///   this is not positive, the minimum catenary constant is used instead.
+  void set_tension_horizontal_guess(const double& tension_horizontal_guess);
+
   /// \brief Sets the unit weight of the reloaded catenary.
   /// \param[in] weight_unit_reloaded
   ///   The unit weight of the reloaded catenary.
   void set_weight_unit_reloaded(const Vector3d* weight_unit_reloaded);
 
+  /// \brief Gets the horizontal tension guess.
+  /// \return The horizontal tension guess.
+  double tension_horizontal_guess() const;
+
   /// \brief Gets the unit weight of the reloaded catenary.
   /// \return The unit weight of the reloaded catenary.
   const Vector3d* weight_unit_reloaded() const;
@@ -118,11 +148,12 @@ class CatenaryCableReloader {
   /// \brief Gets the difference in length between the catenary curve and the
   /// loaded cable.
   /// \param[in] tension_horizontal
-  ///   The horizontal tension for the catenary.
+  ///   The horizontal tension for the catenary, with its derivative with
+  ///   respect to the seeded input.
   /// \return The difference in length between the catenary curve and the loaded
-  ///   cable.
+  ///   cable, with its derivative with respect to the seeded input.
   /// Length difference = catenary length - cable length
-  double LengthDifference(const double& tension_horizontal) const;
+  Dual<double> LengthDifference(const Dual<double>& tension_horizontal) const;
 
   /// \brief Solves the reloaded catenary horizontal tension.
   /// \return The success status of solution.
@@ -133,14 +164,6 @@ class CatenaryCableReloader {
   /// \return A boolean indicating if class updates completed successfully.
   bool Update() const;
 
-  /// \brief Updates the catenary horizontal tension and load of the cable
-  ///   strainer.
-  /// \param[in] tension_horizontal
-  ///   The horizontal tension for the catenary.
-  /// \return The success status of the update.
-  bool UpdateReloadedCatenaryAndStrainer(
-      const double& tension_horizontal) const;
-
   /// \var catenary_
   ///   The reference catenary.
   const Catenary3d* catenary_;
@@ -161,14 +184,32 @@ class CatenaryCableReloader {
   ///   The reloaded cable model.
   const CableElongationModel* model_reloaded_;
 
+  /// \var spacing_endpoints_2d_
+  ///   The end point spacing of the reloaded catenary, in the 2D catenary
+  ///   plane.
+  mutable Vector2d spacing_endpoints_2d_;
+
+  /// \var strain_start_
+  ///   The strain of the reference catenary, using the reference cable model.
+  mutable double strain_start_;
+
   /// \var strainer_
   ///   The strainer that uses cable elongation models to strain the cable from
   ///   a reference state to a reloaded state.
   mutable CableStrainer strainer_;
 
+  /// \var tension_horizontal_guess_
+  ///   The initial guess for the reloaded catenary horizontal tension.
+  double tension_horizontal_guess_;
+
   /// \var weight_unit_reloaded_
   ///   The unit weight of the reloaded catenary.
   const Vector3d* weight_unit_reloaded_;
+
+  /// \var weight_unit_2d_
+  ///   The unit weight magnitude of the reloaded catenary, in the 2D catenary
+  ///   plane.
+  mutable double weight_unit_2d_;
 };
 
 #endif  // MODELS_SAGTENSION_CATENARY_CABLE_RELOADER_H_
@@ -0,0 +1,177 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_SAGTENSION_LINE_CABLE_BATCH_UNLOADER_H_
+#define MODELS_SAGTENSION_LINE_CABLE_BATCH_UNLOADER_H_
+
+#include <list>
+#include <vector>
+
+#include "models/base/error_message.h"
+#include "models/base/thread_pool.h"
+#include "models/base/vector.h"
+#include "models/sagtension/line_cable_loader_base.h"
+
+/// \par OVERVIEW
+///
+/// This class unloads a line cable for a set of attachment spacings and
+/// temperatures, which can be used to get prefabrication (cut) lengths for
+/// every span in a section. The process is as follows:
+///   - set up the line cable for sag-tension analysis (see LineCableLoaderBase)
+///   - solve the start strain of every span at the constraint tension
+///   - build and solve an unloaded cable model for every temperature
+///   - combine the span and temperature strains into unloaded lengths
+///
+/// The line cable setup, including the stretch solution, is only done once
+/// and is shared by every span and temperature.
+///
+/// \par STRAINS
+///
+/// The unloaded length of a span only depends on the span length and start
+/// strain, which do not vary with temperature, and the unloaded strain, which
+/// does not vary with span. These are each solved once, and every unloaded
+/// length is solved with the same strain equation as LineCableUnloader.
+///
+/// \par MATRIX
+///
+/// The unloaded lengths are stored contiguously, ordered by temperature and
+/// then by spacing.
+///
+/// \par THREADING
+///
+/// Every span and temperature is solved as an independent task. If a thread
+/// pool is provided, the tasks are executed on it. Otherwise the tasks are
+/// executed serially on the calling thread.
+class LineCableBatchUnloader : public LineCableLoaderBase {
+ public:
+  /// \brief Default constructor.
+  LineCableBatchUnloader();
+
+  /// \brief Destructor.
+  ~LineCableBatchUnloader();
+
+  /// \brief Gets an unloaded length.
+  /// \param[in] index_temperature
+  ///   The temperature index.
+  /// \param[in] index_spacing
+  ///   The attachment spacing index.
+  /// \return The unloaded length. If the class does not update or the index
+  ///   is invalid, -999999 is returned.
+  double LengthUnloaded(const int& index_temperature,
+                        const int& index_spacing) const;
+
+  /// \brief Gets the unloaded lengths.
+  /// \return The unloaded lengths, ordered by temperature and then by spacing.
+  ///   If the class does not update, a nullptr is returned.
+  const std::vector<double>* LengthsUnloaded() const;
+
+  /// \brief Validates member variables.
+  /// \param[in] is_included_warnings
+  ///   A flag that tightens the acceptable value range.
+  /// \param[in,out] messages
+  ///   A list of detailed error messages. If this is provided, any validation
+  ///   errors will be appended to the list.
+  /// \return A boolean value indicating status of member variables.
+  bool Validate(const bool& is_included_warnings = true,
+                std::list<ErrorMessage>* messages = nullptr) const;
+
+  /// \brief Gets the unloaded cable condition.
+  /// \return The unloaded cable condition.
+  CableConditionType condition_unloaded() const;
+
+  /// \brief Sets the unloaded cable condition.
+  /// \param[in] condition_unloaded
+  ///   The unloaded cable condition.
+  void set_condition_unloaded(const CableConditionType& condition_unloaded);
+
+  /// \brief Sets the attachment spacings.
+  /// \param[in] spacings_attachments
+  ///   The attachment spacings. The coordinates follow the Catenary3d
+  ///   coordinate system.
+  void set_spacings_attachments(
+      const std::vector<Vector3d>* spacings_attachments);
+
+  /// \brief Sets the unloaded temperatures.
+  /// \param[in] temperatures_unloaded
+  ///   The unloaded temperatures.
+  void set_temperatures_unloaded(
+      const std::vector<double>* temperatures_unloaded);
+
+  /// \brief Sets the thread pool.
+  /// \param[in] pool
+  ///   The thread pool. This is optional.
+  void set_thread_pool(ThreadPool* pool);
+
+  /// \brief Gets the attachment spacings.
+  /// \return The attachment spacings.
+  const std::vector<Vector3d>* spacings_attachments() const;
+
+  /// \brief Gets the unloaded temperatures.
+  /// \return The unloaded temperatures.
+  const std::vector<double>* temperatures_unloaded() const;
+
+  /// \brief Gets the thread pool.
+  /// \return The thread pool.
+  ThreadPool* thread_pool() const;
+
+ private:
+  /// \brief Determines if class is updated.
+  /// \return A boolean indicating if class is updated.
+  virtual bool IsUpdated() const;
+
+  /// \brief Updates cached member variables and modifies control variables if
+  ///   update is required.
+  /// \return A boolean indicating if class updates completed successfully.
+  virtual bool Update() const;
+
+  /// \brief Updates the unloaded lengths.
+  /// \return The success status of the update.
+  bool UpdateLengthsUnloaded() const;
+
+  /// \brief Updates the span lengths and start strains, and the unloaded
+  ///   strains.
+  /// \return The success status of the update.
+  bool UpdateStrains() const;
+
+  /// \var condition_unloaded_
+  ///   The condition of the cable when unloaded.
+  CableConditionType condition_unloaded_;
+
+  /// \var is_updated_lengths_unloaded_
+  ///   An indicator that tells if the unloaded lengths are updated.
+  mutable bool is_updated_lengths_unloaded_;
+
+  /// \var is_updated_strains_
+  ///   An indicator that tells if the strains are updated.
+  mutable bool is_updated_strains_;
+
+  /// \var lengths_span_
+  ///   The span catenary lengths at the constraint tension.
+  mutable std::vector<double> lengths_span_;
+
+  /// \var lengths_unloaded_
+  ///   The unloaded lengths, ordered by temperature and then by spacing.
+  mutable std::vector<double> lengths_unloaded_;
+
+  /// \var pool_
+  ///   The thread pool that solves the tasks.
+  ThreadPool* pool_;
+
+  /// \var spacings_attachments_
+  ///   The spacings of the span attachments.
+  const std::vector<Vector3d>* spacings_attachments_;
+
+  /// \var strains_span_
+  ///   The span strains at the constraint tension.
+  mutable std::vector<double> strains_span_;
+
+  /// \var strains_unloaded_
+  ///   The unloaded strains for every temperature.
+  mutable std::vector<double> strains_unloaded_;
+
+  /// \var temperatures_unloaded_
+  ///   The temperatures that the cable is being unloaded to.
+  const std::vector<double>* temperatures_unloaded_;
+};
+
+#endif  // MODELS_SAGTENSION_LINE_CABLE_BATCH_UNLOADER_H_
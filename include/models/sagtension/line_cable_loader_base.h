@@ -4,11 +4,14 @@
 #ifndef MODELS_SAGTENSION_LINE_CABLE_LOADER_BASE_H_
 #define MODELS_SAGTENSION_LINE_CABLE_LOADER_BASE_H_
 
+#include <cstdint>
 #include <list>
 
 #include "models/base/error_message.h"
 #include "models/sagtension/cable_elongation_model.h"
 #include "models/sagtension/sag_tension_cable.h"
+#include "models/sagtension/stretch_state_cache.h"
+#include "models/transmissionline/cable_unit_load_table.h"
 #include "models/transmissionline/catenary.h"
 #include "models/transmissionline/line_cable.h"
 
@@ -30,6 +33,12 @@
 /// \par LINE CABLE GEOMETRY
 ///
 /// This class uses the ruling span geometry defined in the line cable.
+///
+/// \par CACHE
+///
+/// A stretch state cache can optionally be provided. The constraint catenary
+/// and stretch states are taken from the cache when the line cable has
+/// already been solved, and solved solutions are added to the cache.
 class LineCableLoaderBase {
  public:
   /// \brief Default constructor.
@@ -56,15 +65,34 @@ class LineCableLoaderBase {
   bool Validate(const bool& is_included_warnings = true,
                 std::list<ErrorMessage>* messages = nullptr) const;
 
+  /// \brief Gets the stretch state cache.
+  /// \return The stretch state cache.
+  StretchStateCache* cache_stretch() const;
+
   /// \brief Gets the line cable.
   /// \return The line cable.
   const LineCable* line_cable() const;
 
+  /// \brief Sets the stretch state cache.
+  /// \param[in] cache_stretch
+  ///   The stretch state cache. This is optional.
+  void set_cache_stretch(StretchStateCache* cache_stretch);
+
   /// \brief Sets the line cable.
   /// \param[in] line_cable
   ///   The line cable.
   void set_line_cable(const LineCable* line_cable);
 
+  /// \brief Sets the unit load table.
+  /// \param[in] table_unit_loads
+  ///   The unit load table. This is optional. If provided, unit loads are
+  ///   taken from the table when possible instead of being solved.
+  void set_table_unit_loads(const CableUnitLoadTable* table_unit_loads);
+
+  /// \brief Gets the unit load table.
+  /// \return The unit load table.
+  const CableUnitLoadTable* table_unit_loads() const;
+
  protected:
   /// \brief Initializes the models defined in the line cable.
   /// \return The success status of the update.
@@ -97,10 +125,26 @@ class LineCableLoaderBase {
   /// \return The success status of the update.
   bool UpdateConstraintCatenary() const;
 
+  /// \brief Updates the constraint catenary and stretch from the cache.
+  /// \param[in] key
+  ///   The line cable cache key.
+  /// \return If the cache contained the line cable solution.
+  bool UpdateFromCache(const std::uint64_t& key) const;
+
+  /// \brief Updates the cable models.
+  /// \return The success status of the update.
+  /// This function solves the lazily updated cable models, so they are only
+  /// read afterwards.
+  bool UpdateLineCableModels() const;
+
   /// \brief Updates the stretch due to load and creep.
   /// \return The success status of the update.
   bool UpdateLoadStretch() const;
 
+  /// \var cache_stretch_
+  ///   The stretch state cache.
+  StretchStateCache* cache_stretch_;
+
   /// \var cable_sagtension_
   ///   The cable, which is referenced for sag-tension methods.
   SagTensionCable cable_sagtension_;
@@ -144,6 +188,10 @@ class LineCableLoaderBase {
   /// \var state_stretch_load_;
   ///   The stretch state for the load condition.
   mutable CableStretchState state_stretch_load_;
+
+  /// \var table_unit_loads_
+  ///   The precomputed unit loads that are shared with other solvers.
+  const CableUnitLoadTable* table_unit_loads_;
 };
 
 #endif  // MODELS_SAGTENSION_LINE_CABLE_LOADER_BASE_H_
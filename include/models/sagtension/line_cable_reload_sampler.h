@@ -0,0 +1,234 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_SAGTENSION_LINE_CABLE_RELOAD_SAMPLER_H_
+#define MODELS_SAGTENSION_LINE_CABLE_RELOAD_SAMPLER_H_
+
+#include <cstdint>
+#include <list>
+
+#include "models/base/error_message.h"
+#include "models/base/random_generator.h"
+#include "models/base/t_digest.h"
+#include "models/base/thread_pool.h"
+#include "models/transmissionline/cable_constraint.h"
+#include "models/transmissionline/line_cable.h"
+#include "models/transmissionline/weather_load_case.h"
+
+/// \par OVERVIEW
+///
+/// This struct contains the distributions of the uncertain reload inputs. A
+/// distribution with a null type is not sampled, and the base value is used
+/// instead.
+struct ReloadDistributions {
+ public:
+  /// \var density_ice
+  ///   The reloaded weathercase ice density.
+  RandomDistribution density_ice;
+
+  /// \var limit_constraint
+  ///   The line cable constraint limit.
+  RandomDistribution limit_constraint;
+
+  /// \var pressure_wind
+  ///   The reloaded weathercase wind pressure.
+  RandomDistribution pressure_wind;
+
+  /// \var temperature_cable
+  ///   The reloaded weathercase cable temperature.
+  RandomDistribution temperature_cable;
+
+  /// \var thickness_ice
+  ///   The reloaded weathercase ice thickness.
+  RandomDistribution thickness_ice;
+};
+
+/// \par OVERVIEW
+///
+/// This class reloads a line cable for many samples of uncertain inputs, and
+/// summarizes the reloaded sag and horizontal tension. This can be used to
+/// find probabilistic values, such as the 95th percentile sag.
+///
+/// \par SAMPLING
+///
+/// Every sample draws the uncertain inputs from a counter-based random number
+/// generator, using the sample index as the stream. The inputs for a sample
+/// therefore only depend on the seed and sample index, and the results are
+/// reproducible regardless of threading.
+///
+/// \par BATCHES
+///
+/// The samples are solved in fixed size batches. Each batch copies the line
+/// cable and weathercase once, and reuses a single LineCableReloader for all
+/// of its samples. If the constraint limit is not sampled, the constraint and
+/// stretch solutions are shared by every sample in the batch, and only the
+/// reloaded cable model and catenary are solved again.
+///
+/// \par STATISTICS
+///
+/// Each batch summarizes its samples in t-digests, so the individual samples
+/// are not stored. The batch digests are merged in batch order once all
+/// batches are solved. Samples that do not solve are counted, and are not
+/// included in the statistics.
+///
+/// \par THREADING
+///
+/// Every batch is solved as an independent task. If a thread pool is
+/// provided, the tasks are executed on it. Otherwise the tasks are executed
+/// serially on the calling thread.
+class LineCableReloadSampler {
+ public:
+  /// \brief Default constructor.
+  LineCableReloadSampler();
+
+  /// \brief Destructor.
+  ~LineCableReloadSampler();
+
+  /// \brief Gets the reloaded sag statistics.
+  /// \return The reloaded sag statistics. If the class does not update, a
+  ///   nullptr is returned.
+  const TDigest* DigestSag() const;
+
+  /// \brief Gets the reloaded horizontal tension statistics.
+  /// \return The reloaded horizontal tension statistics. If the class does not
+  ///   update, a nullptr is returned.
+  const TDigest* DigestTensionHorizontal() const;
+
+  /// \brief Gets the number of samples that did not solve.
+  /// \return The number of samples that did not solve. If the class does not
+  ///   update, -1 is returned.
+  int NumSamplesFailed() const;
+
+  /// \brief Validates member variables.
+  /// \param[in] is_included_warnings
+  ///   A flag that tightens the acceptable value range.
+  /// \param[in,out] messages
+  ///   A list of detailed error messages. If this is provided, any validation
+  ///   errors will be appended to the list.
+  /// \return A boolean value indicating status of member variables.
+  bool Validate(const bool& is_included_warnings = true,
+                std::list<ErrorMessage>* messages = nullptr) const;
+
+  /// \brief Gets the reloaded cable condition.
+  /// \return The reloaded cable condition.
+  CableConditionType condition_reloaded() const;
+
+  /// \brief Gets the input distributions.
+  /// \return The input distributions.
+  const ReloadDistributions* distributions() const;
+
+  /// \brief Gets the line cable.
+  /// \return The line cable.
+  const LineCable* line_cable() const;
+
+  /// \brief Gets the number of samples.
+  /// \return The number of samples.
+  int num_samples() const;
+
+  /// \brief Gets the seed.
+  /// \return The seed.
+  uint64_t seed() const;
+
+  /// \brief Sets the reloaded cable condition.
+  /// \param[in] condition_reloaded
+  ///   The reloaded cable condition.
+  void set_condition_reloaded(const CableConditionType& condition_reloaded);
+
+  /// \brief Sets the input distributions.
+  /// \param[in] distributions
+  ///   The input distributions.
+  void set_distributions(const ReloadDistributions* distributions);
+
+  /// \brief Sets the line cable.
+  /// \param[in] line_cable
+  ///   The line cable, which provides the base constraint.
+  void set_line_cable(const LineCable* line_cable);
+
+  /// \brief Sets the number of samples.
+  /// \param[in] num_samples
+  ///   The number of samples.
+  void set_num_samples(const int& num_samples);
+
+  /// \brief Sets the seed.
+  /// \param[in] seed
+  ///   The seed.
+  void set_seed(const uint64_t& seed);
+
+  /// \brief Sets the thread pool.
+  /// \param[in] pool
+  ///   The thread pool. This is optional.
+  void set_thread_pool(ThreadPool* pool);
+
+  /// \brief Sets the reloaded weathercase.
+  /// \param[in] weathercase_reloaded
+  ///   The reloaded weathercase, which provides the base values.
+  void set_weathercase_reloaded(const WeatherLoadCase* weathercase_reloaded);
+
+  /// \brief Gets the thread pool.
+  /// \return The thread pool.
+  ThreadPool* thread_pool() const;
+
+  /// \brief Gets the reloaded weathercase.
+  /// \return The reloaded weathercase.
+  const WeatherLoadCase* weathercase_reloaded() const;
+
+ private:
+  /// \brief Determines if class is updated.
+  /// \return A boolean indicating if class is updated.
+  bool IsUpdated() const;
+
+  /// \brief Updates cached member variables and modifies control variables if
+  ///   update is required.
+  /// \return A boolean indicating if class updates completed successfully.
+  bool Update() const;
+
+  /// \brief Updates the statistics by solving every sample.
+  /// \return The success status of the update.
+  bool UpdateStatistics() const;
+
+  /// \var condition_reloaded_
+  ///   The condition of the cable when reloaded.
+  CableConditionType condition_reloaded_;
+
+  /// \var digest_sag_
+  ///   The reloaded sag statistics.
+  mutable TDigest digest_sag_;
+
+  /// \var digest_tension_horizontal_
+  ///   The reloaded horizontal tension statistics.
+  mutable TDigest digest_tension_horizontal_;
+
+  /// \var distributions_
+  ///   The input distributions.
+  const ReloadDistributions* distributions_;
+
+  /// \var is_updated_
+  ///   An indicator that tells if the class is updated.
+  mutable bool is_updated_;
+
+  /// \var line_cable_
+  ///   The line cable.
+  const LineCable* line_cable_;
+
+  /// \var num_failed_
+  ///   The number of samples that did not solve.
+  mutable int num_failed_;
+
+  /// \var num_samples_
+  ///   The number of samples.
+  int num_samples_;
+
+  /// \var pool_
+  ///   The thread pool that solves the batches.
+  ThreadPool* pool_;
+
+  /// \var seed_
+  ///   The random number generator seed.
+  uint64_t seed_;
+
+  /// \var weathercase_reloaded_
+  ///   The reloaded weathercase.
+  const WeatherLoadCase* weathercase_reloaded_;
+};
+
+#endif  // MODELS_SAGTENSION_LINE_CABLE_RELOAD_SAMPLER_H_
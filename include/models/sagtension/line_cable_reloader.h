@@ -30,6 +30,14 @@ class LineCableReloader : public LineCableLoaderBase {
   /// \return A catenary at the reloaded load case.
   Catenary3d CatenaryReloaded() const;
 
+  /// \brief Solves the class without validating member variables.
+  /// \return If the class solved successfully.
+  /// This is intended for repeated solutions where the member variables are
+  /// known to be valid, such as when only the reloaded weathercase or
+  /// condition changes between solutions. Only the reloaded cable model and
+  /// catenary are solved again in that case.
+  bool Solve() const;
+
   /// \brief Gets the reloaded cable state.
   /// \return The reloaded cable state.
   CableState StateReloaded() const;
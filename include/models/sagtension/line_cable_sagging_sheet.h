@@ -0,0 +1,289 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_SAGTENSION_LINE_CABLE_SAGGING_SHEET_H_
+#define MODELS_SAGTENSION_LINE_CABLE_SAGGING_SHEET_H_
+
+#include <list>
+#include <vector>
+
+#include "models/base/error_message.h"
+#include "models/base/point.h"
+#include "models/base/thread_pool.h"
+#include "models/base/units.h"
+#include "models/sagging/dyno_sagger.h"
+#include "models/sagtension/line_cable_reloader.h"
+#include "models/transmissionline/catenary.h"
+#include "models/transmissionline/line_cable.h"
+#include "models/transmissionline/weather_load_case.h"
+
+/// \par OVERVIEW
+///
+/// This struct is a sagging sheet cell, which contains the sagging values for
+/// one span at one temperature. Values that could not be solved are invalid
+/// (-999999).
+struct SaggingSheetCell {
+ public:
+  /// \var angle_transit
+  ///   The transit angle.
+  double angle_transit;
+
+  /// \var offset_clipping
+  ///   The clipping offset at the ahead structure of the span.
+  double offset_clipping;
+
+  /// \var tension_dyno
+  ///   The dynamometer tension.
+  double tension_dyno;
+
+  /// \var time_stopwatch
+  ///   The stopwatch return time.
+  double time_stopwatch;
+};
+
+/// \par OVERVIEW
+///
+/// This class generates a field sagging sheet for a line cable section. The
+/// sheet has a cell for every span and temperature. The process is as follows:
+///   - reload the ruling span to every temperature
+///   - solve the pulley state and clipping offsets for every temperature (see
+///     CableSagPositionCorrector)
+///   - solve the transit, stopwatch, and dyno values for every cell
+///
+/// \par RELOADING
+///
+/// The temperature weathercases have no wind or ice. A single
+/// LineCableReloader reloads the ruling span to every temperature, so the
+/// line cable constraint and stretch are only solved once.
+///
+/// \par SPAN GEOMETRY
+///
+/// The spans are defined by the attachment points, which are listed in order
+/// along the section. The cable is in pulleys while it is being sagged, so the
+/// transit, stopwatch, and dyno values are solved with the pulley state
+/// catenaries.
+///
+/// \par TRANSIT
+///
+/// The transit for each span is positioned at the back structure, a specified
+/// vertical distance below the back attachment point.
+///
+/// \par TABLE
+///
+/// The cells are stored contiguously, ordered by temperature and then by span.
+///
+/// \par THREADING
+///
+/// The temperatures are solved as independent tasks, followed by the cells. If
+/// a thread pool is provided, the tasks are executed on it. Otherwise the tasks
+/// are executed serially on the calling thread.
+class LineCableSaggingSheet {
+ public:
+  /// \brief Default constructor.
+  LineCableSaggingSheet();
+
+  /// \brief Destructor.
+  ~LineCableSaggingSheet();
+
+  /// \brief Gets a cell.
+  /// \param[in] index_temperature
+  ///   The temperature index.
+  /// \param[in] index_span
+  ///   The span index.
+  /// \return The cell. If the class does not update or the index is invalid,
+  ///   a nullptr is returned.
+  const SaggingSheetCell* Cell(const int& index_temperature,
+                               const int& index_span) const;
+
+  /// \brief Gets the cells.
+  /// \return The cells, ordered by temperature and then by span. If the class
+  ///   does not update, a nullptr is returned.
+  const std::vector<SaggingSheetCell>* Cells() const;
+
+  /// \brief Gets the ruling span horizontal tension for a temperature.
+  /// \param[in] index_temperature
+  ///   The temperature index.
+  /// \return The ruling span horizontal tension. If the class does not update
+  ///   or the index is invalid, -999999 is returned.
+  double TensionHorizontal(const int& index_temperature) const;
+
+  /// \brief Validates member variables.
+  /// \param[in] is_included_warnings
+  ///   A flag that tightens the acceptable value range.
+  /// \param[in,out] messages
+  ///   A list of detailed error messages. If this is provided, any validation
+  ///   errors will be appended to the list.
+  /// \return A boolean value indicating status of member variables.
+  bool Validate(const bool& is_included_warnings = true,
+                std::list<ErrorMessage>* messages = nullptr) const;
+
+  /// \brief Gets the sagging condition.
+  /// \return The sagging condition.
+  CableConditionType condition_sagging() const;
+
+  /// \brief Gets the distance of the transit below the back attachment point.
+  /// \return The distance of the transit below the back attachment point.
+  double distance_transit() const;
+
+  /// \brief Gets the line cable.
+  /// \return The line cable.
+  const LineCable* line_cable() const;
+
+  /// \brief Gets the dyno location.
+  /// \return The dyno location.
+  DynoSagger::SpanEndLocation location_dyno() const;
+
+  /// \brief Gets the attachment points.
+  /// \return The attachment points.
+  const std::vector<Point3d<double>>* points_attachment() const;
+
+  /// \brief Sets the sagging condition.
+  /// \param[in] condition_sagging
+  ///   The condition of the cable when sagged.
+  void set_condition_sagging(const CableConditionType& condition_sagging);
+
+  /// \brief Sets the distance of the transit below the back attachment point.
+  /// \param[in] distance_transit
+  ///   The distance of the transit below the back attachment point.
+  void set_distance_transit(const double& distance_transit);
+
+  /// \brief Sets the line cable.
+  /// \param[in] line_cable
+  ///   The line cable.
+  void set_line_cable(const LineCable* line_cable);
+
+  /// \brief Sets the dyno location.
+  /// \param[in] location_dyno
+  ///   The span end where the dyno is located.
+  void set_location_dyno(const DynoSagger::SpanEndLocation& location_dyno);
+
+  /// \brief Sets the attachment points.
+  /// \param[in] points_attachment
+  ///   The attachment points, in order along the section.
+  void set_points_attachment(
+      const std::vector<Point3d<double>>* points_attachment);
+
+  /// \brief Sets the temperatures.
+  /// \param[in] temperatures
+  ///   The sagging temperatures.
+  void set_temperatures(const std::vector<double>* temperatures);
+
+  /// \brief Sets the thread pool.
+  /// \param[in] pool
+  ///   The thread pool. This is optional.
+  void set_thread_pool(ThreadPool* pool);
+
+  /// \brief Sets the units.
+  /// \param[in] units
+  ///   The unit system.
+  void set_units(const units::UnitSystem& units);
+
+  /// \brief Sets the stopwatch wave.
+  /// \param[in] wave_stopwatch
+  ///   The stopwatch return wave number, which must be 1 or greater.
+  void set_wave_stopwatch(const int& wave_stopwatch);
+
+  /// \brief Gets the temperatures.
+  /// \return The temperatures.
+  const std::vector<double>* temperatures() const;
+
+  /// \brief Gets the thread pool.
+  /// \return The thread pool.
+  ThreadPool* thread_pool() const;
+
+  /// \brief Gets the units.
+  /// \return The unit system.
+  units::UnitSystem units() const;
+
+  /// \brief Gets the stopwatch wave.
+  /// \return The stopwatch return wave number.
+  int wave_stopwatch() const;
+
+ private:
+  /// \brief Determines if class is updated.
+  /// \return A boolean indicating if class is updated.
+  bool IsUpdated() const;
+
+  /// \brief Updates cached member variables and modifies control variables if
+  ///   update is required.
+  /// \return A boolean indicating if class updates completed successfully.
+  bool Update() const;
+
+  /// \brief Updates the cells.
+  /// \return The success status of the update.
+  bool UpdateCells() const;
+
+  /// \brief Updates the pulley state catenaries and clipping offsets.
+  /// \return The success status of the update.
+  bool UpdatePulleyStates() const;
+
+  /// \brief Updates the ruling span horizontal tensions.
+  /// \return The success status of the update.
+  bool UpdateTensionsHorizontal() const;
+
+  /// \var catenaries_pulleyed_
+  ///   The pulley state catenaries, ordered by temperature and then by span.
+  mutable std::vector<Catenary3d> catenaries_pulleyed_;
+
+  /// \var cells_
+  ///   The sagging sheet cells.
+  mutable std::vector<SaggingSheetCell> cells_;
+
+  /// \var condition_sagging_
+  ///   The condition of the cable when sagged.
+  CableConditionType condition_sagging_;
+
+  /// \var distance_transit_
+  ///   The distance of the transit below the back attachment point.
+  double distance_transit_;
+
+  /// \var is_updated_
+  ///   An indicator that tells if the class is updated.
+  mutable bool is_updated_;
+
+  /// \var line_cable_
+  ///   The line cable.
+  const LineCable* line_cable_;
+
+  /// \var location_dyno_
+  ///   The span end where the dyno is located.
+  DynoSagger::SpanEndLocation location_dyno_;
+
+  /// \var offsets_clipping_
+  ///   The clipping offsets, ordered by temperature and then by structure.
+  mutable std::vector<double> offsets_clipping_;
+
+  /// \var points_attachment_
+  ///   The attachment points.
+  const std::vector<Point3d<double>>* points_attachment_;
+
+  /// \var pool_
+  ///   The thread pool that solves the tasks.
+  ThreadPool* pool_;
+
+  /// \var reloader_
+  ///   The reloader, which is shared by every temperature.
+  mutable LineCableReloader reloader_;
+
+  /// \var temperatures_
+  ///   The sagging temperatures.
+  const std::vector<double>* temperatures_;
+
+  /// \var tensions_horizontal_
+  ///   The ruling span horizontal tensions for every temperature.
+  mutable std::vector<double> tensions_horizontal_;
+
+  /// \var units_
+  ///   The unit system.
+  units::UnitSystem units_;
+
+  /// \var wave_stopwatch_
+  ///   The stopwatch return wave number.
+  int wave_stopwatch_;
+
+  /// \var weathercases_
+  ///   The weathercases for every temperature.
+  mutable std::vector<WeatherLoadCase> weathercases_;
+};
+
+#endif  // MODELS_SAGTENSION_LINE_CABLE_SAGGING_SHEET_H_
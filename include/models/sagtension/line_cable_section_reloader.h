@@ -0,0 +1,213 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_SAGTENSION_LINE_CABLE_SECTION_RELOADER_H_
+#define MODELS_SAGTENSION_LINE_CABLE_SECTION_RELOADER_H_
+
+#include <list>
+#include <vector>
+
+#include "models/base/error_message.h"
+#include "models/base/thread_pool.h"
+#include "models/base/vector.h"
+#include "models/sagtension/line_cable_loader_base.h"
+#include "models/transmissionline/catenary.h"
+#include "models/transmissionline/transmission_line.h"
+
+/// \par OVERVIEW
+///
+/// This class reloads every span of a line cable to a specified weather case
+/// and condition. The process is as follows:
+///   - set up the line cable for sag-tension analysis (see LineCableLoaderBase)
+///   - resolve the span geometry from the transmission line attachments
+///   - build a cable model for the reloaded state
+///   - reload every span to the reloaded state
+///
+/// The line cable setup, including the stretch solution, is only done once
+/// for the section, and is shared by every span.
+///
+/// \par SPAN GEOMETRY
+///
+/// The line cable must be connected to line structures in the transmission
+/// line. The span geometry is the spacing between the structure attachment
+/// points of adjacent connections. The x component is the horizontal distance
+/// between attachments, the y component is zero, and the z component is the
+/// vertical distance between attachments.
+///
+/// \par SPAN MODEL
+///
+/// The spans can be modeled with one of the following methods:
+///   - ruling span: the ruling span catenary is reloaded, and its horizontal
+///     tension is applied to every span
+///   - individual: the constraint horizontal tension is applied to every span
+///     when installed, and each span is then reloaded with its own geometry
+///     and cable length
+///
+/// The ruling span model assumes that the horizontal tension equalizes between
+/// spans. The individual model assumes that the cable is fixed at every
+/// attachment after installation.
+///
+/// \par THREADING
+///
+/// For the individual span model, every span is reloaded as an independent
+/// task. If a thread pool is provided, the tasks are executed on it. Otherwise
+/// the tasks are executed serially on the calling thread.
+class LineCableSectionReloader : public LineCableLoaderBase {
+ public:
+  /// \par OVERVIEW
+  ///
+  /// This enum contains types of span models.
+  enum class SpanModelType {
+    kNull,
+    kIndividual,
+    kRulingSpan
+  };
+
+  /// \brief Default constructor.
+  LineCableSectionReloader();
+
+  /// \brief Destructor.
+  ~LineCableSectionReloader();
+
+  /// \brief Gets the reloaded catenaries.
+  /// \return The reloaded catenary for every span, ordered by connection. If
+  ///   the class does not update, a nullptr is returned.
+  const std::vector<Catenary3d>* CatenariesReloaded() const;
+
+  /// \brief Solves the class without validating member variables.
+  /// \return If the class solved successfully.
+  /// This is intended for repeated solutions where the member variables are
+  /// known to be valid, such as when only the reloaded weathercase or
+  /// condition changes between solutions. The section setup and span geometry
+  /// are not solved again in that case.
+  bool Solve() const;
+
+  /// \brief Gets the span spacings.
+  /// \return The spacing between attachments for every span, ordered by
+  ///   connection. If the class does not update, a nullptr is returned.
+  const std::vector<Vector3d>* SpacingsSpan() const;
+
+  /// \brief Validates member variables.
+  /// \param[in] is_included_warnings
+  ///   A flag that tightens the acceptable value range.
+  /// \param[in,out] messages
+  ///   A list of detailed error messages. If this is provided, any validation
+  ///   errors will be appended to the list.
+  /// \return A boolean value indicating status of member variables.
+  bool Validate(const bool& is_included_warnings = true,
+                std::list<ErrorMessage>* messages = nullptr) const;
+
+  /// \brief Gets the reloaded condition.
+  /// \return The reloaded condition.
+  CableConditionType condition_reloaded() const;
+
+  /// \brief Sets the reloaded condition.
+  /// \param[in] condition_reloaded
+  ///   The reloaded condition.
+  void set_condition_reloaded(const CableConditionType& condition_reloaded);
+
+  /// \brief Sets the thread pool.
+  /// \param[in] pool
+  ///   The thread pool. This is optional.
+  void set_thread_pool(ThreadPool* pool);
+
+  /// \brief Sets the transmission line.
+  /// \param[in] line
+  ///   The transmission line that contains the line cable connections.
+  void set_transmission_line(const TransmissionLine* line);
+
+  /// \brief Sets the span model type.
+  /// \param[in] type_model_span
+  ///   The span model type.
+  void set_type_model_span(const SpanModelType& type_model_span);
+
+  /// \brief Sets the reloaded weathercase.
+  /// \param[in] weathercase_reloaded
+  ///   The reloaded weathercase.
+  void set_weathercase_reloaded(const WeatherLoadCase* weathercase_reloaded);
+
+  /// \brief Gets the thread pool.
+  /// \return The thread pool.
+  ThreadPool* thread_pool() const;
+
+  /// \brief Gets the transmission line.
+  /// \return The transmission line.
+  const TransmissionLine* transmission_line() const;
+
+  /// \brief Gets the span model type.
+  /// \return The span model type.
+  SpanModelType type_model_span() const;
+
+  /// \brief Gets the reloaded weathercase.
+  /// \return The reloaded weathercase.
+  const WeatherLoadCase* weathercase_reloaded() const;
+
+ private:
+  /// \brief Determines if class is updated.
+  /// \return A boolean indicating if class is updated.
+  virtual bool IsUpdated() const;
+
+  /// \brief Updates cached member variables and modifies control variables if
+  ///   update is required.
+  /// \return A boolean indicating if class updates completed successfully.
+  virtual bool Update() const;
+
+  /// \brief Updates the reloaded cable model.
+  /// \return The success status of the update.
+  bool UpdateReloadedCableModel() const;
+
+  /// \brief Updates the reloaded catenaries.
+  /// \return The success status of the update.
+  bool UpdateReloadedCatenaries() const;
+
+  /// \brief Updates the span spacings.
+  /// \return The success status of the update.
+  bool UpdateSpacingsSpan() const;
+
+  /// \var catenaries_reloaded_
+  ///   The reloaded catenary for every span.
+  mutable std::vector<Catenary3d> catenaries_reloaded_;
+
+  /// \var condition_reloaded_
+  ///   The condition of the cable when loaded at the query load case.
+  CableConditionType condition_reloaded_;
+
+  /// \var is_updated_catenaries_reloaded_
+  ///   An indicator that tells if the reloaded catenaries are updated.
+  mutable bool is_updated_catenaries_reloaded_;
+
+  /// \var is_updated_model_reloaded_
+  ///   An indicator that tells if the reloaded cable model is updated.
+  mutable bool is_updated_model_reloaded_;
+
+  /// \var is_updated_spacings_span_
+  ///   An indicator that tells if the span spacings are updated.
+  mutable bool is_updated_spacings_span_;
+
+  /// \var line_
+  ///   The transmission line.
+  const TransmissionLine* line_;
+
+  /// \var model_reloaded_
+  ///   The cable model for the reloaded weathercase. This model may contain
+  ///   stretch, depending on the reloaded condition.
+  mutable CableElongationModel model_reloaded_;
+
+  /// \var pool_
+  ///   The thread pool that executes the span reloads.
+  ThreadPool* pool_;
+
+  /// \var spacings_span_
+  ///   The spacing between attachments for every span.
+  mutable std::vector<Vector3d> spacings_span_;
+
+  /// \var type_model_span_
+  ///   The span model type.
+  SpanModelType type_model_span_;
+
+  /// \var weathercase_reloaded_
+  ///   The load case that the cable is being reloaded to.
+  const WeatherLoadCase* weathercase_reloaded_;
+};
+
+#endif  // MODELS_SAGTENSION_LINE_CABLE_SECTION_RELOADER_H_
@@ -0,0 +1,171 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_SAGTENSION_STRETCH_STATE_CACHE_H_
+#define MODELS_SAGTENSION_STRETCH_STATE_CACHE_H_
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "models/base/mapped_file.h"
+#include "models/sagtension/cable_state.h"
+#include "models/transmissionline/line_cable.h"
+
+struct StretchStateCacheRecord;
+
+/// \par OVERVIEW
+///
+/// This struct is the cached solution of a line cable constraint and its
+/// stretch.
+struct StretchStateCacheEntry {
+ public:
+  /// \brief Default constructor.
+  StretchStateCacheEntry();
+
+  /// \brief Destructor.
+  ~StretchStateCacheEntry();
+
+  /// \var state_stretch_creep
+  ///   The stretch state for the creep condition.
+  CableStretchState state_stretch_creep;
+
+  /// \var state_stretch_load
+  ///   The stretch state for the load condition.
+  CableStretchState state_stretch_load;
+
+  /// \var tension_horizontal_constraint
+  ///   The horizontal tension of the constraint catenary.
+  double tension_horizontal_constraint;
+};
+
+/// \par OVERVIEW
+///
+/// This class caches line cable stretch solutions, so they can be reused
+/// between runs instead of being solved again.
+///
+/// \par KEYS
+///
+/// Entries are keyed by a stable 64-bit hash of everything the stretch
+/// solution depends on:
+///   - the cable sag-tension properties
+///   - the line cable constraint and constraint weathercase
+///   - the ruling span attachment spacing
+///   - the creep and load stretch weathercases
+///
+/// Names, descriptions, and notes are not included, so identical inputs with
+/// different names share an entry. The key does not depend on memory
+/// addresses, so it is the same across runs and processes.
+///
+/// \par FILE
+///
+/// The cache file is a header followed by fixed-width records sorted by key.
+/// The file is memory mapped read-only when opened, and entries are found with
+/// a binary search, so opening does not read or index the entries.
+///
+/// Entries that are added are kept in memory until the cache is written. A
+/// write merges the entries already in the target file, the opened file, and
+/// the added entries into a temporary file, which then replaces the target
+/// file. Processes that have the previous file mapped keep reading it
+/// unchanged, so any number of processes can read the cache while it is
+/// updated. The target file is replaced atomically (rename on POSIX, and
+/// MoveFileEx on Windows), so a crash during a write never leaves the target
+/// missing. If two processes write at the same time, the last write wins.
+///
+/// \par THREADING
+///
+/// Finding and adding entries is synchronized, so a cache can be shared by
+/// solvers on multiple threads.
+class StretchStateCache {
+ public:
+  /// \brief Default constructor.
+  StretchStateCache();
+
+  /// \brief Destructor.
+  ~StretchStateCache();
+
+  StretchStateCache(const StretchStateCache&) = delete;
+  StretchStateCache& operator=(const StretchStateCache&) = delete;
+
+  /// \brief Adds an entry.
+  /// \param[in] key
+  ///   The key.
+  /// \param[in] entry
+  ///   The entry. This replaces any entry with the same key.
+  void Add(const std::uint64_t& key, const StretchStateCacheEntry& entry);
+
+  /// \brief Closes the cache file and clears the added entries.
+  void Close();
+
+  /// \brief Finds an entry.
+  /// \param[in] key
+  ///   The key.
+  /// \param[out] entry
+  ///   The entry, if found.
+  /// \return If the entry was found. Added entries are searched before the
+  ///   file entries.
+  bool Find(const std::uint64_t& key, StretchStateCacheEntry* entry) const;
+
+  /// \brief Gets the key for a line cable.
+  /// \param[in] line_cable
+  ///   The line cable, which must be valid.
+  /// \return The key.
+  static std::uint64_t Key(const LineCable& line_cable);
+
+  /// \brief Opens a cache file.
+  /// \param[in] filepath
+  ///   The file path.
+  /// \return If the cache file opened successfully. The added entries are
+  ///   kept either way.
+  bool Open(const std::string& filepath);
+
+  /// \brief Writes the cache to a file.
+  /// \param[in] filepath
+  ///   The file path. This can be the file that is open.
+  /// \return If the cache was written successfully.
+  /// The opened file is not reloaded, but its entries remain available.
+  bool Write(const std::string& filepath) const;
+
+  /// \brief Gets the number of entries.
+  /// \return The number of unique entries in the file and the added entries.
+  int size() const;
+
+  /// \var kVersion
+  ///   The cache file format version.
+  static const int kVersion;
+
+ private:
+  /// \brief Finds a file record.
+  /// \param[in] key
+  ///   The key.
+  /// \return The file record. If the key is not in the file, a nullptr is
+  ///   returned.
+  const StretchStateCacheRecord* FindRecord(const std::uint64_t& key) const;
+
+  /// \brief Validates the opened file.
+  /// \return If the file is a valid cache file.
+  bool Initialize();
+
+  /// \var entries_added_
+  ///   The entries that have been added since the cache was opened.
+  std::map<std::uint64_t, StretchStateCacheEntry> entries_added_;
+
+  /// \var file_
+  ///   The mapped cache file.
+  MappedFile file_;
+
+  /// \var mutex_
+  ///   The mutex that synchronizes the added entries.
+  mutable std::mutex mutex_;
+
+  /// \var records_
+  ///   The file records, sorted by key.
+  const StretchStateCacheRecord* records_;
+
+  /// \var size_records_
+  ///   The number of file records.
+  std::uint64_t size_records_;
+};
+
+#endif  // MODELS_SAGTENSION_STRETCH_STATE_CACHE_H_
@@ -5,6 +5,7 @@
 #define MODELS_TRANSMISSIONLINE_ALIGNMENT_H_
 
 #include <list>
+#include <vector>
 
 #include "models/base/error_message.h"
 
@@ -47,6 +48,13 @@ struct AlignmentPoint {
 ///
 /// This class is an alignment path for a transmission line.
 ///
+/// \par STATION LOOKUP
+///
+/// The alignment points are stored contiguously, along with a sorted array of
+/// the point stations. Segment lookups use a binary search of the station
+/// array. Multiple stations can be resolved at once if they are sorted, which
+/// only requires a single pass over the station array.
+///
 /// \todo Add station equations.
 class Alignment {
  public:
@@ -78,6 +86,17 @@ class Alignment {
   ///   -1 is returned.
   int IndexSegment(const double& station) const;
 
+  /// \brief Gets the segment indexes for multiple stations.
+  /// \param[in] stations
+  ///   The stations, sorted in ascending order.
+  /// \return The segment indexes, matching the station order. If a station
+  ///   coincides with an alignment point, it will return the back segment. If
+  ///   a station is not valid, -1 is returned.
+  /// The stations are merged with the alignment stations in a single pass. If
+  ///   the stations are not sorted, the lookup falls back to a binary search
+  ///   for the unsorted stations.
+  std::vector<int> IndexesSegment(const std::vector<double>& stations) const;
+
   /// \brief Determines if the station value is on the alignment (valid).
   /// \param[in] station
   ///   The station.
@@ -105,7 +124,7 @@ class Alignment {
 
   /// \brief Gets the alignment points.
   /// \return The alignment points.
-  const std::list<AlignmentPoint>* points() const;
+  const std::vector<AlignmentPoint>* points() const;
 
  private:
   /// \brief Determines if the point index is valid.
@@ -115,8 +134,12 @@ class Alignment {
   bool IsValidPointIndex(const int& index) const;
 
   /// \var points_
-  ///   The sorted list of alignment points.
-  std::list<AlignmentPoint> points_;
+  ///   The alignment points, sorted by station.
+  std::vector<AlignmentPoint> points_;
+
+  /// \var stations_
+  ///   The station of each alignment point. This matches the point order.
+  std::vector<double> stations_;
 };
 
 #endif  // MODELS_TRANSMISSIONLINE_ALIGNMENT_H_
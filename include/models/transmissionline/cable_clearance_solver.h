@@ -0,0 +1,325 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_TRANSMISSIONLINE_CABLE_CLEARANCE_SOLVER_H_
+#define MODELS_TRANSMISSIONLINE_CABLE_CLEARANCE_SOLVER_H_
+
+#include <list>
+#include <vector>
+
+#include "models/base/bounding_volume_hierarchy.h"
+#include "models/base/error_message.h"
+#include "models/base/point.h"
+#include "models/base/vector.h"
+#include "models/transmissionline/catenary.h"
+
+/// \par OVERVIEW
+///
+/// This struct contains the position and loading of a cable for a clearance
+/// analysis.
+struct ClearanceCable {
+ public:
+  /// \brief Default constructor.
+  ClearanceCable() {
+    direction_transverse = AxisDirectionType::kNull;
+    tension_horizontal = -999999;
+  }
+
+  /// \var direction_transverse
+  ///   The transverse load direction, relative to the ahead direction of each
+  ///   span.
+  AxisDirectionType direction_transverse;
+
+  /// \var points_attachment
+  ///   The cable attachment xyz points, such as those solved by the
+  ///   CablePositionLocator.
+  std::vector<Point3d<double>> points_attachment;
+
+  /// \var tension_horizontal
+  ///   The horizontal tension of the cable.
+  double tension_horizontal;
+
+  /// \var weight_unit
+  ///   The unit weight of the cable. The x component is not used, the y
+  ///   component is transverse weight, and z component is vertical weight.
+  Vector3d weight_unit;
+};
+
+/// \par OVERVIEW
+///
+/// This struct contains a clearance solution.
+struct ClearanceResult {
+ public:
+  /// \brief Default constructor.
+  ClearanceResult() {
+    distance = -999999;
+    index_other = -1;
+    index_span = -1;
+  }
+
+  /// \var distance
+  ///   The minimum distance.
+  double distance;
+
+  /// \var index_other
+  ///   The span index of the other cable, or the segment index of the terrain
+  ///   profile.
+  int index_other;
+
+  /// \var index_span
+  ///   The span index of the cable.
+  int index_span;
+
+  /// \var point_cable
+  ///   The closest xyz point on the cable.
+  Point3d<double> point_cable;
+
+  /// \var point_other
+  ///   The closest xyz point on the other cable or terrain profile.
+  Point3d<double> point_other;
+};
+
+/// \par OVERVIEW
+///
+/// This struct contains the geometry of a cable span for a clearance analysis.
+struct ClearanceSpanGeometry {
+ public:
+  /// \var angle_xy_cos
+  ///   The cosine of the span direction angle in the xy plane.
+  double angle_xy_cos;
+
+  /// \var angle_xy_sin
+  ///   The sine of the span direction angle in the xy plane.
+  double angle_xy_sin;
+
+  /// \var box
+  ///   The bounding box of the span, in xyz coordinates.
+  BoundingBox3d box;
+
+  /// \var catenary
+  ///   The span catenary, which uses the back attachment as the origin.
+  Catenary3d catenary;
+
+  /// \var catenary_2d
+  ///   The span catenary projected to its 2D plane, which has the same
+  ///   position fractions as the span catenary.
+  Catenary2d catenary_2d;
+
+  /// \var direction_sag
+  ///   The xyz unit vector from the chord to the curve. The curve deviates
+  ///   from the chord in this direction along the entire span.
+  Vector3d direction_sag;
+
+  /// \var point_back
+  ///   The back cable attachment xyz point.
+  Point3d<double> point_back;
+};
+
+/// \par OVERVIEW
+///
+/// This class solves for the minimum clearance between cables, and between
+/// cables and a terrain profile.
+///
+/// \par COORDINATE SYSTEM
+///
+/// The coordinate system for this class matches the transmission line
+/// coordinate system.
+///
+/// \par SPAN BOUNDS
+///
+/// Each span catenary is the chord line plus a deviation that always points
+/// in the same (sag) direction, and is largest at the sag point. The span is
+/// therefore contained in the parallelogram formed by the chord and the sag
+/// vector, and the span bounding box is the box of that parallelogram. No
+/// points are sampled to build the bounds.
+///
+/// \par SEARCH
+///
+/// The spans of each cable and the segments of the terrain profile are stored
+/// in bounding volume hierarchies. A clearance query traverses two
+/// hierarchies, and only refines span pairs whose bounding boxes are closer
+/// than the best clearance found so far.
+///
+/// \par REFINEMENT
+///
+/// Each candidate pair is refined with a branch and bound search on the span
+/// position fractions. Any part of a span is bounded by the parallelogram of
+/// its own chord and sag vector, the same way as the entire span. The
+/// difference between points on two parts is bounded by the parallelepiped of
+/// both chords and the sag direction of one span, so its distance from the
+/// origin is a lower bound of the clearance. This is exact for parallel spans
+/// that sag in the same direction. Parts are split in half until every
+/// remaining pair has a lower bound within a length tolerance of the best
+/// distance found, and pairs that cannot beat the best distance of the query
+/// are skipped. The best distance is measured between points on the curves,
+/// so the clearance is never less than the true minimum, and is not more than
+/// the tolerance above it. Points and terrain segments are refined the same
+/// way, and are never split.
+class CableClearanceSolver {
+ public:
+  /// \brief Default constructor.
+  CableClearanceSolver();
+
+  /// \brief Destructor.
+  ~CableClearanceSolver();
+
+  /// \brief Gets the minimum clearance between two cables.
+  /// \param[in] index_cable
+  ///   The index of the cable.
+  /// \param[in] index_cable_other
+  ///   The index of the other cable.
+  /// \return The clearance solution. If the class does not update or the
+  ///   indexes are invalid, the default solution is returned.
+  ClearanceResult ClearanceCables(const int& index_cable,
+                                  const int& index_cable_other) const;
+
+  /// \brief Gets the clearance between a span and a point.
+  /// \param[in] span
+  ///   The span geometry.
+  /// \param[in] point
+  ///   The xyz point.
+  /// \return The clearance solution. The indexes are not modified.
+  static ClearanceResult ClearancePoint(const ClearanceSpanGeometry& span,
+                                        const Point3d<double>& point);
+
+  /// \brief Gets the minimum clearance between a cable and the terrain
+  ///   profile.
+  /// \param[in] index_cable
+  ///   The index of the cable.
+  /// \return The clearance solution. If the class does not update, the index
+  ///   is invalid, or the terrain profile has no segments, the default
+  ///   solution is returned.
+  ClearanceResult ClearanceTerrain(const int& index_cable) const;
+
+  /// \brief Gets an xyz point on a span.
+  /// \param[in] span
+  ///   The span geometry.
+  /// \param[in] position_fraction
+  ///   The position fraction along the span.
+  /// \return The xyz point.
+  static Point3d<double> PointSpan(const ClearanceSpanGeometry& span,
+                                   const double& position_fraction);
+
+  /// \brief Solves the geometry of a cable span.
+  /// \param[in] cable
+  ///   The cable.
+  /// \param[in] index_span
+  ///   The span index, which starts at the attachment point with the same
+  ///   index.
+  /// \param[out] span
+  ///   The span geometry.
+  /// \return If the span geometry solved successfully.
+  static bool SolveSpanGeometry(const ClearanceCable& cable,
+                                const int& index_span,
+                                ClearanceSpanGeometry* span);
+
+  /// \brief Validates member variables.
+  /// \param[in] is_included_warnings
+  ///   A flag that tightens the acceptable value range.
+  /// \param[in,out] messages
+  ///   A list of detailed error messages. If this is provided, any validation
+  ///   errors will be appended to the list.
+  /// \return A boolean value indicating status of member variables.
+  bool Validate(const bool& is_included_warnings = true,
+                std::list<ErrorMessage>* messages = nullptr) const;
+
+  /// \brief Gets the cables.
+  /// \return The cables.
+  const std::vector<ClearanceCable>* cables() const;
+
+  /// \brief Gets the terrain profile points.
+  /// \return The terrain profile points.
+  const std::vector<Point3d<double>>* points_terrain() const;
+
+  /// \brief Sets the cables.
+  /// \param[in] cables
+  ///   The cables.
+  void set_cables(const std::vector<ClearanceCable>* cables);
+
+  /// \brief Sets the terrain profile points.
+  /// \param[in] points_terrain
+  ///   The terrain profile xyz points, which are connected in order by
+  ///   straight segments. This is optional.
+  void set_points_terrain(const std::vector<Point3d<double>>* points_terrain);
+
+ private:
+  /// \brief Determines if class is updated.
+  /// \return A boolean indicating if class is updated.
+  bool IsUpdated() const;
+
+  /// \brief Refines the clearance between two spans.
+  /// \param[in] span
+  ///   The span geometry.
+  /// \param[in] span_other
+  ///   The other span geometry.
+  /// \param[in] distance_max
+  ///   The distance to beat.
+  /// \param[out] result
+  ///   The clearance solution. Only the distance and points are modified.
+  /// \return If a clearance closer than the maximum distance was found.
+  static bool RefineSpans(const ClearanceSpanGeometry& span,
+                          const ClearanceSpanGeometry& span_other,
+                          const double& distance_max,
+                          ClearanceResult* result);
+
+  /// \brief Refines the clearance between a span and a terrain segment.
+  /// \param[in] span
+  ///   The span geometry.
+  /// \param[in] point_start
+  ///   The start xyz point of the terrain segment.
+  /// \param[in] point_end
+  ///   The end xyz point of the terrain segment.
+  /// \param[in] distance_max
+  ///   The distance to beat.
+  /// \param[out] result
+  ///   The clearance solution. Only the distance and points are modified.
+  /// \return If a clearance closer than the maximum distance was found.
+  static bool RefineTerrain(const ClearanceSpanGeometry& span,
+                            const Point3d<double>& point_start,
+                            const Point3d<double>& point_end,
+                            const double& distance_max,
+                            ClearanceResult* result);
+
+  /// \brief Updates cached member variables and modifies control variables if
+  ///   update is required.
+  /// \return A boolean indicating if class updates completed successfully.
+  bool Update() const;
+
+  /// \brief Updates the span geometry and hierarchy for every cable.
+  /// \return The success status of the update.
+  bool UpdateSpans() const;
+
+  /// \brief Updates the terrain hierarchy.
+  /// \return The success status of the update.
+  bool UpdateTerrain() const;
+
+  /// \var cables_
+  ///   The cables.
+  const std::vector<ClearanceCable>* cables_;
+
+  /// \var hierarchies_cable_
+  ///   The span hierarchy for every cable.
+  mutable std::vector<BoundingVolumeHierarchy> hierarchies_cable_;
+
+  /// \var hierarchy_terrain_
+  ///   The terrain segment hierarchy.
+  mutable BoundingVolumeHierarchy hierarchy_terrain_;
+
+  /// \var is_updated_spans_
+  ///   An indicator that tells if the spans are updated.
+  mutable bool is_updated_spans_;
+
+  /// \var is_updated_terrain_
+  ///   An indicator that tells if the terrain is updated.
+  mutable bool is_updated_terrain_;
+
+  /// \var points_terrain_
+  ///   The terrain profile points.
+  const std::vector<Point3d<double>>* points_terrain_;
+
+  /// \var spans_
+  ///   The span geometry for every cable.
+  mutable std::vector<std::vector<ClearanceSpanGeometry>> spans_;
+};
+
+#endif  // MODELS_TRANSMISSIONLINE_CABLE_CLEARANCE_SOLVER_H_
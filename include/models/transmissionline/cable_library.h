@@ -0,0 +1,323 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_TRANSMISSIONLINE_CABLE_LIBRARY_H_
+#define MODELS_TRANSMISSIONLINE_CABLE_LIBRARY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "models/base/mapped_file.h"
+#include "models/transmissionline/cable.h"
+
+struct CableLibraryComponentRecord;
+struct CableLibraryRecord;
+
+/// \par OVERVIEW
+///
+/// This class is a read-only view of a cable component that is stored in a
+/// cable library. The values are read directly from the library file.
+class CableComponentView {
+ public:
+  /// \brief Default constructor.
+  CableComponentView();
+
+  /// \brief Alternate constructor.
+  /// \param[in] record
+  ///   The component record.
+  /// \param[in] coefficients
+  ///   The library coefficient array.
+  CableComponentView(const CableLibraryComponentRecord* record,
+                     const double* coefficients);
+
+  /// \brief Converts to a cable component.
+  /// \return A cable component with a copy of the values.
+  CableComponent ToCableComponent() const;
+
+  /// \brief Gets the thermal heat capacity.
+  /// \return The thermal heat capacity.
+  double capacity_heat() const;
+
+  /// \brief Gets the coefficient of linear thermal expansion.
+  /// \return The coefficient of linear thermal expansion.
+  double coefficient_expansion_linear_thermal() const;
+
+  /// \brief Gets the creep polynomial coefficients.
+  /// \return The creep polynomial coefficients.
+  const double* coefficients_polynomial_creep() const;
+
+  /// \brief Gets the load-strain polynomial coefficients.
+  /// \return The load-strain polynomial coefficients.
+  const double* coefficients_polynomial_loadstrain() const;
+
+  /// \brief Gets the creep polynomial load limit.
+  /// \return The creep polynomial load limit.
+  double load_limit_polynomial_creep() const;
+
+  /// \brief Gets the load-strain polynomial load limit.
+  /// \return The load-strain polynomial load limit.
+  double load_limit_polynomial_loadstrain() const;
+
+  /// \brief Gets the compression elastic area modulus.
+  /// \return The compression elastic area modulus.
+  double modulus_compression_elastic_area() const;
+
+  /// \brief Gets the tension elastic area modulus.
+  /// \return The tension elastic area modulus.
+  double modulus_tension_elastic_area() const;
+
+  /// \brief Gets the polynomial x scale.
+  /// \return The polynomial x scale.
+  double scale_polynomial_x() const;
+
+  /// \brief Gets the polynomial y scale.
+  /// \return The polynomial y scale.
+  double scale_polynomial_y() const;
+
+  /// \brief Gets the number of creep polynomial coefficients.
+  /// \return The number of creep polynomial coefficients.
+  int size_coefficients_polynomial_creep() const;
+
+  /// \brief Gets the number of load-strain polynomial coefficients.
+  /// \return The number of load-strain polynomial coefficients.
+  int size_coefficients_polynomial_loadstrain() const;
+
+ private:
+  /// \var coefficients_
+  ///   The library coefficient array.
+  const double* coefficients_;
+
+  /// \var record_
+  ///   The component record.
+  const CableLibraryComponentRecord* record_;
+};
+
+/// \par OVERVIEW
+///
+/// This class is a read-only view of a cable that is stored in a cable
+/// library. The values, name, and arrays are read directly from the library
+/// file.
+class CableView {
+ public:
+  /// \brief Default constructor.
+  CableView();
+
+  /// \brief Alternate constructor.
+  /// \param[in] record
+  ///   The cable record.
+  /// \param[in] strings
+  ///   The library string data.
+  /// \param[in] coefficients
+  ///   The library coefficient array.
+  /// \param[in] resistances
+  ///   The library resistance array.
+  CableView(const CableLibraryRecord* record,
+            const char* strings,
+            const double* coefficients,
+            const Cable::ResistancePoint* resistances);
+
+  /// \brief Converts to a cable.
+  /// \return A cable with a copy of the values.
+  Cable ToCable() const;
+
+  /// \brief Gets the absorptivity.
+  /// \return The absorptivity.
+  double absorptivity() const;
+
+  /// \brief Gets the physical cross-sectional area.
+  /// \return The physical cross-sectional area.
+  double area_physical() const;
+
+  /// \brief Gets the core component.
+  /// \return The core component.
+  CableComponentView component_core() const;
+
+  /// \brief Gets the shell component.
+  /// \return The shell component.
+  CableComponentView component_shell() const;
+
+  /// \brief Gets the diameter.
+  /// \return The diameter.
+  double diameter() const;
+
+  /// \brief Gets the emissivity.
+  /// \return The emissivity.
+  double emissivity() const;
+
+  /// \brief Gets the name.
+  /// \return The null-terminated name.
+  const char* name() const;
+
+  /// \brief Gets the AC resistance points.
+  /// \return The AC resistance points.
+  const Cable::ResistancePoint* resistances_ac() const;
+
+  /// \brief Gets the name length.
+  /// \return The name length, not including the null terminator.
+  int size_name() const;
+
+  /// \brief Gets the number of AC resistance points.
+  /// \return The number of AC resistance points.
+  int size_resistances_ac() const;
+
+  /// \brief Gets the rated strength.
+  /// \return The rated strength.
+  double strength_rated() const;
+
+  /// \brief Gets the temperature of the component properties.
+  /// \return The temperature of the component properties.
+  double temperature_properties_components() const;
+
+  /// \brief Gets the unit weight.
+  /// \return The unit weight.
+  double weight_unit() const;
+
+ private:
+  /// \var coefficients_
+  ///   The library coefficient array.
+  const double* coefficients_;
+
+  /// \var record_
+  ///   The cable record.
+  const CableLibraryRecord* record_;
+
+  /// \var resistances_
+  ///   The library resistance array.
+  const Cable::ResistancePoint* resistances_;
+
+  /// \var strings_
+  ///   The library string data.
+  const char* strings_;
+};
+
+/// \par OVERVIEW
+///
+/// This class is a read-only library of cables that is stored in a flat
+/// binary file.
+///
+/// \par FORMAT
+///
+/// The file is a header followed by sections of fixed-width records: the cable
+/// names, the cables, the polynomial coefficients, the AC resistance points,
+/// and a name hash table. The header contains a magic string, a format
+/// version, a byte order marker, the file size, and the byte offset and record
+/// count of every section. Records reference the other sections by index, so
+/// the file is position independent.
+///
+/// \par LOADING
+///
+/// The file is memory mapped read-only and stays mapped while the library is
+/// open, so a large catalog is only paged in as cables are accessed and is
+/// shared with other processes that open the same file. Every section and
+/// record range is checked once when the library is opened.
+///
+/// \par NAME LOOKUP
+///
+/// The hash table is built when the file is written, using an FNV-1a hash of
+/// the name and linear probing, so a cable can be found by name in constant
+/// time without building an index at load time. Cable names must be unique.
+///
+/// \par CABLE OBJECTS
+///
+/// Cable views read directly from the file. The other model classes reference
+/// cable objects, so a cable object can also be built from a library record.
+/// Each cable object is built once, when first requested, and stays at the
+/// same address until the library is closed. Building cable objects is not
+/// thread safe, but views can be read from multiple threads.
+class CableLibrary {
+ public:
+  /// \brief Default constructor.
+  CableLibrary();
+
+  /// \brief Destructor.
+  ~CableLibrary();
+
+  CableLibrary(const CableLibrary&) = delete;
+  CableLibrary& operator=(const CableLibrary&) = delete;
+
+  /// \brief Closes the library.
+  void Close();
+
+  /// \brief Gets a cable object.
+  /// \param[in] index
+  ///   The cable index.
+  /// \return The cable object. If the index is invalid, a nullptr is returned.
+  const Cable* CableObject(const int& index) const;
+
+  /// \brief Gets the index of a cable.
+  /// \param[in] name
+  ///   The cable name.
+  /// \return The cable index. If the cable is not found, -1 is returned.
+  int IndexCable(const std::string& name) const;
+
+  /// \brief Opens a library file.
+  /// \param[in] filepath
+  ///   The file path.
+  /// \return If the library opened successfully.
+  bool Open(const std::string& filepath);
+
+  /// \brief Writes cables to a library buffer.
+  /// \param[in] cables
+  ///   The cables.
+  /// \param[out] buffer
+  ///   The library data.
+  /// \return If the library was written successfully. Cables with duplicate
+  ///   names cannot be written.
+  static bool Serialize(const std::vector<Cable>& cables,
+                        std::vector<char>* buffer);
+
+  /// \brief Gets a cable view.
+  /// \param[in] index
+  ///   The cable index.
+  /// \return The cable view. If the index is invalid, a nullptr is returned.
+  const CableView* View(const int& index) const;
+
+  /// \brief Writes cables to a library file.
+  /// \param[in] cables
+  ///   The cables.
+  /// \param[in] filepath
+  ///   The file path.
+  /// \return If the library was written successfully.
+  static bool Write(const std::vector<Cable>& cables,
+                    const std::string& filepath);
+
+  /// \brief Gets the number of cables.
+  /// \return The number of cables.
+  int size() const;
+
+  /// \var kVersion
+  ///   The library format version.
+  static const int kVersion;
+
+ private:
+  /// \brief Validates the file and builds the cable views.
+  /// \return If the file is a valid library.
+  bool Initialize();
+
+  /// \var buckets_
+  ///   The name hash table. Each bucket contains the cable index plus one, or
+  ///   zero if the bucket is empty.
+  const std::uint32_t* buckets_;
+
+  /// \var cables_
+  ///   The cable objects that have been built. These are allocated separately
+  ///   so their addresses do not change.
+  mutable std::vector<std::unique_ptr<Cable>> cables_;
+
+  /// \var file_
+  ///   The mapped library file.
+  MappedFile file_;
+
+  /// \var size_buckets_
+  ///   The number of hash table buckets. This is a power of two.
+  std::uint32_t size_buckets_;
+
+  /// \var views_
+  ///   The cable views.
+  std::vector<CableView> views_;
+};
+
+#endif  // MODELS_TRANSMISSIONLINE_CABLE_LIBRARY_H_
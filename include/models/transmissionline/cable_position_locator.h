@@ -10,9 +10,24 @@
 #include "models/base/point.h"
 #include "models/base/vector.h"
 #include "models/transmissionline/catenary.h"
+#include "models/transmissionline/hardware.h"
 #include "models/transmissionline/line_cable.h"
 #include "models/transmissionline/transmission_line.h"
 
+/// \par OVERVIEW
+///
+/// This struct contains the structure geometry at each line cable connection.
+struct CableConnectionGeometry {
+ public:
+  /// \var hardwares
+  ///   The hardware assemblies at each connection.
+  std::vector<const Hardware*> hardwares;
+
+  /// \var points_structure
+  ///   The structure attachment points at each connection, in xyz coordinates.
+  std::vector<Point3d<double>> points_structure;
+};
+
 /// \par OVERVIEW
 ///
 /// This class solves for the position of a line cable.
@@ -34,6 +49,27 @@
 /// then be determined by combining the structure attachment point and the
 /// hardware spherical point.
 ///
+/// \par SOLVER TYPE
+///
+/// The hardware orientation can be solved using one of two methods:
+/// - Fixed Point: Each suspension hardware assembly is solved independently
+///   for the current cable attachment points, and then all cable attachment
+///   points are updated. This is repeated until the tension imbalance is
+///   within tolerance. Convergence slows down as the number of connections
+///   increases.
+/// - Newton: The hardware angle imbalances for all suspension connections are
+///   solved simultaneously. Each hardware angle only influences the adjacent
+///   connections, so the jacobian is a tridiagonal matrix that is assembled
+///   with finite differences and solved in linear time.
+///
+/// \par CONNECTION GEOMETRY
+///
+/// The structure attachment points and hardware are normally resolved from the
+/// transmission line every time the class updates. If the connection geometry
+/// is provided, it is used instead and the transmission line is not queried.
+/// This allows several locators to share geometry that is resolved once, and
+/// to run on separate threads.
+///
 /// \par CABLE POSITION
 ///
 /// Once the cable attachment points are determined, the cable position is
@@ -41,6 +77,15 @@
 /// assumed perpendicular to the catenary.
 class CablePositionLocator {
  public:
+  /// \par OVERVIEW
+  ///
+  /// This enum contains types of hardware orientation solvers.
+  enum class SolverType {
+    kNull,
+    kFixedPoint,
+    kNewton
+  };
+
   /// \brief Default constructor.
   CablePositionLocator();
 
@@ -61,6 +106,18 @@ class CablePositionLocator {
   ///   nullptr is returned.
   const std::vector<Point3d<double>>* PointsCableAttachment() const;
 
+  /// \brief Resolves the connection geometry for a line cable.
+  /// \param[in] line
+  ///   The transmission line.
+  /// \param[in] index_line_cable
+  ///   The line cable index.
+  /// \param[out] geometry
+  ///   The connection geometry.
+  /// \return If the connection geometry was resolved successfully.
+  static bool ResolveConnectionGeometry(const TransmissionLine& line,
+                                        const int& index_line_cable,
+                                        CableConnectionGeometry* geometry);
+
   /// \brief Validates member variables.
   /// \param[in] is_included_warnings
   ///   A flag that tightens the acceptable value range.
@@ -75,15 +132,31 @@ class CablePositionLocator {
   /// \return The direction of the wind.
   AxisDirectionType direction_wind() const;
 
+  /// \brief Gets the connection geometry.
+  /// \return The connection geometry.
+  const CableConnectionGeometry* geometry_connections() const;
+
   /// \brief Gets the line cable index.
   /// \return The line cable index.
   int index_line_cable() const;
 
+  /// \brief Gets the number of solver iterations.
+  /// \return The number of iterations used to solve the hardware orientation.
+  ///   If the class does not update, -1 is returned.
+  int iterations() const;
+
   /// \brief Sets the direction of the wind.
   /// \param[in] direction_wind
   ///   The direction of the wind.
   void set_direction_wind(const AxisDirectionType& direction_wind);
 
+  /// \brief Sets the connection geometry.
+  /// \param[in] geometry_connections
+  ///   The connection geometry. If this is a nullptr, the geometry is resolved
+  ///   from the transmission line.
+  void set_geometry_connections(
+      const CableConnectionGeometry* geometry_connections);
+
   /// \brief Sets the line cable index.
   /// \param[in] index_line_cable
   ///   The line cable index.
@@ -99,6 +172,11 @@ class CablePositionLocator {
   ///   The transmission line.
   void set_transmission_line(const TransmissionLine* line);
 
+  /// \brief Sets the solver type.
+  /// \param[in] type_solver
+  ///   The solver type.
+  void set_type_solver(const SolverType& type_solver);
+
   /// \brief Sets the unit weight.
   /// \param[in] weight_unit
   ///   The unit weight.
@@ -112,11 +190,24 @@ class CablePositionLocator {
   /// \return The transmission line.
   const TransmissionLine* transmission_line() const;
 
+  /// \brief Gets the solver type.
+  /// \return The solver type.
+  SolverType type_solver() const;
+
   /// \brief Gets the unit weight.
   /// \return The unit weight.
   const Vector3d* weight_unit() const;
 
  private:
+  /// \brief Gets the hardware equilibrium angle at a connection.
+  /// \param[in] index
+  ///   The connection index. This must be a suspension (interior) connection.
+  /// \param[out] tension_imbalance
+  ///   The tension imbalance for the current hardware angle.
+  /// \return The hardware z-axis angle that produces static equilibrium with
+  ///   the current cable attachment points.
+  double AngleEquilibrium(const int& index, double* tension_imbalance) const;
+
   /// \brief Updates the containers with connection data.
   /// \return The success status of the update.
   /// This will update the attachment points and hardware datasets.
@@ -136,15 +227,52 @@ class CablePositionLocator {
   /// \return A boolean indicating if class is updated.
   bool IsUpdated() const;
 
+  /// \brief Gets the hardware angle residuals.
+  /// \param[out] residuals
+  ///   The difference between the current and equilibrium hardware angle at
+  ///   each connection. The dead-end connections are set to zero.
+  /// \return The maximum tension imbalance.
+  /// The cable attachment points must be updated before calling this function.
+  double ResidualsHardware(std::vector<double>* residuals) const;
+
   /// \brief Solves for the cable position.
   /// \return If the cable position was solved for successfully.
   bool SolveCablePosition() const;
 
+  /// \brief Solves for the cable position using fixed point iteration.
+  /// \return If the cable position was solved for successfully.
+  bool SolveCablePositionFixedPoint() const;
+
+  /// \brief Solves for the cable position using newton iteration.
+  /// \return If the cable position was solved for successfully.
+  bool SolveCablePositionNewton() const;
+
+  /// \brief Solves a tridiagonal system of equations.
+  /// \param[in] lower
+  ///   The sub-diagonal. The first value is not used.
+  /// \param[in] diagonal
+  ///   The main diagonal.
+  /// \param[in] upper
+  ///   The super-diagonal. The last value is not used.
+  /// \param[in,out] values
+  ///   The right hand side values, which are replaced with the solution.
+  /// \return If the system was solved successfully.
+  /// This uses the Thomas algorithm, which does not pivot.
+  static bool SolveTridiagonal(const std::vector<double>& lower,
+                               const std::vector<double>& diagonal,
+                               const std::vector<double>& upper,
+                               std::vector<double>* values);
+
   /// \brief Updates cached member variables and modifies control variables if
   ///    update is required.
   /// \return A boolean indicating if class updates completed successfully.
   bool Update() const;
 
+  /// \brief Updates the cable position using fixed point iteration.
+  /// \return If the cable position was solved for successfully.
+  /// This continues from the current hardware points.
+  bool UpdateCablePositionFixedPoint() const;
+
   /// \brief Updates the cable xyz points.
   /// \return If the update completed successfully.
   bool UpdatePointsCable() const;
@@ -158,6 +286,10 @@ class CablePositionLocator {
   ///   indicates from right to left, while negative is the opposite.
   AxisDirectionType direction_wind_;
 
+  /// \var geometry_connections_
+  ///   The shared connection geometry. This is optional.
+  const CableConnectionGeometry* geometry_connections_;
+
   /// \var hardwares_
   ///   The hardware assemblies at each attachment/connection.
   mutable std::vector<const Hardware*> hardwares_;
@@ -171,6 +303,10 @@ class CablePositionLocator {
   ///   An indicator that tells if the class is updated or not.
   mutable bool is_updated_;
 
+  /// \var iterations_
+  ///   The number of iterations used to solve the hardware orientation.
+  mutable int iterations_;
+
   /// \var line_
   ///   The transmission line.
   const TransmissionLine* line_;
@@ -202,6 +338,10 @@ class CablePositionLocator {
   ///   The horizontal tension of the catenary/cable.
   double tension_horizontal_;
 
+  /// \var type_solver_
+  ///   The type of solver used for the hardware orientation.
+  SolverType type_solver_;
+
   /// \var weight_unit_
   ///   The unit weight of the cable. The x component is not used, the y
   ///   component is transverse weight, and z component is vertical weight.
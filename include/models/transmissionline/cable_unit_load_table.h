@@ -0,0 +1,104 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_TRANSMISSIONLINE_CABLE_UNIT_LOAD_TABLE_H_
+#define MODELS_TRANSMISSIONLINE_CABLE_UNIT_LOAD_TABLE_H_
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "models/base/vector.h"
+#include "models/transmissionline/weather_load_case.h"
+
+/// \par OVERVIEW
+///
+/// This class is a table of precomputed cable unit loads.
+///
+/// \par KEYS
+///
+/// Cables are keyed by diameter and unit weight, so cables with identical
+/// properties share a row. Weathercases are keyed by address, so the
+/// weathercases must not be modified or destroyed while they are in the table.
+///
+/// \par THREADING
+///
+/// The unit loads are solved when a cable or weathercase is added. Looking up
+/// a unit load does not modify the table, so a completed table can be shared
+/// by multiple solvers and threads.
+class CableUnitLoadTable {
+ public:
+  /// \brief Default constructor.
+  CableUnitLoadTable();
+
+  /// \brief Destructor.
+  ~CableUnitLoadTable();
+
+  /// \brief Adds a cable.
+  /// \param[in] diameter
+  ///   The diameter of the bare cable.
+  /// \param[in] weight_unit
+  ///   The unit weight of the bare cable.
+  /// \return The cable row index. If a cable with the same properties already
+  ///   exists, its index is returned.
+  int AddCable(const double& diameter, const double& weight_unit);
+
+  /// \brief Adds a weathercase.
+  /// \param[in] weathercase
+  ///   The weathercase.
+  /// \return The weathercase column index. If the weathercase already exists,
+  ///   its index is returned. If the weathercase is a nullptr, -1 is returned.
+  int AddWeathercase(const WeatherLoadCase* weathercase);
+
+  /// \brief Clears the table.
+  void Clear();
+
+  /// \brief Gets a unit load.
+  /// \param[in] diameter
+  ///   The diameter of the bare cable.
+  /// \param[in] weight_unit
+  ///   The unit weight of the bare cable.
+  /// \param[in] weathercase
+  ///   The weathercase.
+  /// \return The unit load, as defined by the cable unit load solver. If the
+  ///   cable or weathercase is not in the table, a nullptr is returned.
+  const Vector3d* UnitLoad(const double& diameter,
+                           const double& weight_unit,
+                           const WeatherLoadCase* weathercase) const;
+
+  /// \brief Gets the number of cable rows.
+  /// \return The number of cable rows.
+  int size_cables() const;
+
+  /// \brief Gets the number of weathercase columns.
+  /// \return The number of weathercase columns.
+  int size_weathercases() const;
+
+ private:
+  /// \brief Solves the unit load for a cable and weathercase.
+  /// \param[in] index_cable
+  ///   The cable row index.
+  /// \param[in] index_weathercase
+  ///   The weathercase column index.
+  /// \return The unit load.
+  Vector3d SolveUnitLoad(const int& index_cable,
+                         const int& index_weathercase) const;
+
+  /// \var cables_
+  ///   The diameter and unit weight of each cable row.
+  std::vector<std::pair<double, double>> cables_;
+
+  /// \var indexes_weathercase_
+  ///   The column index of each weathercase.
+  std::unordered_map<const WeatherLoadCase*, int> indexes_weathercase_;
+
+  /// \var loads_
+  ///   The unit loads, stored by cable row.
+  std::vector<std::vector<Vector3d>> loads_;
+
+  /// \var weathercases_
+  ///   The weathercase of each column.
+  std::vector<const WeatherLoadCase*> weathercases_;
+};
+
+#endif  // MODELS_TRANSMISSIONLINE_CABLE_UNIT_LOAD_TABLE_H_
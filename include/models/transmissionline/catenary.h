@@ -37,6 +37,12 @@
 ///
 /// The chord line is the straight line between end points. The chord line
 /// is used primarily for determining the sag of the catenary.
+///
+/// \par DERIVATIVES
+///
+/// The curve equations are implemented in the catenary namespace templates.
+/// Use those with dual numbers to get derivatives, such as the change in sag
+/// with respect to horizontal tension.
 class Catenary2d {
  public:
   /// \brief Default constructor.
@@ -120,6 +126,17 @@ class Catenary2d {
   double TangentAngle(const double& position_fraction,
                       const AxisDirectionType& direction) const;
 
+  /// \brief Gets the slope of the curve tangent line.
+  /// \param[in] position_fraction
+  ///   The position fraction.
+  /// \param[in] direction
+  ///   The x-axis direction of the tangent line.
+  /// \return The tangent slope, which is the tangent of the tangent angle.
+  /// This is solved directly from the catenary equation, and is preferred
+  /// over the tangent angle when the angle is only used for trigonometry.
+  double TangentSlope(const double& position_fraction,
+                      const AxisDirectionType& direction) const;
+
   /// \brief Gets a tangent unit vector.
   /// \param[in] position_fraction
   ///   The position fraction.
@@ -287,6 +304,50 @@ class Catenary2d {
   double weight_unit_;
 };
 
+/// \par OVERVIEW
+///
+/// This struct contains the projection between a 3D catenary and its 2D
+/// catenary plane.
+///
+/// A 2D catenary vector (x, y) is mapped to 3D by rotating (x, 0, y) in the xz
+/// plane by the spacing rotation, and then in the yz plane by the swing
+/// rotation.
+struct CatenaryProjection {
+ public:
+  /// \brief Default constructor.
+  CatenaryProjection();
+
+  /// \brief Destructor.
+  ~CatenaryProjection();
+
+  /// \var cos_rotation_spacing
+  ///   The cosine of the xz rotation from the 2D end point spacing to the 3D
+  ///   end point spacing.
+  double cos_rotation_spacing;
+
+  /// \var cos_rotation_swing
+  ///   The cosine of the swing angle.
+  double cos_rotation_swing;
+
+  /// \var sin_rotation_spacing
+  ///   The sine of the xz rotation from the 2D end point spacing to the 3D end
+  ///   point spacing.
+  double sin_rotation_spacing;
+
+  /// \var sin_rotation_swing
+  ///   The sine of the swing angle, which includes the transverse direction.
+  double sin_rotation_swing;
+
+  /// \var spacing_endpoints
+  ///   The 2D end point spacing, with horizontal (x) and vertical (y)
+  ///   components.
+  Vector2d spacing_endpoints;
+
+  /// \var weight_unit
+  ///   The 2D unit weight.
+  double weight_unit;
+};
+
 /// \par OVERVIEW
 ///
 /// This class models a catenary in 3D.
@@ -369,6 +430,11 @@ class Catenary3d {
   ///   of the catenary is parallel with the chord line.
   double PositionFractionSagPoint() const;
 
+  /// \brief Gets the projection between the 3D catenary and the 2D catenary.
+  /// \return The projection. If the class does not update, the default
+  ///   projection is returned.
+  CatenaryProjection Projection() const;
+
   /// \brief Gets the sag of the catenary.
   /// \return The distance between the chord line and the curve at the sag
   ///   point.
@@ -500,10 +566,31 @@ class Catenary3d {
   /// \return A boolean indicating the success status of the update.
   bool UpdateCatenary2d() const;
 
+  /// \brief Updates the rotations from the 2D catenary to the 3D catenary.
+  /// \return A boolean indicating the success status of the update.
+  bool UpdateRotations() const;
+
+  /// \brief Rotates a vector from the 2D catenary to the 3D catenary.
+  /// \param[in] vector_2d
+  ///   The 2D catenary vector.
+  /// \return The 3D catenary vector.
+  /// The vector is rotated in the xz plane from the 2D end point spacing to
+  /// the 3D end point spacing, and then in the yz plane by the swing angle.
+  Vector3d RotateTo3d(const Vector2d& vector_2d) const;
+
   /// \var catenary_2d_
   ///   A 2D catenary, with only vertical and horizontal axes.
   mutable Catenary2d  catenary_2d_;
 
+  /// \var cos_rotation_spacing_
+  ///   The cosine of the xz rotation from the 2D end point spacing to the 3D
+  ///   end point spacing.
+  mutable double cos_rotation_spacing_;
+
+  /// \var cos_rotation_swing_
+  ///   The cosine of the swing angle.
+  mutable double cos_rotation_swing_;
+
   /// \var direction_transverse_
   ///   The direction of the transverse load. This determines if the catenary
   ///   will be located negative/positive of the y-axis when transverse load
@@ -514,6 +601,19 @@ class Catenary3d {
   ///   An indicator that tells if the 2D catenary is updated.
   mutable bool is_updated_catenary_2d_;
 
+  /// \var is_updated_rotations_
+  ///   An indicator that tells if the rotations are updated.
+  mutable bool is_updated_rotations_;
+
+  /// \var sin_rotation_spacing_
+  ///   The sine of the xz rotation from the 2D end point spacing to the 3D end
+  ///   point spacing.
+  mutable double sin_rotation_spacing_;
+
+  /// \var sin_rotation_swing_
+  ///   The sine of the swing angle, for a positive transverse direction.
+  mutable double sin_rotation_swing_;
+
   /// \var spacing_endpoints_
   ///   The vector spacing between end points. The vector is defined in 3D to
   ///   align with the coordinate system, but only 2D spacing (y axis, z axis)
@@ -0,0 +1,187 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_TRANSMISSIONLINE_CATENARY_FUNCTIONS_H_
+#define MODELS_TRANSMISSIONLINE_CATENARY_FUNCTIONS_H_
+
+#include <cmath>
+
+/// \par OVERVIEW
+///
+/// This namespace contains the catenary curve equations. They are templated
+/// on the scalar type, so they can be evaluated with doubles or with dual
+/// numbers (see Dual) to get the values and derivatives in one evaluation.
+///
+/// The catenary classes use the double instantiations, so the results match
+/// the catenary classes exactly.
+///
+/// \par COORDINATE SYSTEM
+///
+/// The origin is at the low point of the catenary. The end point spacing is
+/// measured from the left end point to the right end point.
+///
+/// \par PARAMETERS
+///
+/// - h = horizontal tension
+/// - w = unit weight
+/// - a = horizontal spacing between end points
+/// - b = vertical spacing between end points
+namespace catenary {
+
+/// \brief Gets the x coordinate.
+/// \param[in] h
+///   The horizontal tension.
+/// \param[in] w
+///   The unit weight.
+/// \param[in] length_from_origin
+///   The curve length from the origin.
+/// \return The x coordinate.
+template <class T>
+T CoordinateX(const T& h, const T& w, const T& length_from_origin) {
+  using std::asinh;
+  return (h / w) * asinh(length_from_origin / (h / w));
+}
+
+/// \brief Gets the y coordinate.
+/// \param[in] h
+///   The horizontal tension.
+/// \param[in] w
+///   The unit weight.
+/// \param[in] x
+///   The x coordinate.
+/// \return The y coordinate.
+template <class T>
+T CoordinateY(const T& h, const T& w, const T& x) {
+  using std::cosh;
+  return (h / w) * (cosh(x / (h / w)) - 1);
+}
+
+/// \brief Gets the curve length from the origin.
+/// \param[in] h
+///   The horizontal tension.
+/// \param[in] w
+///   The unit weight.
+/// \param[in] x
+///   The x coordinate.
+/// \return The curve length from the origin. This is negative for coordinates
+///   left of the origin.
+template <class T>
+T LengthFromOrigin(const T& h, const T& w, const T& x) {
+  using std::sinh;
+  return (h / w) * sinh(x / (h / w));
+}
+
+/// \brief Gets the left end point x coordinate (Ehrenburg).
+/// \param[in] h
+///   The horizontal tension.
+/// \param[in] w
+///   The unit weight.
+/// \param[in] a
+///   The horizontal end point spacing.
+/// \param[in] b
+///   The vertical end point spacing.
+/// \return The left end point x coordinate.
+template <class T>
+T PointEndLeftX(const T& h, const T& w, const T& a, const T& b) {
+  using std::asinh;
+  using std::sinh;
+  const T z = (a / 2) / (h / w);
+  return (h / w) * (asinh((b * z) / (a * sinh(z))) - z);
+}
+
+/// \brief Gets the right end point x coordinate (Ehrenburg).
+/// \param[in] h
+///   The horizontal tension.
+/// \param[in] w
+///   The unit weight.
+/// \param[in] a
+///   The horizontal end point spacing.
+/// \param[in] b
+///   The vertical end point spacing.
+/// \return The right end point x coordinate.
+template <class T>
+T PointEndRightX(const T& h, const T& w, const T& a, const T& b) {
+  using std::asinh;
+  using std::sinh;
+  const T z = (a / 2) / (h / w);
+  return (h / w) * (asinh((b * z) / (a * sinh(z))) + z);
+}
+
+/// \brief Gets the curve length between end points.
+/// \param[in] h
+///   The horizontal tension.
+/// \param[in] w
+///   The unit weight.
+/// \param[in] a
+///   The horizontal end point spacing.
+/// \param[in] b
+///   The vertical end point spacing.
+/// \return The curve length.
+template <class T>
+T Length(const T& h, const T& w, const T& a, const T& b) {
+  return LengthFromOrigin(h, w, PointEndRightX(h, w, a, b))
+         - LengthFromOrigin(h, w, PointEndLeftX(h, w, a, b));
+}
+
+/// \brief Gets the sag, which is the maximum vertical distance between the
+///   chord and the curve.
+/// \param[in] h
+///   The horizontal tension.
+/// \param[in] w
+///   The unit weight.
+/// \param[in] a
+///   The horizontal end point spacing.
+/// \param[in] b
+///   The vertical end point spacing.
+/// \return The sag.
+template <class T>
+T Sag(const T& h, const T& w, const T& a, const T& b) {
+  using std::asinh;
+
+  // the sag point is where the curve slope equals the chord slope
+  const T slope_chord = b / a;
+  const T x = (h / w) * asinh(slope_chord);
+
+  // gets the chord and curve y coordinates at the sag point
+  const T x_left = PointEndLeftX(h, w, a, b);
+  const T y_chord = CoordinateY(h, w, x_left) + (x - x_left) * slope_chord;
+
+  return y_chord - CoordinateY(h, w, x);
+}
+
+/// \brief Gets the tension.
+/// \param[in] h
+///   The horizontal tension.
+/// \param[in] w
+///   The unit weight.
+/// \param[in] x
+///   The x coordinate.
+/// \return The tension.
+template <class T>
+T Tension(const T& h, const T& w, const T& x) {
+  using std::cosh;
+  return h * cosh(x / (h / w));
+}
+
+/// \brief Gets the maximum tension, which occurs at the highest end point.
+/// \param[in] h
+///   The horizontal tension.
+/// \param[in] w
+///   The unit weight.
+/// \param[in] a
+///   The horizontal end point spacing.
+/// \param[in] b
+///   The vertical end point spacing.
+/// \return The maximum tension.
+template <class T>
+T TensionMax(const T& h, const T& w, const T& a, const T& b) {
+  if (b <= 0) {
+    return Tension(h, w, PointEndLeftX(h, w, a, b));
+  } else {
+    return Tension(h, w, PointEndRightX(h, w, a, b));
+  }
+}
+
+}  // namespace catenary
+
+#endif  // MODELS_TRANSMISSIONLINE_CATENARY_FUNCTIONS_H_
@@ -0,0 +1,184 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_TRANSMISSIONLINE_CATENARY_SAMPLER_H_
+#define MODELS_TRANSMISSIONLINE_CATENARY_SAMPLER_H_
+
+#include <cmath>
+#include <list>
+
+#include "models/base/error_message.h"
+#include "models/base/point.h"
+#include "models/transmissionline/catenary.h"
+
+/// \par OVERVIEW
+///
+/// This class generates evenly spaced points along a catenary, for bulk point
+/// generation such as rendering and clearance pre-screening.
+///
+/// \par COORDINATE SYSTEM
+///
+/// The points use the Catenary3d coordinate system, so the origin is the left
+/// catenary end point. The points match Catenary3d::Coordinate at evenly
+/// spaced position fractions, from 0 to 1.
+///
+/// \par MAPPING
+///
+/// The span mapping is solved once in double precision when the catenary is
+/// set. Each 3D point is the rotated chord point plus the rotated offset from
+/// the chord, and both rotations are constant, so
+///   point = s * q + offset * n
+/// where s is the 2D x distance from the left end point, and q and n are
+/// constant vectors. Generating a point only requires one square root, one
+/// asinh, and two sinh evaluations.
+///
+/// \par PRECISION
+///
+/// The points can be generated as double or float. The float points are
+/// solved with float arithmetic, which halves the memory of the output and
+/// doubles the vector width of the point loop. The float point error is
+/// bounded by approximately:
+///   2e-7 * (|catenary constant| + length)
+/// This is about 1 mm for a 1500 ft span with a catenary constant of 5000 ft.
+/// The points are relative to the left end point, so large global coordinates
+/// should be added in double precision.
+class CatenarySampler {
+ public:
+  /// \brief Default constructor.
+  CatenarySampler();
+
+  /// \brief Destructor.
+  ~CatenarySampler();
+
+  /// \brief Gets evenly spaced points along the catenary.
+  /// \param[in] num
+  ///   The number of points, which must be 2 or greater.
+  /// \param[out] points
+  ///   The points, which must have room for the number of points.
+  /// \return If the points were generated.
+  template <class T>
+  bool Points(const int& num, Point3d<T>* points) const;
+
+  /// \brief Validates member variables.
+  /// \param[in] is_included_warnings
+  ///   A flag that tightens the acceptable value range.
+  /// \param[in,out] messages
+  ///   A list of detailed error messages. If this is provided, any validation
+  ///   errors will be appended to the list.
+  /// \return A boolean value indicating status of member variables.
+  bool Validate(const bool& is_included_warnings = true,
+                std::list<ErrorMessage>* messages = nullptr) const;
+
+  /// \brief Gets the catenary.
+  /// \return The catenary.
+  Catenary3d catenary() const;
+
+  /// \brief Sets the catenary.
+  /// \param[in] catenary
+  ///   The catenary.
+  void set_catenary(const Catenary3d& catenary);
+
+ private:
+  /// \brief Determines if class is updated.
+  /// \return A boolean indicating if class is updated.
+  bool IsUpdated() const;
+
+  /// \brief Updates cached member variables and modifies control variables if
+  ///   update is required.
+  /// \return A boolean indicating if class updates completed successfully.
+  bool Update() const;
+
+  /// \var catenary_
+  ///   The catenary.
+  Catenary3d catenary_;
+
+  /// \var constant_
+  ///   The catenary constant.
+  mutable double constant_;
+
+  /// \var cosh_left_
+  ///   The hyperbolic cosine of the left end point x coordinate divided by the
+  ///   catenary constant.
+  mutable double cosh_left_;
+
+  /// \var is_updated_
+  ///   An indicator that tells if the class is updated.
+  mutable bool is_updated_;
+
+  /// \var length_
+  ///   The catenary length.
+  mutable double length_;
+
+  /// \var n_
+  ///   The 3D direction of the 2D vertical offset from the chord.
+  mutable double n_[3];
+
+  /// \var q_
+  ///   The 3D chord point per unit 2D x distance.
+  mutable double q_[3];
+
+  /// \var sinh_left_
+  ///   The hyperbolic sine of the left end point x coordinate divided by the
+  ///   catenary constant.
+  mutable double sinh_left_;
+
+  /// \var slope_chord_
+  ///   The 2D chord slope.
+  mutable double slope_chord_;
+
+  /// \var u_left_
+  ///   The left end point x coordinate divided by the catenary constant.
+  mutable double u_left_;
+};
+
+/// The x distance is solved from the hyperbolic sine difference identity, and
+/// the chord offset is solved with the product form of the hyperbolic cosine
+/// difference. Neither subtracts nearly equal values, which keeps the float
+/// error from growing near the end points.
+template <class T>
+bool CatenarySampler::Points(const int& num, Point3d<T>* points) const {
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return false;
+  }
+
+  if (num < 2) {
+    return false;
+  }
+
+  // converts the mapping to the point type
+  const T c = static_cast<T>(constant_);
+  const T cosh_left = static_cast<T>(cosh_left_);
+  const T increment = static_cast<T>(length_ / (num - 1));
+  const T k = static_cast<T>(slope_chord_);
+  const T sinh_left = static_cast<T>(sinh_left_);
+  const T u_left = static_cast<T>(u_left_);
+  const T n[3] = {static_cast<T>(n_[0]), static_cast<T>(n_[1]),
+                  static_cast<T>(n_[2])};
+  const T q[3] = {static_cast<T>(q_[0]), static_cast<T>(q_[1]),
+                  static_cast<T>(q_[2])};
+
+  for (int i = 0; i < num; i++) {
+    // gets the 2D x distance and chord offset from the curve length
+    const T d = (static_cast<T>(i) * increment) / c;
+    const T sinh_position = sinh_left + d;
+    const T cosh_position = std::sqrt(1 + (sinh_position * sinh_position));
+    const T du = std::asinh(
+        d * (cosh_left - ((sinh_left * (sinh_position + sinh_left))
+                          / (cosh_left + cosh_position))));
+    const T s = c * du;
+    const T offset = (2 * c * std::sinh(u_left + (du / 2))
+                      * std::sinh(du / 2))
+                     - (s * k);
+
+    // maps to 3D
+    Point3d<T>& point = points[i];
+    point.x = (s * q[0]) + (offset * n[0]);
+    point.y = (s * q[1]) + (offset * n[1]);
+    point.z = (s * q[2]) + (offset * n[2]);
+  }
+
+  return true;
+}
+
+#endif  // MODELS_TRANSMISSIONLINE_CATENARY_SAMPLER_H_
@@ -5,6 +5,7 @@
 #define MODELS_TRANSMISSIONLINE_LINE_CABLE_H_
 
 #include <list>
+#include <vector>
 
 #include "models/base/error_message.h"
 #include "models/base/vector.h"
@@ -103,7 +104,7 @@ class LineCable {
 
   /// \brief Gets the connections.
   /// \return The connections.
-  const std::list<LineCableConnection>* connections() const;
+  const std::vector<LineCableConnection>* connections() const;
 
   /// \brief Gets the constraint.
   /// \return The constraint.
@@ -160,7 +161,7 @@ class LineCable {
 
   /// \var connections_
   ///   The connections, sorted by line structure station.
-  std::list<LineCableConnection> connections_;
+  std::vector<LineCableConnection> connections_;
 
   /// \var constraint_
   ///   The constraint the cable is tensioned to.
@@ -0,0 +1,198 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_TRANSMISSIONLINE_MULTI_CABLE_POSITION_LOCATOR_H_
+#define MODELS_TRANSMISSIONLINE_MULTI_CABLE_POSITION_LOCATOR_H_
+
+#include <list>
+#include <vector>
+
+#include "models/base/error_message.h"
+#include "models/base/point.h"
+#include "models/base/thread_pool.h"
+#include "models/base/vector.h"
+#include "models/transmissionline/cable_position_locator.h"
+#include "models/transmissionline/transmission_line.h"
+
+/// \par OVERVIEW
+///
+/// This struct contains the cable loading for a cable position solution.
+struct CablePositionLoadState {
+ public:
+  /// \brief Default constructor.
+  CablePositionLoadState() {
+    direction_wind = AxisDirectionType::kNull;
+    tension_horizontal = -999999;
+  }
+
+  /// \var direction_wind
+  ///   The wind axis direction, relative to the ahead alignment path.
+  AxisDirectionType direction_wind;
+
+  /// \var tension_horizontal
+  ///   The horizontal tension of the cable.
+  double tension_horizontal;
+
+  /// \var weight_unit
+  ///   The unit weight of the cable. The x component is not used, the y
+  ///   component is transverse weight, and z component is vertical weight.
+  Vector3d weight_unit;
+};
+
+/// \par OVERVIEW
+///
+/// This class solves for the position of multiple line cables for multiple
+/// load states.
+///
+/// \par CONNECTION GEOMETRY
+///
+/// The connection geometry for each line cable is resolved from the
+/// transmission line once per update, on the calling thread. The geometry is
+/// then shared read-only by every load state solution for that line cable.
+///
+/// \par THREADING
+///
+/// Every line cable and load state combination is solved as an independent
+/// task. If a thread pool is provided, the tasks are executed on it. Otherwise
+/// the tasks are executed serially on the calling thread.
+///
+/// \par INDEXING
+///
+/// The solutions are indexed by the position in the line cable index vector
+/// and the position in the load state vector.
+class MultiCablePositionLocator {
+ public:
+  /// \brief Default constructor.
+  MultiCablePositionLocator();
+
+  /// \brief Destructor.
+  ~MultiCablePositionLocator();
+
+  /// \brief Gets the cable attachment xyz points.
+  /// \param[in] index_cable
+  ///   The position in the line cable index vector.
+  /// \param[in] index_state
+  ///   The position in the load state vector.
+  /// \return The cable attachment points. If the class does not update, the
+  ///   indexes are invalid, or the cable position did not solve, a nullptr is
+  ///   returned.
+  const std::vector<Point3d<double>>* PointsCableAttachment(
+      const int& index_cable,
+      const int& index_state) const;
+
+  /// \brief Validates member variables.
+  /// \param[in] is_included_warnings
+  ///   A flag that tightens the acceptable value range.
+  /// \param[in,out] messages
+  ///   A list of detailed error messages. If this is provided, any validation
+  ///   errors will be appended to the list.
+  /// \return A boolean value indicating status of member variables.
+  bool Validate(const bool& is_included_warnings = true,
+                std::list<ErrorMessage>* messages = nullptr) const;
+
+  /// \brief Gets the line cable indexes.
+  /// \return The line cable indexes.
+  const std::vector<int>* indexes_line_cable() const;
+
+  /// \brief Gets the load states.
+  /// \return The load states.
+  const std::vector<CablePositionLoadState>* load_states() const;
+
+  /// \brief Sets the line cable indexes.
+  /// \param[in] indexes_line_cable
+  ///   The line cable indexes.
+  void set_indexes_line_cable(const std::vector<int>* indexes_line_cable);
+
+  /// \brief Sets the load states.
+  /// \param[in] load_states
+  ///   The load states.
+  void set_load_states(const std::vector<CablePositionLoadState>* load_states);
+
+  /// \brief Sets the thread pool.
+  /// \param[in] pool
+  ///   The thread pool. This is optional.
+  void set_thread_pool(ThreadPool* pool);
+
+  /// \brief Sets the transmission line.
+  /// \param[in] line
+  ///   The transmission line.
+  void set_transmission_line(const TransmissionLine* line);
+
+  /// \brief Sets the solver type.
+  /// \param[in] type_solver
+  ///   The solver type.
+  void set_type_solver(const CablePositionLocator::SolverType& type_solver);
+
+  /// \brief Gets the thread pool.
+  /// \return The thread pool.
+  ThreadPool* thread_pool() const;
+
+  /// \brief Gets the transmission line.
+  /// \return The transmission line.
+  const TransmissionLine* transmission_line() const;
+
+  /// \brief Gets the solver type.
+  /// \return The solver type.
+  CablePositionLocator::SolverType type_solver() const;
+
+ private:
+  /// \brief Determines if class is updated.
+  /// \return A boolean indicating if class is updated.
+  bool IsUpdated() const;
+
+  /// \brief Updates cached member variables and modifies control variables if
+  ///    update is required.
+  /// \return A boolean indicating if class updates completed successfully.
+  bool Update() const;
+
+  /// \brief Updates the connection geometry for every line cable.
+  /// \return If the update completed successfully.
+  bool UpdateGeometries() const;
+
+  /// \brief Updates the cable attachment points for every line cable and load
+  ///   state.
+  /// \return If the update completed successfully.
+  bool UpdatePointsCableAttachment() const;
+
+  /// \var geometries_
+  ///   The connection geometry for each line cable.
+  mutable std::vector<CableConnectionGeometry> geometries_;
+
+  /// \var indexes_cable_
+  ///   The indexes of the line cables. The line cables are owned by the
+  ///   transmission line.
+  const std::vector<int>* indexes_cable_;
+
+  /// \var is_solved_
+  ///   An indicator for each solution that tells if the cable position solved.
+  ///   This uses char instead of bool so that tasks can write to separate
+  ///   elements at the same time.
+  mutable std::vector<char> is_solved_;
+
+  /// \var is_updated_
+  ///   An indicator that tells if the class is updated or not.
+  mutable bool is_updated_;
+
+  /// \var line_
+  ///   The transmission line.
+  const TransmissionLine* line_;
+
+  /// \var load_states_
+  ///   The load states.
+  const std::vector<CablePositionLoadState>* load_states_;
+
+  /// \var points_cable_
+  ///   The cable attachment points for each solution. The solutions are stored
+  ///   by line cable, and then by load state.
+  mutable std::vector<std::vector<Point3d<double>>> points_cable_;
+
+  /// \var pool_
+  ///   The thread pool that executes the solutions.
+  ThreadPool* pool_;
+
+  /// \var type_solver_
+  ///   The type of solver used for the hardware orientation.
+  CablePositionLocator::SolverType type_solver_;
+};
+
+#endif  // MODELS_TRANSMISSIONLINE_MULTI_CABLE_POSITION_LOCATOR_H_
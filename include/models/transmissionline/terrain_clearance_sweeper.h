@@ -0,0 +1,265 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_TRANSMISSIONLINE_TERRAIN_CLEARANCE_SWEEPER_H_
+#define MODELS_TRANSMISSIONLINE_TERRAIN_CLEARANCE_SWEEPER_H_
+
+#include <list>
+#include <vector>
+
+#include "models/base/error_message.h"
+#include "models/base/point.h"
+#include "models/base/thread_pool.h"
+#include "models/transmissionline/cable_clearance_solver.h"
+#include "models/transmissionline/multi_cable_position_locator.h"
+#include "models/transmissionline/terrain_profile.h"
+#include "models/transmissionline/transmission_line.h"
+
+/// \par OVERVIEW
+///
+/// This struct contains the minimum terrain clearance of a span.
+struct TerrainClearance {
+ public:
+  /// \brief Default constructor.
+  TerrainClearance() {
+    distance_radial = -999999;
+    distance_vertical = -999999;
+    index_point_radial = -1;
+    index_point_vertical = -1;
+  }
+
+  /// \var distance_radial
+  ///   The minimum straight line distance between the cable and a terrain
+  ///   point.
+  double distance_radial;
+
+  /// \var distance_vertical
+  ///   The minimum vertical distance between the cable and a terrain point
+  ///   beneath it.
+  double distance_vertical;
+
+  /// \var index_point_radial
+  ///   The index of the terrain point that controls the radial clearance.
+  int index_point_radial;
+
+  /// \var index_point_vertical
+  ///   The index of the terrain point that controls the vertical clearance.
+  int index_point_vertical;
+};
+
+/// \par OVERVIEW
+///
+/// This class sweeps a terrain profile for the minimum ground clearance of
+/// multiple line cables for multiple load states.
+///
+/// \par CABLE POSITION
+///
+/// The cable attachment points are solved with a MultiCablePositionLocator,
+/// which shares the thread pool, line cable indexes, and load states.
+///
+/// \par SPAN BUCKETS
+///
+/// Each span only tests the terrain points with a station between the back
+/// and ahead line structures of the span. The terrain points are sorted by
+/// station, so the points for each span are a contiguous range that is found
+/// with a binary search. The ranges are found once per update and shared by
+/// every load state.
+///
+/// \par CLEARANCE
+///
+/// The vertical clearance is only measured for terrain points beneath the
+/// cable. The cable point at the same position along the span is solved, and
+/// the terrain point is beneath the cable if the horizontal distance between
+/// them is within the horizontal tolerance. The tolerance should be about
+/// half the terrain point spacing. The radial clearance is the straight
+/// line distance to the closest point on the cable. The radial search is
+/// skipped for terrain points whose distance to the span bounding box is not
+/// less than the best radial clearance found so far.
+///
+/// \par THREADING
+///
+/// Every line cable and load state combination is swept as an independent
+/// task. If a thread pool is provided, the tasks are executed on it. Otherwise
+/// the tasks are executed serially on the calling thread.
+///
+/// \par INDEXING
+///
+/// The solutions are indexed by the position in the line cable index vector
+/// and the position in the load state vector. The terrain point indexes match
+/// the sorted terrain profile points.
+class TerrainClearanceSweeper {
+ public:
+  /// \brief Default constructor.
+  TerrainClearanceSweeper();
+
+  /// \brief Destructor.
+  ~TerrainClearanceSweeper();
+
+  /// \brief Gets the terrain clearance of every span.
+  /// \param[in] index_cable
+  ///   The position in the line cable index vector.
+  /// \param[in] index_state
+  ///   The position in the load state vector.
+  /// \return The terrain clearance of every span. If a span has no terrain
+  ///   points beneath it, the vertical clearance is the default value. If the class
+  ///   does not update, the indexes are invalid, or the sweep did not solve,
+  ///   a nullptr is returned.
+  const std::vector<TerrainClearance>* Clearances(
+      const int& index_cable,
+      const int& index_state) const;
+
+  /// \brief Validates member variables.
+  /// \param[in] is_included_warnings
+  ///   A flag that tightens the acceptable value range.
+  /// \param[in,out] messages
+  ///   A list of detailed error messages. If this is provided, any validation
+  ///   errors will be appended to the list.
+  /// \return A boolean value indicating status of member variables.
+  bool Validate(const bool& is_included_warnings = true,
+                std::list<ErrorMessage>* messages = nullptr) const;
+
+  /// \brief Gets the line cable indexes.
+  /// \return The line cable indexes.
+  const std::vector<int>* indexes_line_cable() const;
+
+  /// \brief Gets the load states.
+  /// \return The load states.
+  const std::vector<CablePositionLoadState>* load_states() const;
+
+  /// \brief Sets the line cable indexes.
+  /// \param[in] indexes_line_cable
+  ///   The line cable indexes.
+  void set_indexes_line_cable(const std::vector<int>* indexes_line_cable);
+
+  /// \brief Sets the load states.
+  /// \param[in] load_states
+  ///   The load states.
+  void set_load_states(const std::vector<CablePositionLoadState>* load_states);
+
+  /// \brief Sets the terrain profile.
+  /// \param[in] terrain
+  ///   The terrain profile.
+  void set_terrain_profile(const TerrainProfile* terrain);
+
+  /// \brief Sets the thread pool.
+  /// \param[in] pool
+  ///   The thread pool. This is optional.
+  void set_thread_pool(ThreadPool* pool);
+
+  /// \brief Sets the horizontal tolerance for the vertical clearance.
+  /// \param[in] tolerance_horizontal
+  ///   The maximum horizontal distance between a terrain point and the cable
+  ///   for the vertical clearance.
+  void set_tolerance_horizontal(const double& tolerance_horizontal);
+
+  /// \brief Sets the transmission line.
+  /// \param[in] line
+  ///   The transmission line.
+  void set_transmission_line(const TransmissionLine* line);
+
+  /// \brief Gets the terrain profile.
+  /// \return The terrain profile.
+  const TerrainProfile* terrain_profile() const;
+
+  /// \brief Gets the thread pool.
+  /// \return The thread pool.
+  ThreadPool* thread_pool() const;
+
+  /// \brief Gets the horizontal tolerance for the vertical clearance.
+  /// \return The horizontal tolerance for the vertical clearance.
+  double tolerance_horizontal() const;
+
+  /// \brief Gets the transmission line.
+  /// \return The transmission line.
+  const TransmissionLine* transmission_line() const;
+
+ private:
+  /// \brief Determines if class is updated.
+  /// \return A boolean indicating if class is updated.
+  bool IsUpdated() const;
+
+  /// \brief Sweeps the terrain points beneath a span.
+  /// \param[in] span
+  ///   The span geometry.
+  /// \param[in] index_begin
+  ///   The first terrain point index.
+  /// \param[in] index_end
+  ///   The terrain point index after the last point.
+  /// \return The terrain clearance of the span.
+  TerrainClearance SweepSpan(const ClearanceSpanGeometry& span,
+                             const int& index_begin,
+                             const int& index_end) const;
+
+  /// \brief Updates cached member variables and modifies control variables if
+  ///    update is required.
+  /// \return A boolean indicating if class updates completed successfully.
+  bool Update() const;
+
+  /// \brief Updates the clearances for every line cable and load state.
+  /// \return If the update completed successfully.
+  bool UpdateClearances() const;
+
+  /// \brief Updates the terrain point range beneath every span.
+  /// \return If the update completed successfully.
+  bool UpdateIndexesPointSpan() const;
+
+  /// \brief Updates the terrain xyz points.
+  /// \return If the update completed successfully.
+  bool UpdatePointsTerrain() const;
+
+  /// \var clearances_
+  ///   The span clearances for each solution. The solutions are stored by line
+  ///   cable, and then by load state.
+  mutable std::vector<std::vector<TerrainClearance>> clearances_;
+
+  /// \var indexes_cable_
+  ///   The indexes of the line cables. The line cables are owned by the
+  ///   transmission line.
+  const std::vector<int>* indexes_cable_;
+
+  /// \var indexes_point_span_
+  ///   The terrain point range of every span for each line cable. Each span
+  ///   stores the first point index, and then the index after the last point.
+  mutable std::vector<std::vector<int>> indexes_point_span_;
+
+  /// \var is_solved_
+  ///   An indicator for each solution that tells if the sweep solved. This
+  ///   uses char instead of bool so that tasks can write to separate elements
+  ///   at the same time.
+  mutable std::vector<char> is_solved_;
+
+  /// \var is_updated_
+  ///   An indicator that tells if the class is updated or not.
+  mutable bool is_updated_;
+
+  /// \var line_
+  ///   The transmission line.
+  const TransmissionLine* line_;
+
+  /// \var load_states_
+  ///   The load states.
+  const std::vector<CablePositionLoadState>* load_states_;
+
+  /// \var locator_
+  ///   The cable position locator.
+  MultiCablePositionLocator locator_;
+
+  /// \var points_terrain_
+  ///   The terrain xyz points, matching the sorted terrain profile points.
+  mutable std::vector<Point3d<double>> points_terrain_;
+
+  /// \var pool_
+  ///   The thread pool that executes the sweeps.
+  ThreadPool* pool_;
+
+  /// \var terrain_
+  ///   The terrain profile.
+  const TerrainProfile* terrain_;
+
+  /// \var tolerance_horizontal_
+  ///   The maximum horizontal distance between a terrain point and the cable
+  ///   for the vertical clearance.
+  double tolerance_horizontal_;
+};
+
+#endif  // MODELS_TRANSMISSIONLINE_TERRAIN_CLEARANCE_SWEEPER_H_
@@ -0,0 +1,151 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_TRANSMISSIONLINE_TERRAIN_PROFILE_H_
+#define MODELS_TRANSMISSIONLINE_TERRAIN_PROFILE_H_
+
+#include <list>
+#include <vector>
+
+#include "models/base/error_message.h"
+#include "models/base/point.h"
+#include "models/transmissionline/alignment.h"
+#include "models/transmissionline/transmission_line.h"
+
+/// \par OVERVIEW
+///
+/// This struct is a container for a terrain point, which is positioned
+/// relative to the alignment.
+struct TerrainPoint {
+ public:
+  /// \brief Default constructor.
+  TerrainPoint();
+
+  /// \brief Destructor.
+  ~TerrainPoint();
+
+  /// \brief Validates member variables.
+  /// \param[in] is_included_warnings
+  ///   A flag that tightens the acceptable value range.
+  /// \param[in,out] messages
+  ///   A list of detailed error messages. If this is provided, any validation
+  ///   errors will be appended to the list.
+  /// \return A boolean value indicating status of member variables.
+  bool Validate(const bool& is_included_warnings = true,
+                std::list<ErrorMessage>* messages = nullptr) const;
+
+  /// \var elevation
+  ///   The ground elevation, which uses the same datum as the alignment point
+  ///   elevations.
+  double elevation;
+
+  /// \var offset
+  ///   The horizontal distance from the alignment, perpendicular to the
+  ///   alignment path. This follows the line structure offset convention.
+  double offset;
+
+  /// \var station
+  ///   The alignment position (x-y plane only).
+  double station;
+};
+
+/// \par OVERVIEW
+///
+/// This class is a terrain profile, which is a set of ground points along the
+/// alignment, such as a LiDAR survey.
+///
+/// \par STREAMING INPUT
+///
+/// Points are appended without searching or inserting, so large surveys can be
+/// added one point at a time. Surveys are normally ordered by station, and the
+/// points stay sorted if each station is at or ahead of the previous one. If a
+/// point is added out of order, the points are sorted once before the next
+/// query.
+///
+/// \par STATION LOOKUP
+///
+/// The point stations are stored in a sorted array, so the points beneath a
+/// station range are found with a binary search. The alignment segment of
+/// every point is resolved with a single pass over the alignment, using the
+/// alignment segment rules.
+class TerrainProfile {
+ public:
+  /// \brief Default constructor.
+  TerrainProfile();
+
+  /// \brief Destructor.
+  ~TerrainProfile();
+
+  /// \brief Adds a terrain point.
+  /// \param[in] point
+  ///   The terrain point.
+  void AddPoint(const TerrainPoint& point);
+
+  /// \brief Adds multiple terrain points.
+  /// \param[in] points
+  ///   The terrain points.
+  void AddPoints(const std::vector<TerrainPoint>& points);
+
+  /// \brief Clears all terrain points.
+  void Clear();
+
+  /// \brief Gets the index of the first point at or ahead of a station.
+  /// \param[in] station
+  ///   The station.
+  /// \return The point index. If all points are behind the station, the
+  ///   number of points is returned.
+  int IndexPoint(const double& station) const;
+
+  /// \brief Gets the alignment segment index of every point.
+  /// \param[in] alignment
+  ///   The alignment.
+  /// \return The segment indexes, matching the point order. If a point
+  ///   coincides with an alignment point, it will return the back segment. If
+  ///   a point is not on the alignment, -1 is returned.
+  std::vector<int> IndexesSegment(const Alignment& alignment) const;
+
+  /// \brief Gets the xyz position of every point.
+  /// \param[in] line
+  ///   The transmission line, which provides the alignment.
+  /// \return The xyz points, matching the point order. If a point is not on
+  ///   the alignment, or the transmission line does not update, a default
+  ///   point is returned.
+  std::vector<Point3d<double>> PointsXyz(const TransmissionLine& line) const;
+
+  /// \brief Reserves memory for a number of points.
+  /// \param[in] size
+  ///   The total number of points.
+  void Reserve(const int& size);
+
+  /// \brief Validates member variables.
+  /// \param[in] is_included_warnings
+  ///   A flag that tightens the acceptable value range.
+  /// \param[in,out] messages
+  ///   A list of detailed error messages. If this is provided, any validation
+  ///   errors will be appended to the list.
+  /// \return A boolean value indicating status of member variables.
+  bool Validate(const bool& is_included_warnings = true,
+                std::list<ErrorMessage>* messages = nullptr) const;
+
+  /// \brief Gets the terrain points.
+  /// \return The terrain points, sorted by station.
+  const std::vector<TerrainPoint>* points() const;
+
+ private:
+  /// \brief Sorts the points if necessary.
+  void Sort() const;
+
+  /// \var is_sorted_
+  ///   An indicator that tells if the points are sorted by station.
+  mutable bool is_sorted_;
+
+  /// \var points_
+  ///   The terrain points.
+  mutable std::vector<TerrainPoint> points_;
+
+  /// \var stations_
+  ///   The station of each terrain point. This matches the point order.
+  mutable std::vector<double> stations_;
+};
+
+#endif  // MODELS_TRANSMISSIONLINE_TERRAIN_PROFILE_H_
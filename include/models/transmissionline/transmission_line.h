@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "models/base/point.h"
+#include "models/base/slot_vector.h"
 #include "models/base/vector.h"
 #include "models/transmissionline/alignment.h"
 #include "models/transmissionline/line_cable.h"
@@ -41,12 +42,30 @@
 /// Xyz coordinates can be determined for the alignment intersection, as well
 /// as attachment points.
 ///
+/// \par CACHED POINTS
+///
+/// The alignment and line structure xyz points are cached and updated lazily.
+/// Modifying an alignment point only recalculates the alignment points from
+/// that point onward, along with the line structures on the affected
+/// segments. Modifying a line structure only recalculates that structure.
+///
 /// \par LINE CABLES
 ///
 /// Line cables can be attached to the line structures. Line cables can only
 /// exist on the transmission line if the connections are, and remain, valid.
 /// If any of the terminating connections become invalid, the line cable is
 /// removed. Only one line cable is allowed for each line structure attachment.
+///
+/// \par STORAGE
+///
+/// Line structures and line cables are stored in stable slots, so adding or
+/// deleting other elements never moves them. The line cable connections
+/// reference the line structures by address, and callers may keep line cable
+/// addresses (e.g. for sag-tension models), while still allowing constant time
+/// access by index and constant time index lookup by address. An address is
+/// only valid until its element is deleted or modified, after which the slot
+/// may be reused by a different element. Slot handles from line_cables() or
+/// line_structures() should be kept instead if elements may be deleted.
 class TransmissionLine {
  public:
   /// \brief Default constructor.
@@ -119,7 +138,8 @@ class TransmissionLine {
 
   /// \brief Gets the line structure index.
   /// \param[in] line_structure
-  ///   The line structure.
+  ///   The line structure. This must not be a deleted line structure, as the
+  ///   address may be reused by another line structure.
   /// \return The index of the line structure. If no line structure is found,
   ///   -1 is returned.
   int IndexLineStructure(const LineStructure* line_structure) const;
@@ -156,6 +176,15 @@ class TransmissionLine {
   /// \return The xyz coordinates for all alignment points.
   const std::vector<Point3d<double>>* PointsXyzAlignment() const;
 
+  /// \brief Gets the xyz points of the alignment path for multiple stations.
+  /// \param[in] stations
+  ///   The positions along the alignment. These should be sorted in
+  ///   ascending order so the alignment segments are found in a single pass.
+  /// \return The xyz points of the alignment path, matching the station
+  ///   order. Invalid stations return a default point.
+  std::vector<Point3d<double>> PointsXyzAlignment(
+      const std::vector<double>& stations) const;
+
   /// \brief Gets the xyz coordinates for all line structures on the alignment.
   /// \return The xyz coordinate for all line structure alignment points.
   const std::vector<Point3d<double>>* PointsXyzLineStructures() const;
@@ -199,11 +228,11 @@ class TransmissionLine {
   /// \brief Gets the line cables.
   /// \return The line cables, sorted by starting structure and attachment
   ///   index.
-  const std::list<LineCable>* line_cables() const;
+  const SlotVector<LineCable>* line_cables() const;
 
   /// \brief Gets the line structures.
   /// \return The line structures, sorted by station.
-  const std::list<LineStructure>* line_structures() const;
+  const SlotVector<LineStructure>* line_structures() const;
 
   /// \brief Gets the origin.
   /// \return The origin.
@@ -238,6 +267,14 @@ class TransmissionLine {
   /// invalid.
   void DeleteInvalidLineStructures();
 
+  /// \brief Flags the cached xyz points that are affected by an alignment
+  ///   point change.
+  /// \param[in] index
+  ///   The index of the first alignment point that changed.
+  /// The alignment points from the index onward, and the line structures
+  /// ahead of the previous alignment point are flagged.
+  void FlagStalePointsXyzAlignment(const int& index);
+
   /// \brief Determines if class is updated.
   /// \return A boolean indicating if class is updated.
   bool IsUpdated() const;
@@ -254,6 +291,23 @@ class TransmissionLine {
   /// \return If the line structure index is valid.
   bool IsValidLineStructureIndex(const int& index) const;
 
+  /// \brief Gets the xyz points of the alignment path for multiple stations.
+  /// \param[in] stations
+  ///   The positions along the alignment, sorted in ascending order.
+  /// \return The xyz points of the alignment path. Invalid stations return a
+  ///   default point.
+  std::vector<Point3d<double>> PointsXyzAlignmentFromStations(
+      const std::vector<double>& stations) const;
+
+  /// \brief Gets the xyz point of the alignment path.
+  /// \param[in] index_segment
+  ///   The alignment segment index that contains the station.
+  /// \param[in] station
+  ///   The position along the alignment.
+  /// \return The xyz point of the alignment path.
+  Point3d<double> PointXyzAlignmentFromSegment(const int& index_segment,
+                                               const double& station) const;
+
   /// \brief Gets the xyz point of the alignment path.
   /// \param[in] station
   ///   The position along the alignment.
@@ -289,10 +343,12 @@ class TransmissionLine {
 
   /// \brief Updates the cached coordinate points for the alignment.
   /// \return A boolean indicating the success status of the update.
+  /// Only the points that are not in the cache are calculated.
   bool UpdatePointsXyzAlignment() const;
 
   /// \brief Updates the cached coordinate points for line structures.
   /// \return A boolean indicating the success status of the update.
+  /// Only the points that are flagged as stale are calculated.
   bool UpdatePointsXyzLineStructures() const;
 
   /// \brief Gets an xy alignment segment orientation vector.
@@ -316,32 +372,40 @@ class TransmissionLine {
   ///   the alignment (zero degree rotation) is along the x-axis.
   Alignment alignment_;
 
-  /// \var is_updated_points_xyz_alignment_
-  ///   An indicator that tells if the cached alignment xyz points are updated.
-  mutable bool is_updated_points_xyz_alignment_;
+  /// \var is_stale_points_xyz_structures_
+  ///   An indicator for each line structure that tells if the cached xyz point
+  ///   needs to be recalculated.
+  mutable std::vector<bool> is_stale_points_xyz_structures_;
 
   /// \var is_updated_points_xyz_structures_
-  ///   An indicator that tells if the cached structure xyz points are updated.
+  ///   An indicator that tells if all cached structure xyz points are updated.
   mutable bool is_updated_points_xyz_structures_;
 
   /// \var line_cables_
   ///   The line cables, sorted by starting structure and then attachment index.
-  std::list<LineCable> line_cables_;
+  ///   These are stored in stable slots so callers can reference them by
+  ///   address.
+  SlotVector<LineCable> line_cables_;
 
   /// \var line_structures_
-  ///   The line structures, sorted by increasing station.
-  std::list<LineStructure> line_structures_;
+  ///   The line structures, sorted by increasing station. The line cable
+  ///   connections reference these by address.
+  SlotVector<LineStructure> line_structures_;
 
   /// \var origin_
   ///   The xyz origin point. This coincides with the first alignment point.
   Point3d<double> origin_;
 
   /// \var points_xyz_alignment_
-  ///   The xyz coordinates for the alignment points.
+  ///   The xyz coordinates for the alignment points. This only contains the
+  ///   leading points that are updated, so any point past the end of the
+  ///   cache needs to be calculated.
   mutable std::vector<Point3d<double>> points_xyz_alignment_;
 
   /// \var points_xyz_structures_
-  ///   The xyz coordinates for the structure position on the alignment.
+  ///   The xyz coordinates for the structure position on the alignment. This
+  ///   always matches the line structure count, and is paired with the stale
+  ///   indicators.
   mutable std::vector<Point3d<double>> points_xyz_structures_;
 };
 
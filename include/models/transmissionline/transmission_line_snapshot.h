@@ -0,0 +1,141 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef MODELS_TRANSMISSIONLINE_TRANSMISSION_LINE_SNAPSHOT_H_
+#define MODELS_TRANSMISSIONLINE_TRANSMISSION_LINE_SNAPSHOT_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "models/transmissionline/cable.h"
+#include "models/transmissionline/hardware.h"
+#include "models/transmissionline/structure.h"
+#include "models/transmissionline/transmission_line.h"
+#include "models/transmissionline/weather_load_case.h"
+
+/// \par OVERVIEW
+///
+/// This class reads and writes a transmission line, and all of the objects it
+/// references, as a compact binary snapshot.
+///
+/// \par FORMAT
+///
+/// The snapshot is a header followed by sections of flat, fixed-width records.
+/// The header contains a magic string, a format version, a byte order marker,
+/// the total file size, and the byte offset and record count of every section.
+/// Records reference each other by section index instead of by pointer, so the
+/// file is position independent and can be mapped at any address. Every string
+/// is interned once in a single string section and referenced by offset and
+/// length.
+///
+/// Records are stored in the native byte order. A snapshot with a different
+/// byte order or version is rejected.
+///
+/// \par LOADING
+///
+/// The file is memory mapped read-only where the platform supports it, and
+/// read into a single buffer otherwise. Every section is bounds checked before
+/// use, and every record index is checked before it is resolved. The model
+/// objects are then rebuilt from the flat records in one pass, and the record
+/// indexes are fixed up into pointers to the objects owned by this class.
+///
+/// \par OWNERSHIP
+///
+/// The loaded transmission line references the cables, hardware, structures,
+/// and weathercases owned by this class, so this class cannot be copied.
+class TransmissionLineSnapshot {
+ public:
+  /// \brief Default constructor.
+  TransmissionLineSnapshot();
+
+  /// \brief Destructor.
+  ~TransmissionLineSnapshot();
+
+  TransmissionLineSnapshot(const TransmissionLineSnapshot&) = delete;
+  TransmissionLineSnapshot& operator=(const TransmissionLineSnapshot&) = delete;
+
+  /// \brief Loads a snapshot from a buffer.
+  /// \param[in] data
+  ///   The snapshot data. This must be aligned to 8 bytes.
+  /// \param[in] size
+  ///   The size of the snapshot data, in bytes.
+  /// \return If the snapshot loaded successfully. If not, the class is left
+  ///   empty.
+  bool Deserialize(const char* data, const std::size_t& size);
+
+  /// \brief Loads a snapshot from a file.
+  /// \param[in] filepath
+  ///   The file path.
+  /// \return If the snapshot loaded successfully. If not, the class is left
+  ///   empty.
+  bool Load(const std::string& filepath);
+
+  /// \brief Writes a transmission line to a snapshot buffer.
+  /// \param[in] line
+  ///   The transmission line.
+  /// \param[out] buffer
+  ///   The snapshot data.
+  /// \return If the snapshot was written successfully. A transmission line
+  ///   that references objects it does not own cannot be written.
+  static bool Serialize(const TransmissionLine& line,
+                        std::vector<char>* buffer);
+
+  /// \brief Writes a transmission line to a snapshot file.
+  /// \param[in] line
+  ///   The transmission line.
+  /// \param[in] filepath
+  ///   The file path.
+  /// \return If the snapshot was written successfully.
+  static bool Write(const TransmissionLine& line, const std::string& filepath);
+
+  /// \brief Gets the cables.
+  /// \return The cables.
+  const std::vector<Cable>* cables() const;
+
+  /// \brief Gets the hardware.
+  /// \return The hardware.
+  const std::vector<Hardware>* hardwares() const;
+
+  /// \brief Gets the structures.
+  /// \return The structures.
+  const std::vector<Structure>* structures() const;
+
+  /// \brief Gets the transmission line.
+  /// \return The transmission line.
+  const TransmissionLine* transmission_line() const;
+
+  /// \brief Gets the weathercases.
+  /// \return The weathercases.
+  const std::vector<WeatherLoadCase>* weathercases() const;
+
+  /// \var kVersion
+  ///   The snapshot format version.
+  static const int kVersion;
+
+ private:
+  /// \brief Clears all loaded objects.
+  void Clear();
+
+  /// \var cables_
+  ///   The cables referenced by the line cables.
+  std::vector<Cable> cables_;
+
+  /// \var hardwares_
+  ///   The hardware referenced by the line structures.
+  std::vector<Hardware> hardwares_;
+
+  /// \var line_
+  ///   The transmission line.
+  TransmissionLine line_;
+
+  /// \var structures_
+  ///   The structures referenced by the line structures.
+  std::vector<Structure> structures_;
+
+  /// \var weathercases_
+  ///   The weathercases referenced by the line cables.
+  std::vector<WeatherLoadCase> weathercases_;
+};
+
+#endif  // MODELS_TRANSMISSIONLINE_TRANSMISSION_LINE_SNAPSHOT_H_
@@ -0,0 +1,86 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/base/binary_file_format.h"
+
+#include <cstring>
+
+// the common header size keeps the file-specific values aligned
+static_assert(sizeof(binary_file::HeaderRecord) % 8 == 0,
+              "File header must be a multiple of 8 bytes.");
+
+namespace binary_file {
+
+Hasher::Hasher() {
+  hash_ = 14695981039346656037ULL;
+}
+
+void Hasher::AddBytes(const void* data, const std::size_t& size) {
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (std::size_t i = 0; i < size; i++) {
+    hash_ ^= bytes[i];
+    hash_ *= 1099511628211ULL;
+  }
+}
+
+void Hasher::AddDouble(const double& value) {
+  const double value_hashed = (value == 0) ? 0 : value;
+  AddBytes(&value_hashed, sizeof(value_hashed));
+}
+
+void Hasher::AddInt(const std::int64_t& value) {
+  AddBytes(&value, sizeof(value));
+}
+
+std::uint64_t Hasher::hash() const {
+  return hash_;
+}
+
+HeaderRecord Header(const char* magic, const int& version) {
+  HeaderRecord header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, magic, sizeof(header.magic));
+  header.marker_byte_order = kMarkerByteOrder;
+  header.version = version;
+  header.size_file = 0;
+  return header;
+}
+
+bool IsValidHeader(const char* data, const std::size_t& size,
+                   const char* magic, const int& version) {
+  if ((data == nullptr) || (size < sizeof(HeaderRecord))
+      || (reinterpret_cast<std::uintptr_t>(data) % 8 != 0)) {
+    return false;
+  }
+
+  const HeaderRecord& header = *reinterpret_cast<const HeaderRecord*>(data);
+  return (std::memcmp(header.magic, magic, sizeof(header.magic)) == 0)
+      && (header.marker_byte_order == kMarkerByteOrder)
+      && (header.version == static_cast<std::uint32_t>(version))
+      && (header.size_file == size);
+}
+
+bool IsValidRange(const std::uint64_t& begin, const std::uint64_t& count,
+                  const std::uint64_t& size) {
+  return (begin <= size) && (count <= size - begin);
+}
+
+bool IsValidSections(const SectionRecord* sections,
+                     const std::size_t* sizes_record,
+                     const int& size_sections,
+                     const std::size_t& size_header,
+                     const std::size_t& size) {
+  for (int index = 0; index < size_sections; index++) {
+    const SectionRecord& section = sections[index];
+    if ((section.offset % 8 != 0)
+        || (section.offset < size_header)
+        || (size < section.offset)
+        || ((size - section.offset) / sizes_record[index] < section.count)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace binary_file
@@ -0,0 +1,215 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/base/bounding_volume_hierarchy.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+BoundingBox3d::BoundingBox3d() {
+  const double kInfinity = std::numeric_limits<double>::infinity();
+  point_max = Point3d<double>(-kInfinity, -kInfinity, -kInfinity);
+  point_min = Point3d<double>(kInfinity, kInfinity, kInfinity);
+}
+
+double BoundingBox3d::Distance(const BoundingBox3d& other) const {
+  // gets the gap along each axis, which is zero if the boxes overlap
+  const double x = std::max(0.0, std::max(other.point_min.x - point_max.x,
+                                          point_min.x - other.point_max.x));
+  const double y = std::max(0.0, std::max(other.point_min.y - point_max.y,
+                                          point_min.y - other.point_max.y));
+  const double z = std::max(0.0, std::max(other.point_min.z - point_max.z,
+                                          point_min.z - other.point_max.z));
+
+  return std::sqrt(x * x + y * y + z * z);
+}
+
+void BoundingBox3d::Expand(const Point3d<double>& point) {
+  point_max.x = std::max(point_max.x, point.x);
+  point_max.y = std::max(point_max.y, point.y);
+  point_max.z = std::max(point_max.z, point.z);
+  point_min.x = std::min(point_min.x, point.x);
+  point_min.y = std::min(point_min.y, point.y);
+  point_min.z = std::min(point_min.z, point.z);
+}
+
+void BoundingBox3d::Expand(const BoundingBox3d& other) {
+  Expand(other.point_max);
+  Expand(other.point_min);
+}
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy() {
+  size_items_ = 0;
+}
+
+BoundingVolumeHierarchy::~BoundingVolumeHierarchy() {
+}
+
+void BoundingVolumeHierarchy::Build(const std::vector<BoundingBox3d>& boxes) {
+  Clear();
+
+  size_items_ = boxes.size();
+  if (size_items_ == 0) {
+    return;
+  }
+
+  // a binary tree with one item per leaf has fewer than twice as many nodes
+  // as items
+  nodes_.reserve(2 * size_items_);
+
+  indexes_item_.resize(size_items_);
+  for (int index = 0; index < size_items_; index++) {
+    indexes_item_[index] = index;
+  }
+
+  BuildNode(boxes, 0, size_items_);
+}
+
+void BoundingVolumeHierarchy::Clear() {
+  indexes_item_.clear();
+  nodes_.clear();
+  size_items_ = 0;
+}
+
+double BoundingVolumeHierarchy::DistanceMinimum(
+    const BoundingVolumeHierarchy& a,
+    const BoundingVolumeHierarchy& b,
+    const std::function<double(const int&, const int&)>& distance_items) {
+  if ((a.nodes_.empty() == true) || (b.nodes_.empty() == true)) {
+    return -999999;
+  }
+
+  double distance_min = std::numeric_limits<double>::infinity();
+
+  // traverses both trees with a stack of node pairs
+  std::vector<std::pair<int, int>> stack;
+  stack.push_back(std::make_pair(0, 0));
+  while (stack.empty() == false) {
+    const std::pair<int, int> pair = stack.back();
+    stack.pop_back();
+
+    const Node& node_a = a.nodes_[pair.first];
+    const Node& node_b = b.nodes_[pair.second];
+
+    // skips pairs that cannot contain a closer item pair
+    if (distance_min <= node_a.box.Distance(node_b.box)) {
+      continue;
+    }
+
+    const bool is_leaf_a = node_a.index_item != -1;
+    const bool is_leaf_b = node_b.index_item != -1;
+    if ((is_leaf_a == true) && (is_leaf_b == true)) {
+      const double distance = distance_items(node_a.index_item,
+                                             node_b.index_item);
+      if (distance < distance_min) {
+        distance_min = distance;
+      }
+      continue;
+    }
+
+    // splits the branch node, or the first node if both are branches
+    std::pair<int, int> pair_left;
+    std::pair<int, int> pair_right;
+    if (is_leaf_a == false) {
+      pair_left = std::make_pair(node_a.index_child_left, pair.second);
+      pair_right = std::make_pair(node_a.index_child_right, pair.second);
+    } else {
+      pair_left = std::make_pair(pair.first, node_b.index_child_left);
+      pair_right = std::make_pair(pair.first, node_b.index_child_right);
+    }
+
+    // pushes the farther pair first, so the nearer pair is visited first
+    const double distance_left = a.nodes_[pair_left.first].box.Distance(
+        b.nodes_[pair_left.second].box);
+    const double distance_right = a.nodes_[pair_right.first].box.Distance(
+        b.nodes_[pair_right.second].box);
+    if (distance_left < distance_right) {
+      stack.push_back(pair_right);
+      stack.push_back(pair_left);
+    } else {
+      stack.push_back(pair_left);
+      stack.push_back(pair_right);
+    }
+  }
+
+  return distance_min;
+}
+
+int BoundingVolumeHierarchy::size() const {
+  return size_items_;
+}
+
+int BoundingVolumeHierarchy::BuildNode(const std::vector<BoundingBox3d>& boxes,
+                                       const int& index_begin,
+                                       const int& index_end) {
+  const int index_node = nodes_.size();
+  nodes_.push_back(Node());
+
+  // creates a leaf for a single item
+  if (index_end - index_begin == 1) {
+    Node& node = nodes_[index_node];
+    node.box = boxes[indexes_item_[index_begin]];
+    node.index_child_left = -1;
+    node.index_child_right = -1;
+    node.index_item = indexes_item_[index_begin];
+    return index_node;
+  }
+
+  // gets the spread of the box centers
+  BoundingBox3d box_centers;
+  for (int index = index_begin; index < index_end; index++) {
+    const BoundingBox3d& box = boxes[indexes_item_[index]];
+    box_centers.Expand(Point3d<double>(
+        (box.point_min.x + box.point_max.x) / 2,
+        (box.point_min.y + box.point_max.y) / 2,
+        (box.point_min.z + box.point_max.z) / 2));
+  }
+
+  // selects the axis with the largest spread
+  const double spread_x = box_centers.point_max.x - box_centers.point_min.x;
+  const double spread_y = box_centers.point_max.y - box_centers.point_min.y;
+  const double spread_z = box_centers.point_max.z - box_centers.point_min.z;
+
+  int axis = 0;
+  if ((spread_x < spread_y) && (spread_z <= spread_y)) {
+    axis = 1;
+  } else if ((spread_x < spread_z) && (spread_y < spread_z)) {
+    axis = 2;
+  }
+
+  // partitions the items at the median center along the axis
+  auto center = [&boxes, &axis](const int& index_item) {
+    const BoundingBox3d& box = boxes[index_item];
+    if (axis == 0) {
+      return box.point_min.x + box.point_max.x;
+    } else if (axis == 1) {
+      return box.point_min.y + box.point_max.y;
+    } else {
+      return box.point_min.z + box.point_max.z;
+    }
+  };
+
+  const int index_middle = index_begin + (index_end - index_begin) / 2;
+  std::nth_element(indexes_item_.begin() + index_begin,
+                   indexes_item_.begin() + index_middle,
+                   indexes_item_.begin() + index_end,
+                   [&center](const int& index_a, const int& index_b) {
+                     return center(index_a) < center(index_b);
+                   });
+
+  // builds children
+  // the node vector may reallocate, so the node is accessed by index
+  const int index_left = BuildNode(boxes, index_begin, index_middle);
+  const int index_right = BuildNode(boxes, index_middle, index_end);
+
+  Node& node = nodes_[index_node];
+  node.box = nodes_[index_left].box;
+  node.box.Expand(nodes_[index_right].box);
+  node.index_child_left = index_left;
+  node.index_child_right = index_right;
+  node.index_item = -1;
+
+  return index_node;
+}
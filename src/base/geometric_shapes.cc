@@ -23,7 +23,9 @@ bool Cylinder::Validate(const bool& /*is_included_warnings*/,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CYLINDER";
+  if (messages != nullptr) {
+    message.title = "CYLINDER";
+  }
 
   // validates diameter
   if (diameter_ <= 0) {
@@ -0,0 +1,97 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/base/mapped_file.h"
+
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() {
+  data_ = nullptr;
+  is_mapped_ = false;
+  size_ = 0;
+}
+
+MappedFile::~MappedFile() {
+  Close();
+}
+
+void MappedFile::Close() {
+#if defined(__unix__) || defined(__APPLE__)
+  if (is_mapped_ == true) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+#endif
+
+  buffer_.clear();
+  buffer_.shrink_to_fit();
+  data_ = nullptr;
+  is_mapped_ = false;
+  size_ = 0;
+}
+
+bool MappedFile::Open(const std::string& filepath) {
+  Close();
+
+#if defined(__unix__) || defined(__APPLE__)
+  // maps the file read-only
+  const int file = open(filepath.c_str(), O_RDONLY);
+  if (file == -1) {
+    return false;
+  }
+
+  struct stat status;
+  if ((fstat(file, &status) != 0) || (status.st_size <= 0)) {
+    close(file);
+    return false;
+  }
+
+  const std::size_t size = status.st_size;
+  void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+  close(file);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+
+  data_ = static_cast<const char*>(data);
+  is_mapped_ = true;
+  size_ = size;
+  return true;
+#else
+  // reads the file into an aligned buffer
+  std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+  if (file.is_open() == false) {
+    return false;
+  }
+
+  const std::streamoff size = file.tellg();
+  if (size <= 0) {
+    return false;
+  }
+
+  buffer_.resize((size + 7) / 8);
+  file.seekg(0);
+  if (!file.read(reinterpret_cast<char*>(buffer_.data()), size)) {
+    buffer_.clear();
+    return false;
+  }
+
+  data_ = reinterpret_cast<const char*>(buffer_.data());
+  size_ = size;
+  return true;
+#endif
+}
+
+const char* MappedFile::data() const {
+  return data_;
+}
+
+std::size_t MappedFile::size() const {
+  return size_;
+}
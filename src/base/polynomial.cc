@@ -7,6 +7,27 @@
 
 #include "models/base/point.h"
 
+namespace {
+
+/// \brief Evaluates a polynomial using Horner's method.
+/// \param[in] coefficients
+///   The polynomial coefficients, indexed by order.
+/// \param[in] x
+///   The x value.
+/// \return The y value.
+template <class T>
+T Evaluate(const std::vector<double>& coefficients, const T& x) {
+  T y = 0;
+  for (auto iter = coefficients.crbegin(); iter != coefficients.crend();
+       iter++) {
+    y = y * x + *iter;
+  }
+
+  return y;
+}
+
+}  // namespace
+
 Polynomial::Polynomial() {
   derivative_ = nullptr;
   is_updated_derivative_ = false;
@@ -52,7 +73,9 @@ bool Polynomial::Validate(const bool& /*is_included_warnings*/,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "POLYNOMIAL";
+  if (messages != nullptr) {
+    message.title = "POLYNOMIAL";
+  }
 
   // validates coefficients
   if (coefficients_ == nullptr) {
@@ -70,7 +93,7 @@ bool Polynomial::Validate(const bool& /*is_included_warnings*/,
 
   // validates update process
   is_valid = Update();
-  if (is_valid == false) {
+  if ((is_valid == false) && (messages != nullptr)) {
     message.description = "Error solving derivative coefficients";
     messages->push_back(message);
   }
@@ -122,15 +145,11 @@ double Polynomial::X(const double& y, const int& decimal_precision_y,
 }
 
 double Polynomial::Y(const double& x) const {
-  double y = 0;
-
-  const int order_max = OrderMax();
-  for (int order = 0; order <= order_max; order++) {
-    const double& coefficient =  coefficients_->at(order);
-    y = y + (coefficient * std::pow(x, order));
-  }
+  return Evaluate(*coefficients_, x);
+}
 
-  return y;
+Dual<double> Polynomial::Y(const Dual<double>& x) const {
+  return Evaluate(*coefficients_, x);
 }
 
 const std::vector<double>* Polynomial::coefficients() const {
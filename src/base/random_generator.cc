@@ -0,0 +1,140 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/base/random_generator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "models/base/units.h"
+
+CounterRandomGenerator::CounterRandomGenerator() {
+  counter_ = 0;
+  key_ = Mix(0);
+}
+
+CounterRandomGenerator::CounterRandomGenerator(const uint64_t& seed,
+                                               const uint64_t& stream) {
+  counter_ = 0;
+
+  // mixes the stream separately so that adjacent seeds and streams do not
+  // produce related keys
+  key_ = Mix(seed) ^ Mix(Mix(stream) + 0x632BE59BD9B4E019);
+}
+
+CounterRandomGenerator::~CounterRandomGenerator() {
+}
+
+uint64_t CounterRandomGenerator::Next() {
+  const uint64_t value = Mix(key_ + (counter_ * 0x9E3779B97F4A7C15));
+  counter_++;
+  return value;
+}
+
+double CounterRandomGenerator::Normal() {
+  const double u1 = Uniform();
+  const double u2 = Uniform();
+  return std::sqrt(-2 * std::log(u1)) * std::cos(2 * units::kPi * u2);
+}
+
+double CounterRandomGenerator::Uniform() {
+  // uses the upper 53 bits, which is the double precision, and offsets by half
+  // a step to exclude zero and one
+  return ((Next() >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+uint64_t CounterRandomGenerator::counter() const {
+  return counter_;
+}
+
+void CounterRandomGenerator::set_counter(const uint64_t& counter) {
+  counter_ = counter;
+}
+
+uint64_t CounterRandomGenerator::Mix(const uint64_t& value) {
+  uint64_t z = value + 0x9E3779B97F4A7C15;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+  return z ^ (z >> 31);
+}
+
+
+RandomDistribution::RandomDistribution() {
+  deviation = -999999;
+  lower = -std::numeric_limits<double>::infinity();
+  mean = -999999;
+  type = DistributionType::kNull;
+  upper = std::numeric_limits<double>::infinity();
+}
+
+RandomDistribution::~RandomDistribution() {
+}
+
+double RandomDistribution::Sample(CounterRandomGenerator* generator) const {
+  if (type == DistributionType::kNormal) {
+    const double value = mean + deviation * generator->Normal();
+    return std::min(upper, std::max(lower, value));
+  } else if (type == DistributionType::kUniform) {
+    return lower + (upper - lower) * generator->Uniform();
+  } else {
+    return -999999;
+  }
+}
+
+bool RandomDistribution::Validate(const bool& /*is_included_warnings*/,
+                                  std::list<ErrorMessage>* messages) const {
+  // initializes
+  bool is_valid = true;
+  ErrorMessage message;
+  if (messages != nullptr) {
+    message.title = "RANDOM DISTRIBUTION";
+  }
+
+  // validates bounds
+  if (upper < lower) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid bounds. The upper bound is less than "
+                            "the lower bound";
+      messages->push_back(message);
+    }
+  }
+
+  // validates type and parameters
+  if (type == DistributionType::kNull) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid distribution type";
+      messages->push_back(message);
+    }
+  } else if (type == DistributionType::kNormal) {
+    if (deviation < 0) {
+      is_valid = false;
+      if (messages != nullptr) {
+        message.description = "Invalid standard deviation";
+        messages->push_back(message);
+      }
+    }
+
+    if (mean == -999999) {
+      is_valid = false;
+      if (messages != nullptr) {
+        message.description = "Invalid mean";
+        messages->push_back(message);
+      }
+    }
+  } else if (type == DistributionType::kUniform) {
+    if ((std::isfinite(lower) == false) || (std::isfinite(upper) == false)) {
+      is_valid = false;
+      if (messages != nullptr) {
+        message.description = "Invalid bounds. Uniform distributions require "
+                              "finite bounds";
+        messages->push_back(message);
+      }
+    }
+  }
+
+  // returns validation status
+  return is_valid;
+}
@@ -0,0 +1,195 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/base/t_digest.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "models/base/units.h"
+
+TDigest::TDigest() {
+  compression_ = 100;
+  Clear();
+}
+
+TDigest::TDigest(const double& compression) {
+  compression_ = compression;
+  Clear();
+}
+
+TDigest::~TDigest() {
+}
+
+void TDigest::Add(const double& value) {
+  if (count_ == 0) {
+    max_ = value;
+    min_ = value;
+  } else {
+    max_ = std::max(max_, value);
+    min_ = std::min(min_, value);
+  }
+
+  count_++;
+  sum_ += value;
+
+  buffer_.push_back(Centroid{value, 1});
+
+  // merges when the buffer is several times the centroid limit
+  if (10 * compression_ < buffer_.size()) {
+    Compress();
+  }
+}
+
+void TDigest::Clear() {
+  buffer_.clear();
+  centroids_.clear();
+  count_ = 0;
+  max_ = -999999;
+  min_ = -999999;
+  sum_ = 0;
+}
+
+double TDigest::Mean() const {
+  if (count_ == 0) {
+    return -999999;
+  }
+
+  return sum_ / count_;
+}
+
+void TDigest::Merge(const TDigest& other) {
+  if (other.count_ == 0) {
+    return;
+  }
+
+  if (count_ == 0) {
+    max_ = other.max_;
+    min_ = other.min_;
+  } else {
+    max_ = std::max(max_, other.max_);
+    min_ = std::min(min_, other.min_);
+  }
+
+  count_ += other.count_;
+  sum_ += other.sum_;
+
+  // adds the other centroids to the buffer
+  buffer_.insert(buffer_.end(), other.centroids_.cbegin(),
+                 other.centroids_.cend());
+  buffer_.insert(buffer_.end(), other.buffer_.cbegin(), other.buffer_.cend());
+  Compress();
+}
+
+double TDigest::Quantile(const double& fraction) const {
+  if (count_ == 0) {
+    return -999999;
+  }
+
+  Compress();
+
+  // checks the end points
+  if (fraction <= 0) {
+    return min_;
+  } else if (1 <= fraction) {
+    return max_;
+  }
+
+  const double weight_target = fraction * count_;
+
+  // interpolates between the minimum and the first centroid
+  const Centroid& first = centroids_.front();
+  if (weight_target < first.weight / 2) {
+    return min_ + (first.mean - min_) * weight_target / (first.weight / 2);
+  }
+
+  // interpolates between the centers of adjacent centroids
+  double weight_center = first.weight / 2;
+  const int kSize = centroids_.size();
+  for (int index = 0; index < kSize - 1; index++) {
+    const Centroid& centroid = centroids_[index];
+    const Centroid& centroid_next = centroids_[index + 1];
+    const double weight_step = (centroid.weight + centroid_next.weight) / 2;
+    if (weight_target < weight_center + weight_step) {
+      const double factor = (weight_target - weight_center) / weight_step;
+      return centroid.mean + factor * (centroid_next.mean - centroid.mean);
+    }
+
+    weight_center += weight_step;
+  }
+
+  // interpolates between the last centroid and the maximum
+  const Centroid& last = centroids_.back();
+  const double factor = (weight_target - weight_center) / (last.weight / 2);
+  return last.mean + factor * (max_ - last.mean);
+}
+
+int TDigest::count() const {
+  return count_;
+}
+
+double TDigest::max() const {
+  return max_;
+}
+
+double TDigest::min() const {
+  return min_;
+}
+
+void TDigest::Compress() const {
+  if (buffer_.empty() == true) {
+    return;
+  }
+
+  // combines and sorts the centroids and buffer
+  buffer_.insert(buffer_.end(), centroids_.cbegin(), centroids_.cend());
+  std::sort(buffer_.begin(), buffer_.end(),
+            [](const Centroid& a, const Centroid& b) {
+              return a.mean < b.mean;
+            });
+
+  double weight_total = 0;
+  for (auto iter = buffer_.cbegin(); iter != buffer_.cend(); iter++) {
+    weight_total += iter->weight;
+  }
+
+  // defines the scale function, which converts a quantile to a centroid
+  // index, and its inverse
+  // a centroid can span at most one unit of the scale
+  const double kScale = compression_ / (2 * units::kPi);
+  auto scale = [kScale](const double& q) {
+    return kScale * std::asin(2 * q - 1);
+  };
+  auto scale_inverse = [kScale](const double& k) {
+    const double angle = std::min(units::kPi / 2,
+                                  std::max(-units::kPi / 2, k / kScale));
+    return (std::sin(angle) + 1) / 2;
+  };
+
+  // merges adjacent centroids while they fit within the scale limit
+  centroids_.clear();
+  Centroid current = buffer_.front();
+  double weight_before = 0;
+  double q_limit = scale_inverse(scale(0) + 1);
+  const int kSize = buffer_.size();
+  for (int index = 1; index < kSize; index++) {
+    const Centroid& centroid = buffer_[index];
+    const double q = (weight_before + current.weight + centroid.weight)
+                     / weight_total;
+    if (q <= q_limit) {
+      // merges into the current centroid
+      current.mean += (centroid.mean - current.mean) * centroid.weight
+                      / (current.weight + centroid.weight);
+      current.weight += centroid.weight;
+    } else {
+      // starts a new centroid
+      centroids_.push_back(current);
+      weight_before += current.weight;
+      q_limit = scale_inverse(scale(weight_before / weight_total) + 1);
+      current = centroid;
+    }
+  }
+  centroids_.push_back(current);
+
+  buffer_.clear();
+}
@@ -0,0 +1,178 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/base/thread_pool.h"
+
+ThreadPool::ThreadPool() {
+  Initialize(0);
+}
+
+ThreadPool::ThreadPool(const int& num_threads) {
+  Initialize(num_threads);
+}
+
+ThreadPool::~ThreadPool() {
+  // signals the workers to exit
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopping_ = true;
+  }
+  condition_work_.notify_all();
+
+  // waits for the workers to exit
+  for (auto iter = workers_.begin(); iter != workers_.end(); iter++) {
+    std::thread& worker = *iter;
+    worker.join();
+  }
+}
+
+void ThreadPool::ParallelFor(const int& num_tasks,
+                             const std::function<void(const int&)>& task) {
+  if (num_tasks <= 0) {
+    return;
+  }
+
+  // executes serially if there are no workers
+  if (workers_.empty() == true) {
+    for (int index = 0; index < num_tasks; index++) {
+      task(index);
+    }
+    return;
+  }
+
+  // queues the tasks
+  // each queue gets a contiguous block of indexes so neighboring tasks tend
+  // to stay on the same thread
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    num_remaining_ = num_tasks;
+
+    const int kSizeQueues = queues_.size();
+    for (int index_queue = 0; index_queue < kSizeQueues; index_queue++) {
+      const int index_begin = (num_tasks * index_queue) / kSizeQueues;
+      const int index_end = (num_tasks * (index_queue + 1)) / kSizeQueues;
+
+      TaskQueue& queue = *queues_[index_queue];
+      std::lock_guard<std::mutex> lock_queue(queue.mutex);
+      for (int index = index_begin; index < index_end; index++) {
+        queue.indexes.push_back(index);
+      }
+    }
+
+    generation_++;
+  }
+  condition_work_.notify_all();
+
+  // executes tasks on the calling thread
+  ExecuteTasks(queues_.size() - 1);
+
+  // waits for the workers to finish any remaining tasks
+  std::unique_lock<std::mutex> lock(mutex_);
+  condition_done_.wait(lock, [this] { return num_remaining_ == 0; });
+  task_ = nullptr;
+}
+
+void ThreadPool::Run(ThreadPool* pool, const int& num_tasks,
+                     const std::function<void(const int&)>& task) {
+  if (pool != nullptr) {
+    pool->ParallelFor(num_tasks, task);
+  } else {
+    for (int index = 0; index < num_tasks; index++) {
+      task(index);
+    }
+  }
+}
+
+int ThreadPool::num_threads() const {
+  return queues_.size();
+}
+
+void ThreadPool::ExecuteTasks(const int& index_queue) {
+  int index_task = -9999;
+  while (PopTask(index_queue, &index_task) == true) {
+    (*task_)(index_task);
+
+    // signals the calling thread if this is the last task
+    if (--num_remaining_ == 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      condition_done_.notify_all();
+    }
+  }
+}
+
+void ThreadPool::Initialize(const int& num_threads) {
+  generation_ = 0;
+  is_stopping_ = false;
+  num_remaining_ = 0;
+  task_ = nullptr;
+
+  // determines the number of threads
+  int num = num_threads;
+  if (num < 1) {
+    num = std::thread::hardware_concurrency();
+  }
+
+  if (num < 1) {
+    num = 1;
+  }
+
+  // creates a queue for every thread, including the calling thread
+  for (int index = 0; index < num; index++) {
+    queues_.push_back(std::unique_ptr<TaskQueue>(new TaskQueue()));
+  }
+
+  // starts the workers
+  for (int index = 0; index < num - 1; index++) {
+    workers_.push_back(std::thread(&ThreadPool::RunWorker, this, index));
+  }
+}
+
+bool ThreadPool::PopTask(const int& index_queue, int* index_task) {
+  const int kSizeQueues = queues_.size();
+
+  // searches the preferred queue first, taking from the front
+  {
+    TaskQueue& queue = *queues_[index_queue];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.indexes.empty() == false) {
+      *index_task = queue.indexes.front();
+      queue.indexes.pop_front();
+      return true;
+    }
+  }
+
+  // steals from the other queues, taking from the back
+  for (int offset = 1; offset < kSizeQueues; offset++) {
+    TaskQueue& queue = *queues_[(index_queue + offset) % kSizeQueues];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.indexes.empty() == false) {
+      *index_task = queue.indexes.back();
+      queue.indexes.pop_back();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void ThreadPool::RunWorker(const int& index_queue) {
+  int generation = 0;
+  while (true) {
+    // waits for new tasks or a stop signal
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_work_.wait(lock, [this, &generation] {
+        return (is_stopping_ == true) || (generation != generation_);
+      });
+
+      if (is_stopping_ == true) {
+        return;
+      }
+
+      generation = generation_;
+    }
+
+    ExecuteTasks(index_queue);
+  }
+}
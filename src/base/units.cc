@@ -7,47 +7,6 @@
 
 namespace units {
 
-// angle conversion factors
-const double kAngleDegreesToRadians = kPi / 180.0;
-const double kAngleRadiansToDegrees = 180.0 / kPi;
-
-// force conversion factors
-const double kForceNewtonsToPounds = 1.0 / 4.4482216152605;
-const double kForcePoundsToNewtons = 4.4482216152605;
-
-// length conversion factors
-const double kLengthCentimetersToMeters = 1.0 / 100;
-const double kLengthFeetToInches = 12.0;
-const double kLengthFeetToMeters = 0.3048;
-const double kLengthFeetToMiles = 1.0 / 5280.0;
-const double kLengthInchesToFeet = 1.0 / 12.0;
-const double kLengthKilometersToMeters = 1000.0;
-const double kLengthMetersToCentimeters = 100.0;
-const double kLengthMetersToFeet = 1.0 / 0.3048;
-const double kLengthMetersToKilometers = 1.0 / 1000.0;
-const double kLengthMetersToMillimeters = 1000.0;
-const double kLengthMilesToFeet = 5280.0;
-const double kLengthMillimetersToMeters = 1.0 / 1000.0;
-
-// pressure conversion factors
-const double kStressMegaPascalToPascal = 1000000;
-const double kStressPascalToMegaPascal = 1.0 / 1000000;
-const double kStressPascalToPsf = 1.0 / 47.88026;
-const double kStressPsfToPascal = 47.88026;
-const double kStressPsfToPsi = 1.0 / 144.0;
-const double kStressPsiToPsf = 144.0;
-
-// temperature conversion factors
-const double kTemperatureKelvinToRankine = 1.8;
-const double kTemperatureRankineToKelvin = 1.0 / 1.8;
-
-const double kTemperatureShiftCelsiusToFahrenheit = 32;
-const double kTemperatureShiftCelsiusToKelvin = 273.15;
-const double kTemperatureShiftFahrenheitToCelsius = -32;
-const double kTemperatureShiftFahrenheitToRankine = 459.67;
-const double kTemperatureShiftKelvinToCelsius = -273.15;
-const double kTemperatureShiftRankineToFahrenheit = -459.67;
-
 /// \brief This is a generic function that converts a value by multiplication.
 /// \param[in] value
 ///   The starting value to convert.
@@ -66,7 +25,11 @@ double Convert(const double& value,
                const double& exponent,
                const bool& is_numerator) {
   // adjusts the factor based on the exponent
-  double factor_adj = std::pow(factor, exponent);
+  // the power is skipped for the common single exponent
+  double factor_adj = factor;
+  if (exponent != 1) {
+    factor_adj = std::pow(factor, exponent);
+  }
 
   // inverts factor if unit value is not in the numerator
   if (is_numerator == false) {
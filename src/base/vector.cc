@@ -31,13 +31,10 @@ double Vector2d::Angle(const bool& is_enabled_negative_angles) const {
     // return 0 instead of 359.99999....
     if (x_ == 0) {
       if (0 < y_) {
-        angle = units::ConvertAngle(
-            units::kPi / 2,
-            units::AngleConversionType::kRadiansToDegrees);
+        angle = units::Convert<units::Radians, units::Degrees>(units::kPi / 2);
       } else if (y_ < 0) {
-        angle = units::ConvertAngle(
-            3 * (units::kPi / 2),
-            units::AngleConversionType::kRadiansToDegrees);
+        angle = units::Convert<units::Radians, units::Degrees>(
+            3 * (units::kPi / 2));
       } else {
         return angle;  // both x_ and y_ are zero, returns invalid answer
       }
@@ -45,9 +42,8 @@ double Vector2d::Angle(const bool& is_enabled_negative_angles) const {
       if (0 < x_) {
         angle = 0;
       } else if (x_ < 0) {
-        angle = units::ConvertAngle(
-            2 * (units::kPi / 2),
-            units::AngleConversionType::kRadiansToDegrees);
+        angle = units::Convert<units::Radians, units::Degrees>(
+            2 * (units::kPi / 2));
       } else {
         return angle;  // both x_ and y_ are zero, returns invalid answer
       }
@@ -56,23 +52,19 @@ double Vector2d::Angle(const bool& is_enabled_negative_angles) const {
     // selects the quadrant and calculate using arc tangent function
     if (0 <= y_) {
       if (0 <= x_) {  // quadrant I
-        angle = units::ConvertAngle(
-            std::atan(y_ / x_),
-            units::AngleConversionType::kRadiansToDegrees);
+        angle = units::Convert<units::Radians, units::Degrees>(
+            std::atan(y_ / x_));
       } else {  // quadrant II
-        angle = 180 - units::ConvertAngle(
-            std::abs(std::atan(y_ / x_)),
-            units::AngleConversionType::kRadiansToDegrees);
+        angle = 180 - units::Convert<units::Radians, units::Degrees>(
+            std::abs(std::atan(y_ / x_)));
       }
     } else {
       if (x_ <= 0) {  // quadrant III
-        angle = 180 + units::ConvertAngle(
-            std::abs(std::atan(y_ / x_)),
-            units::AngleConversionType::kRadiansToDegrees);
+        angle = 180 + units::Convert<units::Radians, units::Degrees>(
+            std::abs(std::atan(y_ / x_)));
       } else {  // quadrant IV
-        angle = 360 - units::ConvertAngle(
-            std::abs(std::atan(y_ / x_)),
-            units::AngleConversionType::kRadiansToDegrees);
+        angle = 360 - units::Convert<units::Radians, units::Degrees>(
+            std::abs(std::atan(y_ / x_)));
       }
     }
   }
@@ -89,27 +81,25 @@ double Vector2d::Magnitude() const {
   return sqrt(std::pow(x_, 2) + std::pow(y_, 2));
 }
 
-/// Converts the vector into the radial coordinate system (magnitude and angle)
-/// applies the angle rotation, and then converts back into cartesian
-/// components.
+/// The angle is converted to a sine and cosine pair, and the rotation matrix
+/// is applied directly.
 void Vector2d::Rotate(const double& angle_rotation) {
   // checks if rotation angle is zero (or near zero) and exits if so
   if (std::abs(angle_rotation) < 0.00005)
     return;
 
-  // defines in terms of radial coordinate system (magnitude and angle)
-  const double magnitude = Magnitude();
-  const double angle = Angle();
+  const double angle_radians =
+      units::Convert<units::Degrees, units::Radians>(angle_rotation);
+  RotateSinCos(std::sin(angle_radians), std::cos(angle_radians));
+}
 
-  // calculates new angle (rotation included)
-  const double angle_new = angle + angle_rotation;
+void Vector2d::RotateSinCos(const double& sin_rotation,
+                            const double& cos_rotation) {
+  const double x = x_;
+  const double y = y_;
 
-  // resolves back to new x and y cartesian components
-  const double angle_radians =
-      units::ConvertAngle(angle_new,
-                          units::AngleConversionType::kDegreesToRadians);
-  x_ = magnitude * std::cos(angle_radians);
-  y_ = magnitude * std::sin(angle_radians);
+  x_ = (x * cos_rotation) - (y * sin_rotation);
+  y_ = (x * sin_rotation) + (y * cos_rotation);
 }
 
 void Vector2d::Scale(const double& factor_scale) {
@@ -185,15 +175,25 @@ double Vector3d::Magnitude() const {
   return sqrt(std::pow(x_, 2) + std::pow(y_, 2) + std::pow(z_, 2));
 }
 
-/// The planar vector components are assigned to a 2D vector. The rotation is
-/// done using the Vector2d::Rotate function.
-/// \see Vector2d
+/// The angle is converted to a sine and cosine pair.
+/// \see Vector3d::RotateSinCos
 void Vector3d::Rotate(const Plane2dType& plane, const double& angle_rotation) {
   // checks if rotation angle is zero
   if (std::abs(angle_rotation) < 0.00005) {
     return;
   }
 
+  const double angle_radians =
+      units::Convert<units::Degrees, units::Radians>(angle_rotation);
+  RotateSinCos(plane, std::sin(angle_radians), std::cos(angle_radians));
+}
+
+/// The planar vector components are assigned to a 2D vector. The rotation is
+/// done using the Vector2d::RotateSinCos function.
+/// \see Vector2d
+void Vector3d::RotateSinCos(const Plane2dType& plane,
+                            const double& sin_rotation,
+                            const double& cos_rotation) {
   // creates a 2D vector of the planar components
   Vector2d vector_2d;
 
@@ -221,7 +221,7 @@ void Vector3d::Rotate(const Plane2dType& plane, const double& angle_rotation) {
   }
 
   // rotates the plane
-  vector_2d.Rotate(angle_rotation);
+  vector_2d.RotateSinCos(sin_rotation, cos_rotation);
 
   // assigns rotated 2D vector components to new planar components
   if (plane == Plane2dType::kXy) {
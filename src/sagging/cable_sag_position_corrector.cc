@@ -5,8 +5,81 @@
 
 #include <cmath>
 
+#include "models/transmissionline/catenary_functions.h"
 #include "models/transmissionline/catenary_solver.h"
 
+namespace {
+
+/// \brief Solves the horizontal tension that gives a back support tension.
+/// \param[in] tension_support
+///   The back support tension.
+/// \param[in] w
+///   The unit weight.
+/// \param[in] a
+///   The horizontal end point spacing.
+/// \param[in] b
+///   The vertical end point spacing.
+/// \param[in,out] tension_horizontal
+///   The horizontal tension. The input value is the initial guess.
+/// \param[out] slope
+///   The derivative of the back support tension with respect to the horizontal
+///   tension, at the solution.
+/// \return If the horizontal tension was solved.
+/// This uses a Newton iteration, so the initial guess must be on the same
+/// branch of the solution as the catenaries of interest (i.e. the tension
+/// increases with the horizontal tension). Steps that would make the
+/// horizontal tension zero or negative are halved until it stays positive.
+bool SolveTensionHorizontalFromSupport(const double& tension_support,
+                                       const double& w,
+                                       const double& a,
+                                       const double& b,
+                                       double* tension_horizontal,
+                                       double* slope) {
+  const Dual<double> kW(w);
+  const Dual<double> kA(a);
+  const Dual<double> kB(b);
+
+  double x = *tension_horizontal;
+  int iter = 0;
+  const int iter_max = 20;
+  const double precision = 1e-6;
+  while (iter < iter_max) {
+    // gets the back support tension and derivative
+    const Dual<double> h(x, 1);
+    const Dual<double> tension = catenary::Tension(
+        h, kW, catenary::PointEndLeftX(h, kW, kA, kB));
+
+    // stops if the support tension does not increase with horizontal tension
+    if ((0 < tension.derivative) == false) {
+      return false;
+    }
+
+    double step = (tension.value - tension_support) / tension.derivative;
+    if (std::isfinite(step) == false) {
+      return false;
+    }
+
+    // damps the step so the horizontal tension stays positive
+    while (x <= step) {
+      step = step / 2;
+    }
+
+    x = x - step;
+
+    iter++;
+
+    if (std::abs(step) < precision * x) {
+      *tension_horizontal = x;
+      *slope = tension.derivative;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace
+
 CableSagPositionCorrector::CableSagPositionCorrector() {
   linecable_ = nullptr;
   points_attachment_ = nullptr;
@@ -110,7 +183,9 @@ bool CableSagPositionCorrector::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE SAG POSITION CORRECTOR";
+  if (messages != nullptr) {
+    message.title = "CABLE SAG POSITION CORRECTOR";
+  }
 
   // validates linecable
   if (linecable_ == nullptr) {
@@ -190,41 +265,73 @@ double CableSagPositionCorrector::LengthCatenaries(
   return length;
 }
 
+/// The horizontal tension of each span is solved directly from the ahead
+/// support tension of the previous span. The derivative of each horizontal
+/// tension with respect to the starting horizontal tension is chained from
+/// span to span, so the total length derivative is known without solving
+/// additional points.
 bool CableSagPositionCorrector::SolvePulleyStateTensions(
-    const double& tension_horizontal_start) const {
+    const double& tension_horizontal_start,
+    Dual<double>* length) const {
   // initializes
-  CatenarySolver solver;
-  solver.set_position_target(0);
-  solver.set_type_target(CatenarySolver::TargetType::kTension);
-  solver.set_weight_unit(catenaries_pulleyed_[0].weight_unit());
+  *length = Dual<double>(0);
 
-  // adjusts the horizontal tension for every catenary
-  const Catenary3d* catenary_prev = nullptr;
+  // solves every catenary in the pulley state
+  // derivatives are with respect to the starting horizontal tension
+  Dual<double> tension_ahead_prev;
   const int kSize = catenaries_pulleyed_.size();
   for (int i = 0; i < kSize; i++) {
     // gets the catenary for the span of interest
     Catenary3d& catenary = catenaries_pulleyed_[i];
+    const CatenaryProjection projection = catenary.Projection();
+    const Dual<double> w(projection.weight_unit);
+    const Dual<double> a(projection.spacing_endpoints.x());
+    const Dual<double> b(projection.spacing_endpoints.y());
 
     // selects tension update method
+    Dual<double> h;
     if (i == 0) {
       // horizontal tension is already specified
-      catenary.set_tension_horizontal(tension_horizontal_start);
+      h = Dual<double>(tension_horizontal_start, 1);
     } else {
       // solves for the horizontal tension
       // back support tension of the current catenary is set to match the
       // ahead support tension of the previous catenary
-      solver.set_spacing_endpoints(catenary.spacing_endpoints());
-      solver.set_value_target(catenary_prev->Tension(1));
-
-      if (solver.Validate() == true) {
-        catenary.set_tension_horizontal(solver.TensionHorizontal());
-      } else {
-        return false;
+      // the previous catenary horizontal tension is the initial guess
+      double tension_horizontal = catenaries_pulleyed_[i - 1]
+                                  .tension_horizontal();
+      double slope = -999999;
+      if (SolveTensionHorizontalFromSupport(
+              tension_ahead_prev.value, w.value, a.value, b.value,
+              &tension_horizontal, &slope) == false) {
+        // falls back to the catenary solver
+        CatenarySolver solver;
+        solver.set_position_target(0);
+        solver.set_spacing_endpoints(catenary.spacing_endpoints());
+        solver.set_type_target(CatenarySolver::TargetType::kTension);
+        solver.set_value_target(tension_ahead_prev.value);
+        solver.set_weight_unit(catenary.weight_unit());
+        if (solver.Validate() == false) {
+          return false;
+        }
+
+        tension_horizontal = solver.TensionHorizontal();
+        const Dual<double> h_solver(tension_horizontal, 1);
+        slope = catenary::Tension(
+            h_solver, w, catenary::PointEndLeftX(h_solver, w, a, b))
+            .derivative;
       }
+
+      h = Dual<double>(tension_horizontal,
+                       tension_ahead_prev.derivative / slope);
     }
 
-    // increments
-    catenary_prev = &catenary;
+    catenary.set_tension_horizontal(h.value);
+
+    // gets the ahead support tension and length
+    tension_ahead_prev = catenary::Tension(
+        h, w, catenary::PointEndRightX(h, w, a, b));
+    *length += catenary::Length(h, w, a, b);
   }
 
   return true;
@@ -287,6 +394,11 @@ bool CableSagPositionCorrector::UpdateClippedState() const {
   return true;
 }
 
+/// The total pulley state length decreases as the starting horizontal
+/// tension increases. The starting horizontal tension is solved with a Newton
+/// iteration, using the chained length derivative. Steps that would make the
+/// starting horizontal tension zero or negative are halved until it stays
+/// positive.
 bool CableSagPositionCorrector::UpdatePulleyState() const {
   // initializes
   catenaries_pulleyed_ = catenaries_clipped_;
@@ -296,80 +408,48 @@ bool CableSagPositionCorrector::UpdatePulleyState() const {
   // y = summed catenary lengths (pulley model)
 
   // initializes target
-  double target_solution = length_clipped_;
-
-  // declares and initializes left point
-  Point2d<double> point_left;
-  point_left.x = catenaries_pulleyed_[0].tension_horizontal();
-  if (SolvePulleyStateTensions(point_left.x) == false) {
-    return false;
-  }
-  point_left.y = LengthCatenaries(catenaries_pulleyed_);
-
-  // declares and initializes right point
-  Point2d<double> point_right;
-  point_right.x = point_left.x * 1.10;
-  if (SolvePulleyStateTensions(point_right.x) == false) {
-    return false;
-  }
-  point_right.y = LengthCatenaries(catenaries_pulleyed_);
+  const double target_solution = length_clipped_;
 
-  // declares and initializes current point
-  Point2d<double> point_current;
+  // initializes current point at the clipped horizontal tension
+  double x = catenaries_pulleyed_[0].tension_horizontal();
+  Dual<double> y;
 
-  // adjusts the pulleyed catenaries until the length is within tolerance
+  // adjusts the pulleyed catenaries until the newton step is within tolerance
   int iter = 0;
-  const double kPrecisionX = 0.1;
-  const double kPrecisionY = 0.01;
+  const double kPrecisionX = 0.01;
   const int kIterMax = 100;
-  while (kPrecisionX < std::abs(point_left.x - point_right.x)
-      && (kPrecisionY < std::abs(point_current.y - target_solution))
-      && (iter <= kIterMax)) {
-    // gets current point x value using left and right points
-    // calculates tangent line between points, extrapolates using line
-    double slope_line = (point_right.y - point_left.y)
-                        / (point_right.x - point_left.x);
-
-    point_current.x = point_left.x
-                      + ((target_solution - point_left.y) / slope_line);
-
-    // gets current point y value
-    if (SolvePulleyStateTensions(point_current.x) == false) {
+  while (iter < kIterMax) {
+    // gets current point length and derivative
+    if (SolvePulleyStateTensions(x, &y) == false) {
       return false;
     }
 
-    point_current.y = LengthCatenaries(catenaries_pulleyed_);
-
-    // updates either left or right point based on current point
-    if (point_current.x < point_left.x) {
-      point_right.x = point_left.x;
-      point_right.y = point_left.y;
-      point_left.x = point_current.x;
-      point_left.y = point_current.y;
-
-    } else if ((point_left.x < point_current.x)
-        && (point_current.x < point_right.x)) {
-      if (point_current.y < target_solution) {
-        point_right.x = point_current.x;
-        point_right.y = point_current.y;
-      } else if (target_solution < point_current.y) {
-        point_left.x = point_current.x;
-        point_left.y = point_current.y;
-      }
+    // gets the next point using a newton step
+    double step = (y.value - target_solution) / y.derivative;
+    if (std::isfinite(step) == false) {
+      return false;
+    }
 
-    } else if (point_right.x < point_current.x) {
-      point_left.x = point_right.x;
-      point_left.y = point_right.y;
-      point_right.x = point_current.x;
-      point_right.y = point_current.y;
+    // damps the step so the horizontal tension stays positive
+    while (x <= step) {
+      step = step / 2;
     }
 
+    x = x - step;
     iter++;
+
+    // solves the final point if the step is small enough
+    if (std::abs(step) < kPrecisionX) {
+      if (SolvePulleyStateTensions(x, &y) == false) {
+        return false;
+      }
+      break;
+    }
   }
 
   // returns success status
   if (iter < kIterMax) {
-    length_pulleyed_ = point_current.y;
+    length_pulleyed_ = y.value;
     return true;
   } else {
     return false;
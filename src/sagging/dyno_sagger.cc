@@ -26,7 +26,9 @@ bool DynoSagger::Validate(const bool& is_included_warnings,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "DYNO SAGGER";
+  if (messages != nullptr) {
+    message.title = "DYNO SAGGER";
+  }
 
   // validates catenary
   if (catenary_.Validate(is_included_warnings, messages) == false) {
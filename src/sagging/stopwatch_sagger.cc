@@ -32,7 +32,9 @@ bool StopwatchSagger::Validate(const bool& is_included_warnings,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "STOPWATCH SAGGER";
+  if (messages != nullptr) {
+    message.title = "STOPWATCH SAGGER";
+  }
 
   // validates catenary
   if (catenary_.Validate(is_included_warnings, messages) == false) {
@@ -3,9 +3,190 @@
 
 #include "models/sagging/transit_sagger.h"
 
-#include <vector>
+#include <algorithm>
+#include <cmath>
 
 #include "models/base/helper.h"
+#include "models/transmissionline/catenary_functions.h"
+
+namespace {
+
+/// \par OVERVIEW
+///
+/// This struct maps the 2D catenary x coordinate to the 3D catenary point.
+///
+/// The 3D point is the rotated chord point plus the rotated chord-to-curve
+/// offset. The chord point is linear in the 2D x coordinate, and the offset is
+/// purely vertical in the 2D catenary plane, so
+///   point(x) = (x - x_left) * q + offset(x) * n
+/// where q and n are constant vectors. This is the same mapping as
+/// Catenary3d::Coordinate, but it is evaluated without converting to and
+/// from position fractions.
+struct TransitCurve {
+  /// \var c
+  ///   The catenary constant.
+  double c;
+
+  /// \var n
+  ///   The 3D direction of the 2D vertical offset.
+  Vector3d n;
+
+  /// \var point_transit
+  ///   The transit point.
+  Point3d<double> point_transit;
+
+  /// \var q
+  ///   The 3D chord point per unit 2D x coordinate.
+  Vector3d q;
+
+  /// \var slope_chord
+  ///   The 2D chord slope.
+  double slope_chord;
+
+  /// \var x_left
+  ///   The 2D left end point x coordinate.
+  double x_left;
+
+  /// \var x_right
+  ///   The 2D right end point x coordinate.
+  double x_right;
+
+  /// \var y_left
+  ///   The 2D left end point y coordinate.
+  double y_left;
+};
+
+/// \brief Gets the vector from the transit to a catenary point.
+/// \param[in] curve
+///   The curve.
+/// \param[in] x
+///   The 2D x coordinate.
+/// \param[out] d
+///   The vector from the transit to the catenary point.
+/// \param[out] d1
+///   The first derivative of the vector with respect to x.
+/// \param[out] d2
+///   The second derivative of the vector with respect to x.
+void VectorFromTransit(const TransitCurve& curve, const double& x,
+                       double d[3], double d1[3], double d2[3]) {
+  // gets the 2D offset from the chord and its derivatives
+  const double s = x - curve.x_left;
+  const double u = x / curve.c;
+  const double offset = curve.c * (std::cosh(u) - 1) - curve.y_left
+                        - (s * curve.slope_chord);
+  const double offset1 = std::sinh(u) - curve.slope_chord;
+  const double offset2 = std::cosh(u) / curve.c;
+
+  // maps to 3D
+  const double q[3] = {curve.q.x(), curve.q.y(), curve.q.z()};
+  const double n[3] = {curve.n.x(), curve.n.y(), curve.n.z()};
+  const double t[3] = {curve.point_transit.x, curve.point_transit.y,
+                       curve.point_transit.z};
+  for (int i = 0; i < 3; i++) {
+    d[i] = (s * q[i]) + (offset * n[i]) - t[i];
+    d1[i] = q[i] + (offset1 * n[i]);
+    d2[i] = offset2 * n[i];
+  }
+}
+
+/// \brief Gets the tangent of the vertical angle from the transit.
+/// \param[in] curve
+///   The curve.
+/// \param[in] x
+///   The 2D x coordinate.
+/// \return The tangent of the vertical angle from the transit to the catenary
+///   point. This increases with the vertical angle.
+double SlopeFromTransit(const TransitCurve& curve, const double& x) {
+  double d[3], d1[3], d2[3];
+  VectorFromTransit(curve, x, d, d1, d2);
+  return d[2] / std::sqrt((d[0] * d[0]) + (d[1] * d[1]));
+}
+
+/// \brief Gets the tangency condition.
+/// \param[in] curve
+///   The curve.
+/// \param[in] x
+///   The 2D x coordinate.
+/// \param[out] f
+///   The tangency condition, which is zero where the sight line from the
+///   transit is tangent to the catenary. This has the same sign as the
+///   derivative of the vertical angle with respect to x.
+/// \param[out] df
+///   The derivative of the tangency condition with respect to x.
+void Tangency(const TransitCurve& curve, const double& x,
+              double* f, double* df) {
+  double d[3], d1[3], d2[3];
+  VectorFromTransit(curve, x, d, d1, d2);
+
+  // the vertical angle tangent is dz / h, where h is the horizontal distance
+  // f is the derivative numerator, which is the derivative multiplied by h^3
+  const double h2 = (d[0] * d[0]) + (d[1] * d[1]);
+  const double m = (d[0] * d1[0]) + (d[1] * d1[1]);
+  *f = (d1[2] * h2) - (d[2] * m);
+  *df = (d2[2] * h2) + (d1[2] * m)
+        - (d[2] * ((d1[0] * d1[0]) + (d1[1] * d1[1])
+                   + (d[0] * d2[0]) + (d[1] * d2[1])));
+}
+
+/// \brief Solves the tangent point within a bracket.
+/// \param[in] curve
+///   The curve.
+/// \param[in] x_lower
+///   The lower x boundary. The tangency condition must be negative here.
+/// \param[in] x_upper
+///   The upper x boundary. The tangency condition must be positive here.
+/// \param[in] x_guess
+///   The initial guess.
+/// \return The x coordinate of the tangent point.
+/// This is a Newton iteration that falls back to bisection whenever a step
+/// leaves the bracket, so it always converges.
+double SolveTangentPoint(const TransitCurve& curve,
+                         double x_lower,
+                         double x_upper,
+                         const double& x_guess) {
+  const double precision = 1e-12 * (curve.x_right - curve.x_left);
+
+  double x = x_guess;
+  if ((x <= x_lower) || (x_upper <= x)) {
+    x = (x_lower + x_upper) / 2;
+  }
+
+  int iter = 0;
+  const int iter_max = 100;
+  while (iter < iter_max) {
+    double f = -999999;
+    double df = -999999;
+    Tangency(curve, x, &f, &df);
+
+    // updates the bracket
+    if (f == 0) {
+      break;
+    } else if (f < 0) {
+      x_lower = x;
+    } else {
+      x_upper = x;
+    }
+
+    // takes a newton step, or bisects if the step leaves the bracket
+    double x_next = x - (f / df);
+    if ((std::isfinite(x_next) == false)
+        || (x_next <= x_lower) || (x_upper <= x_next)) {
+      x_next = (x_lower + x_upper) / 2;
+    }
+
+    const double step = x_next - x;
+    x = x_next;
+    iter++;
+
+    if ((std::abs(step) < precision) || (x_upper - x_lower < precision)) {
+      break;
+    }
+  }
+
+  return x;
+}
+
+}  // namespace
 
 TransitSagger::TransitSagger() {
   catenary_ = Catenary3d();
@@ -91,12 +272,53 @@ Point3d<double> TransitSagger::PointTarget() const {
   return point;
 }
 
+bool TransitSagger::SolveSetups(
+    const std::vector<Catenary3d>& catenaries,
+    const std::vector<Point3d<double>>& points_transit,
+    std::vector<TransitSetup>* setups) {
+  // initializes
+  setups->clear();
+  if (catenaries.size() != points_transit.size()) {
+    return false;
+  }
+
+  const int kSize = catenaries.size();
+  setups->resize(kSize);
+
+  // solves every span with the same sagger
+  bool is_solved = true;
+  TransitSagger sagger;
+  for (int i = 0; i < kSize; i++) {
+    TransitSetup& setup = (*setups)[i];
+
+    sagger.set_catenary(catenaries[i]);
+    sagger.set_point_transit(points_transit[i]);
+    if (sagger.Update() == false) {
+      setup.angle_low = -999999;
+      setup.factor_control = -999999;
+      setup.point_catenary_low = Point3d<double>();
+      setup.point_target = Point3d<double>();
+      is_solved = false;
+      continue;
+    }
+
+    setup.angle_low = sagger.AngleLow();
+    setup.factor_control = sagger.FactorControl();
+    setup.point_catenary_low = sagger.PointCatenaryLow();
+    setup.point_target = sagger.PointTarget();
+  }
+
+  return is_solved;
+}
+
 bool TransitSagger::Validate(const bool& is_included_warnings,
                              std::list<ErrorMessage>* messages) const {
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "TRANSIT SAGGER";
+  if (messages != nullptr) {
+    message.title = "TRANSIT SAGGER";
+  }
 
   // validates catenary
   if (catenary_.Validate(is_included_warnings, messages) == false) {
@@ -186,38 +408,6 @@ bool TransitSagger::IsUpdated() const {
   return is_updated_ == true;
 }
 
-double TransitSagger::PositionCatenaryLowAngle(
-    const double& position_back,
-    const double& position_ahead,
-    const int& num_points) const {
-  // creates a set of position fraction points over the specified range
-  const double precision = (position_ahead - position_back) / (num_points - 1);
-
-  std::vector<double> positions(num_points);
-  for (int i = 0; i < num_points; i++) {
-    positions[i] = position_back  + (i * precision);
-  }
-
-  // calculates a set of catenary points for each position
-  std::vector<Point3d<double>> points(num_points);
-  for (int i = 0; i < num_points; i++) {
-    points[i] = catenary_.Coordinate(positions[i]);
-  }
-
-  // calculates the angle from horizontal and caches if needed
-  double angle_low = 999999;
-  int index_low = -9999;
-  for (int i = 0; i < num_points; i++) {
-    const double angle = AngleVertical(point_transit_, points[i]);
-    if (angle < angle_low) {
-      angle_low = angle;
-      index_low = i;
-    }
-  }
-
-  return positions[index_low];
-}
-
 bool TransitSagger::Update() const {
   // updates the low angle catenary position
   is_updated_ = UpdatePointCatenaryLow();
@@ -243,45 +433,125 @@ bool TransitSagger::UpdateAngleLow() const {
   return helper::Round(angle_low_, 0) != -90;
 }
 
+/// The lowest angle point is where the sight line from the transit is tangent
+/// to the catenary. The catenary is split at the transit x coordinate, and the
+/// tangent point on each side is solved with a Newton iteration seeded from a
+/// parabolic approximation of the catenary. The lower of the two tangent
+/// points is the solution.
 bool TransitSagger::UpdatePointCatenaryLow() const {
   // initializes
-  const int kNumPoints = 11;
-  double position_back = 0.0;
-  double position_ahead = 1.0;
-  double tolerance = (position_ahead - position_back) / 2;
-  double position = -999999;
-
-  int i = 0;
-  while ((0.00001 < tolerance) && (i < 10)) {
-    // calculates a new position
-    position = PositionCatenaryLowAngle(position_back, position_ahead,
-                                        kNumPoints);
-
-    // calculates the solution tolerance
-    tolerance = (position_ahead - position_back) / (kNumPoints - 1);
-
-    // adjusts the back position
-    position_back = position - tolerance;
-    if (position_back < 0) {
-      position_back = 0;
+  position_low_ = -999999;
+  point_catenary_low_ = Point3d<double>();
+
+  // gets the 2D catenary
+  const CatenaryProjection projection = catenary_.Projection();
+  const double a = projection.spacing_endpoints.x();
+  const double b = projection.spacing_endpoints.y();
+  const double w = projection.weight_unit;
+  const double h = catenary_.tension_horizontal();
+
+  // builds the curve mapping, using the same rotations as the catenary
+  TransitCurve curve;
+  curve.c = h / w;
+  curve.point_transit = point_transit_;
+  curve.slope_chord = b / a;
+  curve.x_left = catenary::PointEndLeftX(h, w, a, b);
+  curve.x_right = catenary::PointEndRightX(h, w, a, b);
+  curve.y_left = catenary::CoordinateY(h, w, curve.x_left);
+
+  curve.q = Vector3d(1, 0, curve.slope_chord);
+  curve.q.RotateSinCos(Plane2dType::kXz, projection.sin_rotation_spacing,
+                       projection.cos_rotation_spacing);
+
+  curve.n = Vector3d(0, 0, 1);
+  curve.n.RotateSinCos(Plane2dType::kXz, projection.sin_rotation_spacing,
+                       projection.cos_rotation_spacing);
+  curve.n.RotateSinCos(Plane2dType::kYz, projection.sin_rotation_swing,
+                       projection.cos_rotation_swing);
+
+  // solves the x coordinate where the catenary passes the transit
+  double x_split = curve.x_left;
+  if (curve.q.x() * (curve.x_right - curve.x_left) <= point_transit_.x) {
+    x_split = curve.x_right;
+  } else if (0 < point_transit_.x) {
+    x_split = curve.x_left + (point_transit_.x / curve.q.x());
+    for (int iter = 0; iter < 10; iter++) {
+      double d[3], d1[3], d2[3];
+      VectorFromTransit(curve, x_split, d, d1, d2);
+      const double step = d[0] / d1[0];
+      x_split = x_split - step;
+      if (std::abs(step) < 1e-9 * a) {
+        break;
+      }
+    }
+    x_split = std::max(curve.x_left, std::min(curve.x_right, x_split));
+  }
+
+  // gets a parabolic approximation of the catenary in the x-z plane
+  const double a3 = catenary_.spacing_endpoints().x();
+  const double b3 = catenary_.spacing_endpoints().z();
+  const double sag = catenary::Sag(h, w, a, b);
+  const double alpha = 4 * sag / std::pow(a3, 2);
+  const double beta = (b3 / a3) - (4 * sag / a3);
+  const double discriminant = std::pow(point_transit_.x, 2)
+      + (((beta * point_transit_.x) - point_transit_.z) / alpha);
+  const double root = std::sqrt(std::max(0.0, discriminant));
+
+  // solves the tangent point on each side of the transit
+  // the vertical angle decreases away from the transit towards the tangent
+  // point on each side, so the transit side of each bracket is given the sign
+  // of the tangency condition there
+  double x_low = -999999;
+  double slope_low = 999999;
+  for (int side = 0; side < 2; side++) {
+    double x_lower = -999999;
+    double x_upper = -999999;
+    double f_lower = -999999;
+    double f_upper = -999999;
+    double df = -999999;
+    double x_guess = -999999;
+    if (side == 0) {
+      // looking back from the transit
+      x_lower = curve.x_left;
+      x_upper = x_split;
+      Tangency(curve, x_lower, &f_lower, &df);
+      f_upper = 1;
+      x_guess = curve.x_left + ((point_transit_.x - root) / curve.q.x());
+    } else {
+      // looking ahead from the transit
+      x_lower = x_split;
+      x_upper = curve.x_right;
+      f_lower = -1;
+      Tangency(curve, x_upper, &f_upper, &df);
+      x_guess = curve.x_left + ((point_transit_.x + root) / curve.q.x());
+    }
+
+    // checks for a tangent point within the bracket
+    if ((x_upper <= x_lower) || (0 <= f_lower) || (f_upper <= 0)) {
+      continue;
     }
 
-    // adjusts the ahead position
-    position_ahead = position + tolerance;
-    if (1 < position_ahead) {
-      position_ahead = 1;
+    const double x = SolveTangentPoint(curve, x_lower, x_upper, x_guess);
+    const double slope = SlopeFromTransit(curve, x);
+    if (slope < slope_low) {
+      x_low = x;
+      slope_low = slope;
     }
   }
 
-  // returns success status
-  if ((position == 0) || (position == 1)) {
-    // low point wasn't found because the position matches an end point
-    position_low_ = -999999;
-    point_catenary_low_ = Point3d<double>();
+  // checks if a tangent point was found, and that it is lower than both
+  // catenary end points
+  if ((x_low == -999999)
+      || (SlopeFromTransit(curve, curve.x_left) <= slope_low)
+      || (SlopeFromTransit(curve, curve.x_right) <= slope_low)) {
     return false;
-  } else {
-    position_low_ = position;
-    point_catenary_low_ = catenary_.Coordinate(position_low_);
-    return true;
   }
+
+  // converts to a position fraction
+  position_low_ =
+      (catenary::LengthFromOrigin(h, w, x_low)
+       - catenary::LengthFromOrigin(h, w, curve.x_left))
+      / catenary::Length(h, w, a, b);
+  point_catenary_low_ = catenary_.Coordinate(position_low_);
+  return true;
 }
@@ -37,6 +37,14 @@ double CableComponentElongationModel::Load(const double& strain) const {
               strain);
 }
 
+/// The derivative is solved with the chain rule, using the slope at the
+/// strain.
+Dual<double> CableComponentElongationModel::Load(
+    const Dual<double>& strain) const {
+  return Dual<double>(Load(strain.value),
+                      Slope(strain.value) * strain.derivative);
+}
+
 std::vector<Point2d<double>> CableComponentElongationModel::PointsRegions()
     const {
   // updates class if necessary
@@ -69,6 +77,14 @@ double CableComponentElongationModel::Strain(const double& load) const {
                 load);
 }
 
+/// The strain is solved iteratively, so the derivative is solved with the
+/// inverse function rule instead of differentiating the iterations.
+Dual<double> CableComponentElongationModel::Strain(
+    const Dual<double>& load) const {
+  const double strain = Strain(load.value);
+  return Dual<double>(strain, load.derivative / Slope(strain));
+}
+
 double CableComponentElongationModel::StrainThermal() const {
   // updates class if necessary
   if ((IsUpdated() == false) && (Update() == false)) {
@@ -84,7 +100,9 @@ bool CableComponentElongationModel::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE COMPONENT ELONGATION MODEL";
+  if (messages != nullptr) {
+    message.title = "CABLE COMPONENT ELONGATION MODEL";
+  }
 
   // validates component
   if (component_ == nullptr) {
@@ -812,7 +830,9 @@ bool CableComponentElongationModel::ValidatePolynomialOrigin(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE COMPONENT ELONGATION MODEL";
+  if (messages != nullptr) {
+    message.title = "CABLE COMPONENT ELONGATION MODEL";
+  }
 
   // exits if warnings are not included
   if (is_included_warnings == false) {
@@ -857,7 +877,9 @@ bool CableComponentElongationModel::ValidatePolynomialShape(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE COMPONENT ELONGATION MODEL";
+  if (messages != nullptr) {
+    message.title = "CABLE COMPONENT ELONGATION MODEL";
+  }
 
   // exits if warnings are not included
   if (is_included_warnings == false) {
@@ -54,6 +54,15 @@ double CableElongationModel::Load(
   return load;
 }
 
+/// The derivative is solved with the chain rule, using the slope at the
+/// strain.
+Dual<double> CableElongationModel::Load(
+    const CableElongationModel::ComponentType& type_component,
+    const Dual<double>& strain) const {
+  return Dual<double>(Load(type_component, strain.value),
+                      Slope(type_component, strain.value) * strain.derivative);
+}
+
 double CableElongationModel::Slope(
     const CableElongationModel::ComponentType& type_component,
     const double& strain) const {
@@ -94,13 +103,25 @@ double CableElongationModel::Strain(
   return strain;
 }
 
+/// The strain is solved iteratively, so the derivative is solved with the
+/// inverse function rule instead of differentiating the iterations.
+Dual<double> CableElongationModel::Strain(
+    const CableElongationModel::ComponentType& type_component,
+    const Dual<double>& load) const {
+  const double strain = Strain(type_component, load.value);
+  return Dual<double>(strain,
+                      load.derivative / Slope(type_component, strain));
+}
+
 bool CableElongationModel::Validate(
     const bool& is_included_warnings,
     std::list<ErrorMessage>* messages) const {
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE ELONGATION MODEL";
+  if (messages != nullptr) {
+    message.title = "CABLE ELONGATION MODEL";
+  }
 
   // validates cable
   if (cable_ == nullptr) {
@@ -535,7 +556,9 @@ bool CableElongationModel::ValidateComponentsStrainLimit(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE ELONGATION MODEL";
+  if (messages != nullptr) {
+    message.title = "CABLE ELONGATION MODEL";
+  }
 
   // exits if warnings are not included
   if (is_included_warnings == false) {
@@ -602,7 +625,9 @@ bool CableElongationModel::ValidateComponentsStrainUnloaded(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE ELONGATION MODEL";
+  if (messages != nullptr) {
+    message.title = "CABLE ELONGATION MODEL";
+  }
 
   // exits if warnings are not included
   if (is_included_warnings == false) {
@@ -16,7 +16,9 @@ bool CableState::Validate(const bool& /*is_included_warnings*/,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE STATE";
+  if (messages != nullptr) {
+    message.title = "CABLE STATE";
+  }
 
   // validates temperature
   if (temperature < -100) {
@@ -51,7 +53,9 @@ bool CableStretchState::Validate(const bool& is_included_warnings,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE STRETCH STATE";
+  if (messages != nullptr) {
+    message.title = "CABLE STRETCH STATE";
+  }
 
   // validates parent struct
   CableState::Validate(is_included_warnings, messages);
@@ -5,6 +5,35 @@
 
 #include <cmath>
 
+namespace {
+
+/// \brief Gets the length after a strain transition.
+/// \param[in] length_start
+///   The length at the start state.
+/// \param[in] strain_start
+///   The strain at the start state.
+/// \param[in] strain_finish
+///   The strain at the finish state.
+/// \return The length at the finish state.
+template <class T>
+T LengthStrained(const T& length_start, const T& strain_start,
+                 const T& strain_finish) {
+  using std::abs;
+
+  // solves for finish length
+  const T strain_transition = strain_finish - strain_start;
+
+  // selects variant of strain equation depending on whether transition
+  // strain is positive or negative
+  if (strain_transition < 0) {
+    return length_start / (1 + abs(strain_transition));
+  } else {
+    return length_start * (1 + strain_transition);
+  }
+}
+
+}  // namespace
+
 CableStrainer::CableStrainer() {
   length_start_ = -999999;
   load_finish_ = -999999;
@@ -29,16 +58,33 @@ double CableStrainer::LengthFinish() const {
   const double strain_finish = model_elongation_finish_->Strain(
       CableElongationModel::ComponentType::kCombined, load_finish_);
 
-  // solves for finish length
-  const double strain_transition = strain_finish - strain_start;
+  return LengthStrained(length_start_, strain_start, strain_finish);
+}
 
-  // selects variant of strain equation depending on whether transition
-  // strain is positive or negative
-  if (strain_transition < 0) {
-    return length_start_ / (1 + std::abs(strain_transition));
-  } else {
-    return length_start_ * (1 + strain_transition);
-  }
+/// The start length and load are treated as constants.
+Dual<double> CableStrainer::LengthFinish(
+    const Dual<double>& load_finish) const {
+  // gets the start strain
+  const double strain_start = model_elongation_start_->Strain(
+      CableElongationModel::ComponentType::kCombined, load_start_);
+
+  return LengthFinish(load_finish, strain_start);
+}
+
+Dual<double> CableStrainer::LengthFinish(const Dual<double>& load_finish,
+                                         const double& strain_start) const {
+  // gets the finish strain
+  const Dual<double> strain_finish = model_elongation_finish_->Strain(
+      CableElongationModel::ComponentType::kCombined, load_finish);
+
+  return LengthStrained(Dual<double>(length_start_),
+                        Dual<double>(strain_start), strain_finish);
+}
+
+double CableStrainer::LengthFromStrains(const double& length_start,
+                                        const double& strain_start,
+                                        const double& strain_finish) {
+  return LengthStrained(length_start, strain_start, strain_finish);
 }
 
 bool CableStrainer::Validate(const bool& is_included_warnings,
@@ -46,7 +92,9 @@ bool CableStrainer::Validate(const bool& is_included_warnings,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE STRAINER";
+  if (messages != nullptr) {
+    message.title = "CABLE STRAINER";
+  }
 
   // validates length-start
   if (length_start_ <= 0) {
@@ -4,15 +4,20 @@
 #include "models/sagtension/catenary_cable_reloader.h"
 
 #include <cmath>
+#include <limits>
 
 #include "models/sagtension/catenary_cable_unloader.h"
+#include "models/transmissionline/catenary_functions.h"
 
 CatenaryCableReloader::CatenaryCableReloader() {
   catenary_ = nullptr;
   model_reference_ = nullptr;
   model_reloaded_ = nullptr;
+  tension_horizontal_guess_ = -999999;
   weight_unit_reloaded_ = nullptr;
 
+  strain_start_ = -999999;
+  weight_unit_2d_ = -999999;
   is_updated_catenary_reloaded_ = false;
 }
 
@@ -43,6 +48,10 @@ double CatenaryCableReloader::LengthUnloaded() const {
   return unloader.LengthUnloaded();
 }
 
+bool CatenaryCableReloader::Solve() const {
+  return (IsUpdated() == true) || (Update() == true);
+}
+
 double CatenaryCableReloader::TensionHorizontal() const {
   // updates class if necessary
   if ((IsUpdated() == false) && (Update() == false)) {
@@ -58,7 +67,9 @@ bool CatenaryCableReloader::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CATENARY CABLE RELOADER";
+  if (messages != nullptr) {
+    message.title = "CATENARY CABLE RELOADER";
+  }
 
   // validates catenary
   if (catenary_ == nullptr) {
@@ -182,6 +193,13 @@ void CatenaryCableReloader::set_model_reloaded(
   is_updated_catenary_reloaded_ = false;
 }
 
+void CatenaryCableReloader::set_tension_horizontal_guess(
+    const double& tension_horizontal_guess) {
+  tension_horizontal_guess_ = tension_horizontal_guess;
+
+  is_updated_catenary_reloaded_ = false;
+}
+
 void CatenaryCableReloader::set_weight_unit_reloaded(
     const Vector3d* weight_unit_reloaded) {
   weight_unit_reloaded_ = weight_unit_reloaded;
@@ -189,6 +207,10 @@ void CatenaryCableReloader::set_weight_unit_reloaded(
   is_updated_catenary_reloaded_ = false;
 }
 
+double CatenaryCableReloader::tension_horizontal_guess() const {
+  return tension_horizontal_guess_;
+}
+
 const Vector3d* CatenaryCableReloader::weight_unit_reloaded() const {
   return weight_unit_reloaded_;
 }
@@ -199,7 +221,12 @@ bool CatenaryCableReloader::InitializeReloadedCatenary() const {
   catenary_reloaded_.set_tension_horizontal(catenary_->tension_horizontal());
   catenary_reloaded_.set_weight_unit(*weight_unit_reloaded_);
 
-  return true;
+  // gets the 2D catenary plane from the reloaded catenary
+  const CatenaryProjection projection = catenary_reloaded_.Projection();
+  spacing_endpoints_2d_ = projection.spacing_endpoints;
+  weight_unit_2d_ = projection.weight_unit;
+
+  return 0 < weight_unit_2d_;
 }
 
 bool CatenaryCableReloader::InitializeStrainer() const {
@@ -208,6 +235,10 @@ bool CatenaryCableReloader::InitializeStrainer() const {
   strainer_.set_model_finish(model_reloaded_);
   strainer_.set_model_start(model_reference_);
 
+  // the start state is constant during the solution
+  strain_start_ = model_reference_->Strain(
+      CableElongationModel::ComponentType::kCombined, strainer_.load_start());
+
   return true;
 }
 
@@ -215,23 +246,48 @@ bool CatenaryCableReloader::IsUpdated() const {
   return is_updated_catenary_reloaded_ == true;
 }
 
-double CatenaryCableReloader::LengthDifference(
-    const double& tension_horizontal) const {
-  UpdateReloadedCatenaryAndStrainer(tension_horizontal);
+/// The catenary length and average tension are calculated the same way as the
+/// catenary class, so the values match the reloaded catenary exactly. The
+/// average tension uses the default number of evenly spaced points.
+Dual<double> CatenaryCableReloader::LengthDifference(
+    const Dual<double>& tension_horizontal) const {
+  const Dual<double>& h = tension_horizontal;
+  const Dual<double> w(weight_unit_2d_);
+  const Dual<double> a(spacing_endpoints_2d_.x());
+  const Dual<double> b(spacing_endpoints_2d_.y());
+
+  // gets the catenary lengths
+  const Dual<double> length_left = catenary::LengthFromOrigin(
+      h, w, catenary::PointEndLeftX(h, w, a, b));
+  const Dual<double> length_catenary = catenary::LengthFromOrigin(
+      h, w, catenary::PointEndRightX(h, w, a, b)) - length_left;
+
+  // gets the average tension using evenly spaced points
+  const int kNumPoints = 100;
+  Dual<double> sum(0);
+  for (int iter = 0; iter <= kNumPoints; iter++) {
+    const double position_fraction = iter / static_cast<double>(kNumPoints);
+    const Dual<double> length_from_origin =
+        position_fraction * length_catenary + length_left;
+    const Dual<double> x = catenary::CoordinateX(h, w, length_from_origin);
+    sum += catenary::Tension(h, w, x);
+  }
+  const Dual<double> tension_average = sum / (kNumPoints + 1);
 
-  const double length_catenary = catenary_reloaded_.Length();
-  const double length_cable = strainer_.LengthFinish();
+  // gets the cable length
+  const Dual<double> length_cable =
+      strainer_.LengthFinish(tension_average, strain_start_);
 
   return length_catenary - length_cable;
 }
 
 /// This function solves for the reloaded catenary horizontal tension by
 /// comparing the loaded length of the catenary and the cable strainer. The
-/// reloaded catenary horizontal tension is iterated until a solution is found.
-/// The lengths aren't held to a specific precision due to convergence accuracy
-/// and consistency problems, so the range between horizontal tension boundary
-/// points is tracked instead and is assumed solved when the range is small
-/// enough.
+/// length difference decreases as the horizontal tension increases, so the
+/// Newton iteration tracks the horizontal tension boundaries of the solution.
+/// If a Newton step is not finite or leaves the boundaries, the boundaries
+/// are expanded or bisected instead. The solution is assumed converged when
+/// the horizontal tension step is small enough.
 bool CatenaryCableReloader::SolveReloadedCatenaryTension() const {
   // x = horizontal tension
   // y = length difference  i.e.(catenary length - cable length)
@@ -239,85 +295,59 @@ bool CatenaryCableReloader::SolveReloadedCatenaryTension() const {
   InitializeReloadedCatenary();
   InitializeStrainer();
 
-  // uses an iterative routine to determine solution
-  // target y = 0, but is not tracked during iterations
-  const double target_solution = 0;
-
-  // declares and initializes left point
-  // lowest acceptable value for catenary
-  Point2d<double> point_left;
-  point_left.x = catenary_reloaded_.ConstantMinimum(
-      catenary_reloaded_.spacing_endpoints().Magnitude())
-      * catenary_reloaded_.weight_unit().Magnitude();
-  point_left.y = LengthDifference(point_left.x);
-
-  // declares and initializes right point
-  // 2x value of lowest point
-  Point2d<double> point_right;
-  point_right.x = 2 * point_left.x;
-  point_right.y = LengthDifference(point_right.x);
-
-  // declares and initializes current point
-  Point2d<double> point_current;
+  // initializes boundaries, the upper boundary is unknown
+  double x_lower = 0;
+  double x_upper = std::numeric_limits<double>::infinity();
+
+  // initializes current point at the guess, or the lowest acceptable value
+  // for catenary
+  double x = tension_horizontal_guess_;
+  if (x <= 0) {
+    x = catenary_reloaded_.ConstantMinimum(
+        catenary_reloaded_.spacing_endpoints().Magnitude())
+        * catenary_reloaded_.weight_unit().Magnitude();
+  }
+  Dual<double> y;
 
-  // iterates until range between x values is small enough
+  // iterates until the step is small enough
+  bool is_converged = false;
   int iter = 0;
   const int iter_max = 100;
   const double precision = 0.01;
-  while (precision < std::abs(point_left.x - point_right.x)
-         && (iter < iter_max)) {
-    // gets current point horizontal tension using left and right points
-    if ((point_left.y > target_solution)
-        && (target_solution > point_right.y)) {
-      // gets average of left and right points
-      point_current.x = (point_left.x + point_right.x) / 2;
+  while ((is_converged == false) && (iter < iter_max)) {
+    // gets the length difference and derivative at the current point
+    y = LengthDifference(Dual<double>(x, 1));
 
+    // updates boundaries
+    if (0 < y.value) {
+      x_lower = x;
     } else {
-      // calculates tangent line between points, extrapolate using line
-      double slope_line = (point_right.y - point_left.y)
-          / (point_right.x - point_left.x);
-
-      point_current.x = point_left.x + ((target_solution - point_left.y)
-          / slope_line);
+      x_upper = x;
     }
 
-    // gets current point length difference
-    point_current.y = LengthDifference(point_current.x);
-
-    // current point is left of left/right points
-    if (point_current.x < point_left.x) {
-      point_right.x = point_left.x;
-      point_right.y = point_left.y;
-
-      point_left.x = point_current.x;
-      point_left.y = point_current.y;
-
-    // current point is between left/right points
-    } else if ((point_left.x < point_current.x) &&
-        (point_current.x < point_right.x)) {
-      if (point_current.y < target_solution) {
-        point_right.x = point_current.x;
-        point_right.y = point_current.y;
-      } else if (target_solution < point_current.y) {
-        point_left.x = point_current.x;
-        point_left.y = point_current.y;
+    // gets the next point using a newton step
+    double x_next = x - (y.value / y.derivative);
+    if ((std::isfinite(x_next) == false)
+        || (x_next <= x_lower) || (x_upper <= x_next)) {
+      if (std::isinf(x_upper) == true) {
+        x_next = 2 * x;
+      } else {
+        x_next = (x_lower + x_upper) / 2;
       }
-
-    // current point is right of left/right points
-    } else if (point_right.x < point_current.x) {
-      point_left.x = point_right.x;
-      point_left.y = point_right.y;
-
-      point_right.x = point_current.x;
-      point_right.y = point_current.y;
     }
+
+    is_converged = std::abs(x_next - x) < precision;
+    x = x_next;
     iter++;
   }
 
+  // updates the reloaded catenary
+  catenary_reloaded_.set_tension_horizontal(x);
+
   // returns success status
-  if (iter < iter_max) {
+  if (is_converged == true) {
     // does one last sanity check to see if lengths match
-    return point_current.y < 0.1;
+    return std::abs(y.value) < 0.1;
   } else {
     return false;
   }
@@ -335,12 +365,3 @@ bool CatenaryCableReloader::Update() const {
   // if it reaches this point, update was successful
   return true;
 }
-
-bool CatenaryCableReloader::UpdateReloadedCatenaryAndStrainer(
-    const double& tension_horizontal) const {
-  // updates the reloaded catenary and strainer
-  catenary_reloaded_.set_tension_horizontal(tension_horizontal);
-  strainer_.set_load_finish(catenary_reloaded_.TensionAverage());
-
-  return true;
-}
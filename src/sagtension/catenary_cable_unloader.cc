@@ -22,7 +22,9 @@ bool CatenaryCableUnloader::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CATENARY CABLE UNLOADER";
+  if (messages != nullptr) {
+    message.title = "CATENARY CABLE UNLOADER";
+  }
 
   // validates catenary
   if (catenary_ == nullptr) {
@@ -0,0 +1,342 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/sagtension/line_cable_batch_unloader.h"
+
+#include <cmath>
+
+#include "models/sagtension/cable_strainer.h"
+
+LineCableBatchUnloader::LineCableBatchUnloader() {
+  condition_unloaded_ = CableConditionType::kNull;
+  pool_ = nullptr;
+  spacings_attachments_ = nullptr;
+  temperatures_unloaded_ = nullptr;
+
+  is_updated_lengths_unloaded_ = false;
+  is_updated_strains_ = false;
+}
+
+LineCableBatchUnloader::~LineCableBatchUnloader() {
+}
+
+double LineCableBatchUnloader::LengthUnloaded(
+    const int& index_temperature,
+    const int& index_spacing) const {
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return -999999;
+  }
+
+  // checks indexes
+  const int kSizeTemperatures = temperatures_unloaded_->size();
+  const int kSizeSpacings = spacings_attachments_->size();
+  if ((index_temperature < 0) || (kSizeTemperatures <= index_temperature)
+      || (index_spacing < 0) || (kSizeSpacings <= index_spacing)) {
+    return -999999;
+  }
+
+  return lengths_unloaded_[(index_temperature * kSizeSpacings)
+                           + index_spacing];
+}
+
+const std::vector<double>* LineCableBatchUnloader::LengthsUnloaded() const {
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return nullptr;
+  }
+
+  return &lengths_unloaded_;
+}
+
+bool LineCableBatchUnloader::Validate(
+    const bool& is_included_warnings,
+    std::list<ErrorMessage>* messages) const {
+  // initializes
+  bool is_valid = true;
+  ErrorMessage message;
+  if (messages != nullptr) {
+    message.title = "LINE CABLE BATCH UNLOADER";
+  }
+
+  // validates base class
+  if (LineCableLoaderBase::Validate(is_included_warnings, messages) == false) {
+    is_valid = false;
+  }
+
+  // validates condition-unloaded
+  if (condition_unloaded_ == CableConditionType::kNull) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid unloaded condition";
+      messages->push_back(message);
+    }
+  }
+
+  // validates spacings-attachments
+  if ((spacings_attachments_ == nullptr)
+      || (spacings_attachments_->empty() == true)) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid attachment spacings";
+      messages->push_back(message);
+    }
+  } else {
+    for (auto iter = spacings_attachments_->cbegin();
+         iter != spacings_attachments_->cend(); iter++) {
+      const Vector3d& spacing_attachments = *iter;
+
+      if (spacing_attachments.x() <= 0) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Invalid horizontal attachment spacing";
+          messages->push_back(message);
+        }
+      }
+
+      if (spacing_attachments.y() != 0) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Invalid transverse attachment spacing";
+          messages->push_back(message);
+        }
+      }
+
+      if (2000 < std::abs(spacing_attachments.z())) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Invalid vertical attachment spacing";
+          messages->push_back(message);
+        }
+      }
+    }
+  }
+
+  // validates temperatures-unloaded
+  if ((temperatures_unloaded_ == nullptr)
+      || (temperatures_unloaded_->empty() == true)) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid unloaded temperatures";
+      messages->push_back(message);
+    }
+  } else {
+    for (auto iter = temperatures_unloaded_->cbegin();
+         iter != temperatures_unloaded_->cend(); iter++) {
+      if (*iter < -50) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Invalid unloaded temperature";
+          messages->push_back(message);
+        }
+      }
+    }
+  }
+
+  // returns if errors are present
+  if (is_valid == false) {
+    return is_valid;
+  }
+
+  // validates update process
+  if (Update() == false) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "";
+      if (is_updated_strains_ == false) {
+        message.description = "Error updating class. Could not solve for "
+                              "strains.";
+      } else if (is_updated_lengths_unloaded_ == false) {
+        message.description = "Error updating class. Could not solve for "
+                              "unloaded cable lengths.";
+      }
+      messages->push_back(message);
+    }
+  }
+
+  return is_valid;
+}
+
+CableConditionType LineCableBatchUnloader::condition_unloaded() const {
+  return condition_unloaded_;
+}
+
+void LineCableBatchUnloader::set_condition_unloaded(
+    const CableConditionType& condition_unloaded) {
+  condition_unloaded_ = condition_unloaded;
+
+  is_updated_strains_ = false;
+  is_updated_lengths_unloaded_ = false;
+}
+
+void LineCableBatchUnloader::set_spacings_attachments(
+    const std::vector<Vector3d>* spacings_attachments) {
+  spacings_attachments_ = spacings_attachments;
+
+  is_updated_strains_ = false;
+  is_updated_lengths_unloaded_ = false;
+}
+
+void LineCableBatchUnloader::set_temperatures_unloaded(
+    const std::vector<double>* temperatures_unloaded) {
+  temperatures_unloaded_ = temperatures_unloaded;
+
+  is_updated_strains_ = false;
+  is_updated_lengths_unloaded_ = false;
+}
+
+void LineCableBatchUnloader::set_thread_pool(ThreadPool* pool) {
+  pool_ = pool;
+}
+
+const std::vector<Vector3d>* LineCableBatchUnloader::spacings_attachments()
+    const {
+  return spacings_attachments_;
+}
+
+const std::vector<double>* LineCableBatchUnloader::temperatures_unloaded()
+    const {
+  return temperatures_unloaded_;
+}
+
+ThreadPool* LineCableBatchUnloader::thread_pool() const {
+  return pool_;
+}
+
+bool LineCableBatchUnloader::IsUpdated() const {
+  return (LineCableLoaderBase::IsUpdated() == true)
+      && (is_updated_strains_ == true)
+      && (is_updated_lengths_unloaded_ == true);
+}
+
+bool LineCableBatchUnloader::Update() const {
+  // checks inputs that are dereferenced by the update
+  if ((spacings_attachments_ == nullptr)
+      || (temperatures_unloaded_ == nullptr)) {
+    return false;
+  }
+
+  // updates base class
+  if (LineCableLoaderBase::IsUpdated() == false) {
+    // resets downstream update indicators
+    is_updated_strains_ = false;
+    is_updated_lengths_unloaded_ = false;
+
+    if (LineCableLoaderBase::Update() == false) {
+      return false;
+    }
+  }
+
+  // updates strains
+  if (is_updated_strains_ == false) {
+    is_updated_strains_ = UpdateStrains();
+    if (is_updated_strains_ == false) {
+      return false;
+    }
+  }
+
+  // updates unloaded lengths
+  if (is_updated_lengths_unloaded_ == false) {
+    is_updated_lengths_unloaded_ = UpdateLengthsUnloaded();
+    if (is_updated_lengths_unloaded_ == false) {
+      return false;
+    }
+  }
+
+  // if it reaches this point, update was successful
+  return true;
+}
+
+bool LineCableBatchUnloader::UpdateLengthsUnloaded() const {
+  const int kSizeTemperatures = temperatures_unloaded_->size();
+  const int kSizeSpacings = spacings_attachments_->size();
+  lengths_unloaded_.resize(kSizeTemperatures * kSizeSpacings);
+
+  // combines the span and temperature strains
+  for (int i = 0; i < kSizeTemperatures; i++) {
+    double* lengths = &lengths_unloaded_[i * kSizeSpacings];
+    for (int j = 0; j < kSizeSpacings; j++) {
+      lengths[j] = CableStrainer::LengthFromStrains(
+          lengths_span_[j], strains_span_[j], strains_unloaded_[i]);
+    }
+  }
+
+  return true;
+}
+
+bool LineCableBatchUnloader::UpdateStrains() const {
+  const int kSizeTemperatures = temperatures_unloaded_->size();
+  const int kSizeSpacings = spacings_attachments_->size();
+  lengths_span_.resize(kSizeSpacings);
+  strains_span_.resize(kSizeSpacings);
+  strains_unloaded_.resize(kSizeTemperatures);
+
+  // gets the stretch state for the unloaded condition
+  CableStretchState state_stretch;
+  if (condition_unloaded_ == CableConditionType::kInitial) {
+    // stretch parameters don't matter, model isn't stretched
+    state_stretch.load = 0;
+    state_stretch.temperature = 0;
+    state_stretch.type_polynomial =
+        SagTensionCableComponent::PolynomialType::kLoadStrain;
+  } else if (condition_unloaded_ == CableConditionType::kCreep) {
+    state_stretch = state_stretch_creep_;
+  } else if (condition_unloaded_ == CableConditionType::kLoad) {
+    state_stretch = state_stretch_load_;
+  } else {
+    return false;
+  }
+
+  // defines a task that solves a span or temperature strain
+  // the constraint model was solved by the base class, so the tasks only
+  // read shared data, and each task only writes to its own index
+  auto task = [this, kSizeSpacings, &state_stretch](const int& index) {
+    if (index < kSizeSpacings) {
+      // solves the span length and start strain
+      Catenary3d catenary = catenary_constraint_;
+      catenary.set_spacing_endpoints((*spacings_attachments_)[index]);
+
+      lengths_span_[index] = catenary.Length();
+      strains_span_[index] = model_constraint_.Strain(
+          CableElongationModel::ComponentType::kCombined,
+          catenary.TensionAverage());
+    } else {
+      // builds the unloaded model and solves the unloaded strain
+      const int index_temperature = index - kSizeSpacings;
+
+      CableState state;
+      state.temperature = (*temperatures_unloaded_)[index_temperature];
+      state.type_polynomial =
+          SagTensionCableComponent::PolynomialType::kLoadStrain;
+
+      CableElongationModel model_unloaded;
+      model_unloaded.set_cable(&cable_sagtension_);
+      model_unloaded.set_state(state);
+      model_unloaded.set_state_stretch(state_stretch);
+
+      strains_unloaded_[index_temperature] = model_unloaded.Strain(
+          CableElongationModel::ComponentType::kCombined, 0);
+    }
+  };
+
+  // solves all tasks
+  const int kSizeTasks = kSizeSpacings + kSizeTemperatures;
+  ThreadPool::Run(pool_, kSizeTasks, task);
+
+  // checks that every strain solved
+  for (auto iter = strains_span_.cbegin(); iter != strains_span_.cend();
+       iter++) {
+    if (*iter == -999999) {
+      return false;
+    }
+  }
+
+  for (auto iter = strains_unloaded_.cbegin();
+       iter != strains_unloaded_.cend(); iter++) {
+    if (*iter == -999999) {
+      return false;
+    }
+  }
+
+  return true;
+}
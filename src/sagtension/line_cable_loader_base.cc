@@ -9,7 +9,9 @@
 #include "models/transmissionline/cable_unit_load_solver.h"
 
 LineCableLoaderBase::LineCableLoaderBase() {
+  cache_stretch_ = nullptr;
   line_cable_ = nullptr;
+  table_unit_loads_ = nullptr;
 
   is_updated_catenary_constraint_ = false;
   is_updated_stretch_ = false;
@@ -42,7 +44,9 @@ bool LineCableLoaderBase::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "LINE CABLE LOADER BASE";
+  if (messages != nullptr) {
+    message.title = "LINE CABLE LOADER BASE";
+  }
 
   // validates cable-sagtension
   if (cable_sagtension_.Validate(is_included_warnings, messages) == false) {
@@ -90,10 +94,22 @@ bool LineCableLoaderBase::Validate(
   return is_valid;
 }
 
+StretchStateCache* LineCableLoaderBase::cache_stretch() const {
+  return cache_stretch_;
+}
+
 const LineCable* LineCableLoaderBase::line_cable() const {
   return line_cable_;
 }
 
+void LineCableLoaderBase::set_cache_stretch(
+    StretchStateCache* cache_stretch) {
+  cache_stretch_ = cache_stretch;
+
+  is_updated_catenary_constraint_ = false;
+  is_updated_stretch_ = false;
+}
+
 void LineCableLoaderBase::set_line_cable(const LineCable* line_cable) {
   line_cable_ = line_cable;
 
@@ -108,6 +124,18 @@ void LineCableLoaderBase::set_line_cable(const LineCable* line_cable) {
   is_updated_stretch_ = false;
 }
 
+void LineCableLoaderBase::set_table_unit_loads(
+    const CableUnitLoadTable* table_unit_loads) {
+  table_unit_loads_ = table_unit_loads;
+
+  is_updated_catenary_constraint_ = false;
+  is_updated_stretch_ = false;
+}
+
+const CableUnitLoadTable* LineCableLoaderBase::table_unit_loads() const {
+  return table_unit_loads_;
+}
+
 bool LineCableLoaderBase::InitializeLineCableModels() const {
   // declares working variable
   // all models are initialized with zero stretch
@@ -179,6 +207,17 @@ bool LineCableLoaderBase::IsUpdated() const {
 
 Vector3d LineCableLoaderBase::UnitLoad(
     const WeatherLoadCase& weathercase) const {
+  // gets the unit load from the table if possible
+  if (table_unit_loads_ != nullptr) {
+    const Vector3d* load_unit = table_unit_loads_->UnitLoad(
+        line_cable_->cable()->diameter,
+        line_cable_->cable()->weight_unit,
+        &weathercase);
+    if (load_unit != nullptr) {
+      return *load_unit;
+    }
+  }
+
   CableUnitLoadSolver solver;
   solver.set_diameter_cable(&line_cable_->cable()->diameter);
   solver.set_weight_unit_cable(&line_cable_->cable()->weight_unit);
@@ -187,6 +226,24 @@ Vector3d LineCableLoaderBase::UnitLoad(
 }
 
 bool LineCableLoaderBase::Update() const {
+  // checks inputs that are dereferenced by the update
+  if ((line_cable_ == nullptr) || (line_cable_->cable() == nullptr)
+      || (line_cable_->constraint().case_weather == nullptr)
+      || (line_cable_->weathercase_stretch_creep() == nullptr)
+      || (line_cable_->weathercase_stretch_load() == nullptr)) {
+    return false;
+  }
+
+  // uses the cached solution if available
+  std::uint64_t key = 0;
+  if (cache_stretch_ != nullptr) {
+    key = StretchStateCache::Key(*line_cable_);
+    if (UpdateFromCache(key) == true) {
+      is_updated_stretch_ = UpdateLineCableModels();
+      return is_updated_stretch_;
+    }
+  }
+
   // updates constraint catenary
   is_updated_catenary_constraint_ = UpdateConstraintCatenary();
   if (is_updated_catenary_constraint_ == false) {
@@ -206,8 +263,19 @@ bool LineCableLoaderBase::Update() const {
     return false;
   }
 
-  // if it reaches this point, update was successful
-  return true;
+  // adds the solution to the cache
+  if (cache_stretch_ != nullptr) {
+    StretchStateCacheEntry entry;
+    entry.state_stretch_creep = state_stretch_creep_;
+    entry.state_stretch_load = state_stretch_load_;
+    entry.tension_horizontal_constraint =
+        catenary_constraint_.tension_horizontal();
+    cache_stretch_->Add(key, entry);
+  }
+
+  // updates the models so they are ready to share
+  is_updated_stretch_ = UpdateLineCableModels();
+  return is_updated_stretch_;
 }
 
 /// This function checks the condition of the line cable constraint, and
@@ -256,73 +324,82 @@ bool LineCableLoaderBase::UpdateConstraintCableModel() const {
     return false;
   }
 
-  // initializes left point
+  // defines a function that updates the constraint model stretch and solves
+  // the stretch load difference
+  // the reloader is warm started from the previous horizontal tension
+  auto difference = [&](const double& load_stretch) -> double {
+    state_stretch.load = load_stretch;
+    model_constraint_.set_state_stretch(state_stretch);
+    reloader.set_model_reference(&model_constraint_);
+
+    const Catenary3d catenary = reloader.CatenaryReloaded();
+    reloader.set_tension_horizontal_guess(catenary.tension_horizontal());
+
+    return catenary.TensionAverage() - load_stretch;
+  };
+
+  // initializes left point with no stretch
   Point2d<double> point_left;
   point_left.x = 0;
-  point_left.y = reloader.CatenaryReloaded().TensionAverage()
-                 - state_stretch.load;
+  point_left.y = difference(point_left.x);
 
-  // initializes right point
+  // initializes right point with a linear estimate
+  // stretch loads below the reloaded tension do not affect the reloaded
+  // tension, so the difference has a slope of -1 until this point
   Point2d<double> point_right;
-  point_right.x = *cable_sagtension_.strength_rated();
+  point_right.x = point_left.x + point_left.y;
+  point_right.y = difference(point_right.x);
 
-  state_stretch.load = point_right.x;
-  model_constraint_.set_state_stretch(state_stretch);
-  reloader.set_model_reference(&model_constraint_);
+  // iterates until the right point brackets the solution
+  // the difference slope is assumed to be at least half of the initial slope,
+  // otherwise the bracket is expanded again
+  int iter = 2;
+  const int iter_max = 100;
+  const double precision = 0.01;
+  while ((precision <= point_right.y - target_solution)
+      && (iter < iter_max)) {
+    const double step = 2 * (point_right.y - target_solution) + precision;
 
-  point_right.y = reloader.CatenaryReloaded().TensionAverage()
-                  - state_stretch.load;
+    point_left.x = point_right.x;
+    point_left.y = point_right.y;
+    point_right.x = point_right.x + step;
+    point_right.y = difference(point_right.x);
 
-  // initializes current point
+    iter++;
+  }
+
+  // initializes current point as the last solved point
   Point2d<double> point_current;
+  point_current.x = point_right.x;
+  point_current.y = point_right.y;
 
   // iterates until target solution is reached
-  unsigned int iter = 1;
-  const int iter_max = 100;
-  const double precision = 0.01;
-  double slope_line = -999999;
-
+  // uses the illinois variant of the false position method, which halves the
+  // retained point difference if a point is retained twice in a row
+  int side_replaced = 0;
   while ((precision < std::abs(point_current.y - target_solution))
       && (iter < iter_max)) {
-    // solves for new stretch value is calculated for current point
-    slope_line = (point_right.y - point_left.y)
-                  / (point_right.x - point_left.x);
+    // solves for new stretch value for current point
     point_current.x = point_left.x
-        + ((target_solution - point_left.y) / slope_line);
-
-    // updates constraint model and reloader
-    state_stretch.load = point_current.x;
-    model_constraint_.set_state_stretch(state_stretch);
-    reloader.set_model_reference(&model_constraint_);
-
-    // solves for new horizontal tension value for current point
-    point_current.y = reloader.CatenaryReloaded().TensionAverage()
-                      - state_stretch.load;
+        + (target_solution - point_left.y) * (point_right.x - point_left.x)
+        / (point_right.y - point_left.y);
+    point_current.y = difference(point_current.x);
 
-    // current point is left of left/right points
-    if (point_current.x < point_left.x) {
-      point_right.x = point_left.x;
-      point_right.y = point_left.y;
+    // replaces the point on the same side of the solution
+    if (target_solution < point_current.y) {
       point_left.x = point_current.x;
       point_left.y = point_current.y;
-
-    // current point is between left/right points
-    } else if ((point_left.x <= point_current.x)
-        && (point_current.x <= point_right.x)) {
-      if (point_current.y < target_solution) {
-        point_right.x = point_current.x;
-        point_right.y = point_current.y;
-      } else if (target_solution < point_current.y) {
-        point_left.x = point_current.x;
-        point_left.y = point_current.y;
+      if (side_replaced == 1) {
+        point_right.y = point_right.y / 2;
       }
-
-    // current point is right of left/right points
-    } else if (point_right.x < point_current.x) {
-      point_left.x = point_right.x;
-      point_left.y = point_right.y;
+      side_replaced = 1;
+    } else {
       point_right.x = point_current.x;
       point_right.y = point_current.y;
+      if (side_replaced == -1) {
+        point_left.y = point_left.y / 2;
+      }
+      side_replaced = -1;
     }
 
     iter++;
@@ -349,6 +426,52 @@ bool LineCableLoaderBase::UpdateConstraintCatenary() const {
   }
 }
 
+bool LineCableLoaderBase::UpdateFromCache(const std::uint64_t& key) const {
+  StretchStateCacheEntry entry;
+  if (cache_stretch_->Find(key, &entry) == false) {
+    return false;
+  }
+
+  // rebuilds the constraint catenary using the cached horizontal tension
+  catenary_constraint_ = Catenary3d();
+  catenary_constraint_.set_spacing_endpoints(
+      line_cable_->spacing_attachments_ruling_span());
+  catenary_constraint_.set_weight_unit(
+      UnitLoad(*line_cable_->constraint().case_weather));
+  catenary_constraint_.set_tension_horizontal(
+      entry.tension_horizontal_constraint);
+
+  // initializes the models and applies the cached stretch
+  if (InitializeLineCableModels() == false) {
+    return false;
+  }
+
+  const CableConditionType condition = line_cable_->constraint().condition;
+  if (condition == CableConditionType::kCreep) {
+    model_constraint_.set_state_stretch(entry.state_stretch_creep);
+  } else if (condition == CableConditionType::kLoad) {
+    model_constraint_.set_state_stretch(entry.state_stretch_load);
+  }
+
+  state_stretch_creep_ = entry.state_stretch_creep;
+  state_stretch_load_ = entry.state_stretch_load;
+
+  is_updated_catenary_constraint_ = true;
+  is_updated_stretch_ = true;
+  return true;
+}
+
+/// The cable models update lazily, and are not always used while solving
+/// (e.g. an initial constraint or a cached stretch). Derived classes share the
+/// models between threads, which is only safe if no task updates them.
+bool LineCableLoaderBase::UpdateLineCableModels() const {
+  const CableElongationModel::ComponentType kCombined =
+      CableElongationModel::ComponentType::kCombined;
+  return (model_constraint_.Strain(kCombined, 0) != -999999)
+      && (model_creep_.Strain(kCombined, 0) != -999999)
+      && (model_load_.Strain(kCombined, 0) != -999999);
+}
+
 bool LineCableLoaderBase::UpdateLoadStretch() const {
   // initializes working variables
   CatenaryCableReloader reloader;
@@ -0,0 +1,339 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/sagtension/line_cable_reload_sampler.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "models/sagtension/line_cable_reloader.h"
+
+namespace {
+
+/// \var kSizeBatch
+///   The number of samples in a batch.
+const int kSizeBatch = 256;
+
+/// \brief Draws a sample if the distribution is defined.
+/// \param[in] distribution
+///   The distribution.
+/// \param[in,out] generator
+///   The random number generator.
+/// \param[in,out] value
+///   The value, which is replaced with the sample.
+/// \return If the value was sampled.
+bool SampleValue(const RandomDistribution& distribution,
+                 CounterRandomGenerator* generator,
+                 double* value) {
+  if (distribution.type == RandomDistribution::DistributionType::kNull) {
+    return false;
+  }
+
+  *value = distribution.Sample(generator);
+  return true;
+}
+
+}  // namespace
+
+LineCableReloadSampler::LineCableReloadSampler() {
+  condition_reloaded_ = CableConditionType::kNull;
+  distributions_ = nullptr;
+  line_cable_ = nullptr;
+  num_samples_ = -1;
+  pool_ = nullptr;
+  seed_ = 0;
+  weathercase_reloaded_ = nullptr;
+
+  num_failed_ = -1;
+  is_updated_ = false;
+}
+
+LineCableReloadSampler::~LineCableReloadSampler() {
+}
+
+const TDigest* LineCableReloadSampler::DigestSag() const {
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return nullptr;
+  }
+
+  return &digest_sag_;
+}
+
+const TDigest* LineCableReloadSampler::DigestTensionHorizontal() const {
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return nullptr;
+  }
+
+  return &digest_tension_horizontal_;
+}
+
+int LineCableReloadSampler::NumSamplesFailed() const {
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return -1;
+  }
+
+  return num_failed_;
+}
+
+bool LineCableReloadSampler::Validate(
+    const bool& is_included_warnings,
+    std::list<ErrorMessage>* messages) const {
+  // initializes
+  bool is_valid = true;
+  ErrorMessage message;
+  if (messages != nullptr) {
+    message.title = "LINE CABLE RELOAD SAMPLER";
+  }
+
+  // validates condition-reloaded
+  if (condition_reloaded_ == CableConditionType::kNull) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid reloaded condition";
+      messages->push_back(message);
+    }
+  }
+
+  // validates distributions
+  if (distributions_ == nullptr) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid distributions";
+      messages->push_back(message);
+    }
+  } else {
+    const std::vector<const RandomDistribution*> distributions = {
+        &distributions_->density_ice,
+        &distributions_->limit_constraint,
+        &distributions_->pressure_wind,
+        &distributions_->temperature_cable,
+        &distributions_->thickness_ice};
+    for (auto iter = distributions.cbegin(); iter != distributions.cend();
+         iter++) {
+      const RandomDistribution& distribution = **iter;
+      if (distribution.type == RandomDistribution::DistributionType::kNull) {
+        continue;
+      }
+
+      if (distribution.Validate(is_included_warnings, messages) == false) {
+        is_valid = false;
+      }
+    }
+  }
+
+  // validates line cable
+  if (line_cable_ == nullptr) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid line cable";
+      messages->push_back(message);
+    }
+  } else {
+    if (line_cable_->Validate(is_included_warnings, messages) == false) {
+      is_valid = false;
+    }
+  }
+
+  // validates num-samples
+  if (num_samples_ < 1) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid number of samples";
+      messages->push_back(message);
+    }
+  }
+
+  // validates weathercase-reloaded
+  if (weathercase_reloaded_ == nullptr) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid reloaded weathercase";
+      messages->push_back(message);
+    }
+  } else {
+    if (weathercase_reloaded_->Validate(is_included_warnings,
+                                        messages) == false) {
+      is_valid = false;
+    }
+  }
+
+  // returns if errors are present
+  if (is_valid == false) {
+    return is_valid;
+  }
+
+  // validates update process
+  if (Update() == false) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Error updating class. Could not solve any "
+                            "samples.";
+      messages->push_back(message);
+    }
+  }
+
+  return is_valid;
+}
+
+CableConditionType LineCableReloadSampler::condition_reloaded() const {
+  return condition_reloaded_;
+}
+
+const ReloadDistributions* LineCableReloadSampler::distributions() const {
+  return distributions_;
+}
+
+const LineCable* LineCableReloadSampler::line_cable() const {
+  return line_cable_;
+}
+
+int LineCableReloadSampler::num_samples() const {
+  return num_samples_;
+}
+
+uint64_t LineCableReloadSampler::seed() const {
+  return seed_;
+}
+
+void LineCableReloadSampler::set_condition_reloaded(
+    const CableConditionType& condition_reloaded) {
+  condition_reloaded_ = condition_reloaded;
+  is_updated_ = false;
+}
+
+void LineCableReloadSampler::set_distributions(
+    const ReloadDistributions* distributions) {
+  distributions_ = distributions;
+  is_updated_ = false;
+}
+
+void LineCableReloadSampler::set_line_cable(const LineCable* line_cable) {
+  line_cable_ = line_cable;
+  is_updated_ = false;
+}
+
+void LineCableReloadSampler::set_num_samples(const int& num_samples) {
+  num_samples_ = num_samples;
+  is_updated_ = false;
+}
+
+void LineCableReloadSampler::set_seed(const uint64_t& seed) {
+  seed_ = seed;
+  is_updated_ = false;
+}
+
+void LineCableReloadSampler::set_thread_pool(ThreadPool* pool) {
+  pool_ = pool;
+}
+
+void LineCableReloadSampler::set_weathercase_reloaded(
+    const WeatherLoadCase* weathercase_reloaded) {
+  weathercase_reloaded_ = weathercase_reloaded;
+  is_updated_ = false;
+}
+
+ThreadPool* LineCableReloadSampler::thread_pool() const {
+  return pool_;
+}
+
+const WeatherLoadCase* LineCableReloadSampler::weathercase_reloaded() const {
+  return weathercase_reloaded_;
+}
+
+bool LineCableReloadSampler::IsUpdated() const {
+  return is_updated_ == true;
+}
+
+bool LineCableReloadSampler::Update() const {
+  // updates statistics
+  is_updated_ = UpdateStatistics();
+  if (is_updated_ == false) {
+    return false;
+  }
+
+  // if it reaches this point, update was successful
+  return true;
+}
+
+bool LineCableReloadSampler::UpdateStatistics() const {
+  digest_sag_.Clear();
+  digest_tension_horizontal_.Clear();
+  num_failed_ = -1;
+
+  if ((distributions_ == nullptr) || (line_cable_ == nullptr)
+      || (weathercase_reloaded_ == nullptr) || (num_samples_ < 1)) {
+    return false;
+  }
+
+  // initializes batch containers
+  const int kSizeBatches = (num_samples_ + kSizeBatch - 1) / kSizeBatch;
+  std::vector<TDigest> digests_sag(kSizeBatches);
+  std::vector<TDigest> digests_tension(kSizeBatches);
+  std::vector<int> nums_failed(kSizeBatches, 0);
+
+  // defines a task that solves a batch of samples
+  // each task only writes to its own batch index
+  auto task = [this, &digests_sag, &digests_tension,
+               &nums_failed](const int& index_batch) {
+    // builds the batch context, which is reused by every sample
+    LineCable line_cable = *line_cable_;
+    WeatherLoadCase weathercase = *weathercase_reloaded_;
+
+    LineCableReloader reloader;
+    reloader.set_condition_reloaded(condition_reloaded_);
+    reloader.set_line_cable(&line_cable);
+    reloader.set_weathercase_reloaded(&weathercase);
+
+    const int index_begin = index_batch * kSizeBatch;
+    const int index_end = std::min(num_samples_, index_begin + kSizeBatch);
+    for (int index = index_begin; index < index_end; index++) {
+      CounterRandomGenerator generator(seed_, index);
+
+      // samples the constraint limit
+      // the line cable is reset so that the reloader solves the constraint
+      // and stretch again
+      CableConstraint constraint = line_cable.constraint();
+      if (SampleValue(distributions_->limit_constraint, &generator,
+                      &constraint.limit) == true) {
+        line_cable.set_constraint(constraint);
+        reloader.set_line_cable(&line_cable);
+      }
+
+      // samples the reloaded weathercase
+      SampleValue(distributions_->density_ice, &generator,
+                  &weathercase.density_ice);
+      SampleValue(distributions_->pressure_wind, &generator,
+                  &weathercase.pressure_wind);
+      SampleValue(distributions_->temperature_cable, &generator,
+                  &weathercase.temperature_cable);
+      SampleValue(distributions_->thickness_ice, &generator,
+                  &weathercase.thickness_ice);
+      reloader.set_weathercase_reloaded(&weathercase);
+
+      // solves and adds to the batch statistics
+      if (reloader.Solve() == true) {
+        const Catenary3d catenary = reloader.CatenaryReloaded();
+        digests_sag[index_batch].Add(catenary.Sag());
+        digests_tension[index_batch].Add(catenary.tension_horizontal());
+      } else {
+        nums_failed[index_batch]++;
+      }
+    }
+  };
+
+  // solves all tasks
+  ThreadPool::Run(pool_, kSizeBatches, task);
+
+  // merges the batch statistics in batch order
+  num_failed_ = 0;
+  for (int index = 0; index < kSizeBatches; index++) {
+    digest_sag_.Merge(digests_sag[index]);
+    digest_tension_horizontal_.Merge(digests_tension[index]);
+    num_failed_ += nums_failed[index];
+  }
+
+  return num_failed_ < num_samples_;
+}
@@ -25,6 +25,10 @@ Catenary3d LineCableReloader::CatenaryReloaded() const {
   return catenary_reloaded_;
 }
 
+bool LineCableReloader::Solve() const {
+  return (IsUpdated() == true) || (Update() == true);
+}
+
 CableState LineCableReloader::StateReloaded() const {
   // updates class if necessary
   if ((IsUpdated() == false) && (Update() == false)) {
@@ -84,7 +88,9 @@ bool LineCableReloader::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "LINE CABLE RELOADER";
+  if (messages != nullptr) {
+    message.title = "LINE CABLE RELOADER";
+  }
 
   // validates base class
   if (LineCableLoaderBase::Validate(is_included_warnings, messages) == false) {
@@ -144,6 +150,12 @@ CableConditionType LineCableReloader::condition_reloaded() const {
 
 void LineCableReloader::set_condition_reloaded(
     const CableConditionType& condition_reloaded) {
+  // the reloaded solution only depends on the condition value, so it is kept
+  // if the condition does not change
+  if (condition_reloaded == condition_reloaded_) {
+    return;
+  }
+
   condition_reloaded_ = condition_reloaded;
 
   is_updated_model_reloaded_ = false;
@@ -169,6 +181,11 @@ bool LineCableReloader::IsUpdated() const {
 }
 
 bool LineCableReloader::Update() const {
+  // checks inputs that are dereferenced by the update
+  if (weathercase_reloaded_ == nullptr) {
+    return false;
+  }
+
   // updates base class
   if (LineCableLoaderBase::IsUpdated() == false) {
     // resets downstream update indicators
@@ -240,7 +257,9 @@ bool LineCableReloader::UpdateReloadedCatenary() const {
   reloader.set_model_reloaded(&model_reloaded_);
   reloader.set_weight_unit_reloaded(&weight_unit_reloaded);
 
-  if (reloader.Validate(false, nullptr) == true) {
+  // the reloader inputs are built from the base class, which has already
+  // solved, so the reloader is solved without validating
+  if (reloader.Solve() == true) {
     catenary_reloaded_ = reloader.CatenaryReloaded();
     return true;
   } else {
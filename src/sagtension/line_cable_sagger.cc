@@ -93,7 +93,9 @@ bool LineCableSagger::Validate(const bool& is_included_warnings,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "LINE CABLE SAGGER";
+  if (messages != nullptr) {
+    message.title = "LINE CABLE SAGGER";
+  }
 
   // validates constraints-design
   for (auto iter = constraints_design_->cbegin();
@@ -299,7 +301,9 @@ bool LineCableSagger::UpdateCatenariesConstraintsActual() const {
     reloader.set_condition_reloaded(constraint.condition);
 
     // gets reloaded catenary and adds to collection
-    if (reloader.Validate(false, nullptr) == false) {
+    // only the reloaded weathercase and condition change in this loop, so
+    // the line cable stretch is only solved once
+    if (reloader.Solve() == false) {
       return false;
     }
     Catenary3d catenary = reloader.CatenaryReloaded();
@@ -0,0 +1,429 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/sagtension/line_cable_sagging_sheet.h"
+
+#include <algorithm>
+
+#include "models/sagging/cable_sag_position_corrector.h"
+#include "models/sagging/stopwatch_sagger.h"
+#include "models/sagging/transit_sagger.h"
+
+LineCableSaggingSheet::LineCableSaggingSheet() {
+  condition_sagging_ = CableConditionType::kNull;
+  distance_transit_ = -999999;
+  line_cable_ = nullptr;
+  location_dyno_ = DynoSagger::SpanEndLocation::kNull;
+  points_attachment_ = nullptr;
+  pool_ = nullptr;
+  temperatures_ = nullptr;
+  units_ = units::UnitSystem::kNull;
+  wave_stopwatch_ = -1;
+
+  is_updated_ = false;
+}
+
+LineCableSaggingSheet::~LineCableSaggingSheet() {
+}
+
+const SaggingSheetCell* LineCableSaggingSheet::Cell(
+    const int& index_temperature,
+    const int& index_span) const {
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return nullptr;
+  }
+
+  // checks indexes
+  const int kSizeTemperatures = temperatures_->size();
+  const int kSizeSpans = points_attachment_->size() - 1;
+  if ((index_temperature < 0) || (kSizeTemperatures <= index_temperature)
+      || (index_span < 0) || (kSizeSpans <= index_span)) {
+    return nullptr;
+  }
+
+  return &cells_[(index_temperature * kSizeSpans) + index_span];
+}
+
+const std::vector<SaggingSheetCell>* LineCableSaggingSheet::Cells() const {
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return nullptr;
+  }
+
+  return &cells_;
+}
+
+double LineCableSaggingSheet::TensionHorizontal(
+    const int& index_temperature) const {
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return -999999;
+  }
+
+  // checks index
+  const int kSizeTemperatures = tensions_horizontal_.size();
+  if ((index_temperature < 0) || (kSizeTemperatures <= index_temperature)) {
+    return -999999;
+  }
+
+  return tensions_horizontal_[index_temperature];
+}
+
+bool LineCableSaggingSheet::Validate(
+    const bool& is_included_warnings,
+    std::list<ErrorMessage>* messages) const {
+  // initializes
+  bool is_valid = true;
+  ErrorMessage message;
+  if (messages != nullptr) {
+    message.title = "LINE CABLE SAGGING SHEET";
+  }
+
+  // validates condition-sagging
+  if (condition_sagging_ == CableConditionType::kNull) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid sagging condition";
+      messages->push_back(message);
+    }
+  }
+
+  // validates distance-transit
+  if (distance_transit_ < 0) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid transit distance";
+      messages->push_back(message);
+    }
+  }
+
+  // validates line cable
+  if (line_cable_ == nullptr) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid line cable";
+      messages->push_back(message);
+    }
+  } else {
+    if (line_cable_->Validate(is_included_warnings, messages) == false) {
+      is_valid = false;
+    }
+  }
+
+  // validates location-dyno
+  if (location_dyno_ == DynoSagger::SpanEndLocation::kNull) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid dyno location";
+      messages->push_back(message);
+    }
+  }
+
+  // validates points-attachment
+  if ((points_attachment_ == nullptr) || (points_attachment_->size() < 2)) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid attachment points";
+      messages->push_back(message);
+    }
+  }
+
+  // validates temperatures
+  if ((temperatures_ == nullptr) || (temperatures_->empty() == true)) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid temperatures";
+      messages->push_back(message);
+    }
+  }
+
+  // validates units
+  if (units_ == units::UnitSystem::kNull) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid unit system";
+      messages->push_back(message);
+    }
+  }
+
+  // validates wave-stopwatch
+  if (wave_stopwatch_ < 1) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid stopwatch wave";
+      messages->push_back(message);
+    }
+  }
+
+  // returns if errors are present
+  if (is_valid == false) {
+    return is_valid;
+  }
+
+  // validates update process
+  if (Update() == false) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Error updating class";
+      messages->push_back(message);
+    }
+  }
+
+  return is_valid;
+}
+
+CableConditionType LineCableSaggingSheet::condition_sagging() const {
+  return condition_sagging_;
+}
+
+double LineCableSaggingSheet::distance_transit() const {
+  return distance_transit_;
+}
+
+const LineCable* LineCableSaggingSheet::line_cable() const {
+  return line_cable_;
+}
+
+DynoSagger::SpanEndLocation LineCableSaggingSheet::location_dyno() const {
+  return location_dyno_;
+}
+
+const std::vector<Point3d<double>>* LineCableSaggingSheet::points_attachment()
+    const {
+  return points_attachment_;
+}
+
+void LineCableSaggingSheet::set_condition_sagging(
+    const CableConditionType& condition_sagging) {
+  condition_sagging_ = condition_sagging;
+  reloader_.set_condition_reloaded(condition_sagging_);
+  is_updated_ = false;
+}
+
+void LineCableSaggingSheet::set_distance_transit(
+    const double& distance_transit) {
+  distance_transit_ = distance_transit;
+  is_updated_ = false;
+}
+
+void LineCableSaggingSheet::set_line_cable(const LineCable* line_cable) {
+  line_cable_ = line_cable;
+  reloader_.set_line_cable(line_cable_);
+  is_updated_ = false;
+}
+
+void LineCableSaggingSheet::set_location_dyno(
+    const DynoSagger::SpanEndLocation& location_dyno) {
+  location_dyno_ = location_dyno;
+  is_updated_ = false;
+}
+
+void LineCableSaggingSheet::set_points_attachment(
+    const std::vector<Point3d<double>>* points_attachment) {
+  points_attachment_ = points_attachment;
+  is_updated_ = false;
+}
+
+void LineCableSaggingSheet::set_temperatures(
+    const std::vector<double>* temperatures) {
+  temperatures_ = temperatures;
+  is_updated_ = false;
+}
+
+void LineCableSaggingSheet::set_thread_pool(ThreadPool* pool) {
+  pool_ = pool;
+}
+
+void LineCableSaggingSheet::set_units(const units::UnitSystem& units) {
+  units_ = units;
+  is_updated_ = false;
+}
+
+void LineCableSaggingSheet::set_wave_stopwatch(const int& wave_stopwatch) {
+  wave_stopwatch_ = wave_stopwatch;
+  is_updated_ = false;
+}
+
+const std::vector<double>* LineCableSaggingSheet::temperatures() const {
+  return temperatures_;
+}
+
+ThreadPool* LineCableSaggingSheet::thread_pool() const {
+  return pool_;
+}
+
+units::UnitSystem LineCableSaggingSheet::units() const {
+  return units_;
+}
+
+int LineCableSaggingSheet::wave_stopwatch() const {
+  return wave_stopwatch_;
+}
+
+bool LineCableSaggingSheet::IsUpdated() const {
+  return is_updated_ == true;
+}
+
+bool LineCableSaggingSheet::Update() const {
+  // checks inputs that are dereferenced by the update
+  if ((line_cable_ == nullptr) || (points_attachment_ == nullptr)
+      || (points_attachment_->size() < 2) || (temperatures_ == nullptr)
+      || (temperatures_->empty() == true)) {
+    return false;
+  }
+
+  // updates ruling span tensions
+  is_updated_ = UpdateTensionsHorizontal();
+  if (is_updated_ == false) {
+    return false;
+  }
+
+  // updates pulley states
+  is_updated_ = UpdatePulleyStates();
+  if (is_updated_ == false) {
+    return false;
+  }
+
+  // updates cells
+  is_updated_ = UpdateCells();
+  if (is_updated_ == false) {
+    return false;
+  }
+
+  // if it reaches this point, update was successful
+  return true;
+}
+
+bool LineCableSaggingSheet::UpdateCells() const {
+  // initializes
+  const int kSizeTemperatures = temperatures_->size();
+  const int kSizeSpans = points_attachment_->size() - 1;
+  cells_.resize(kSizeTemperatures * kSizeSpans);
+
+  // defines a task that solves a cell
+  // each task only writes to its own cell
+  auto task = [this, kSizeSpans](const int& index) {
+    const int index_temperature = index / kSizeSpans;
+    const int index_span = index % kSizeSpans;
+    const Catenary3d& catenary = catenaries_pulleyed_[index];
+    SaggingSheetCell& cell = cells_[index];
+
+    // solves the transit angle
+    // the catenary origin is the back attachment point
+    TransitSagger sagger_transit;
+    sagger_transit.set_catenary(catenary);
+    sagger_transit.set_point_transit(
+        Point3d<double>(0, 0, -distance_transit_));
+    cell.angle_transit = sagger_transit.AngleLow();
+
+    // solves the stopwatch return time
+    StopwatchSagger sagger_stopwatch;
+    sagger_stopwatch.set_catenary(catenary);
+    sagger_stopwatch.set_units(units_);
+    cell.time_stopwatch = sagger_stopwatch.TimeReturn(wave_stopwatch_);
+
+    // solves the dyno tension
+    DynoSagger sagger_dyno;
+    sagger_dyno.set_catenary(catenary);
+    sagger_dyno.set_location(location_dyno_);
+    cell.tension_dyno = sagger_dyno.Tension();
+
+    // gets the clipping offset at the ahead structure
+    const int kSizeStructures = kSizeSpans + 1;
+    cell.offset_clipping = offsets_clipping_[
+        (index_temperature * kSizeStructures) + index_span + 1];
+  };
+
+  // solves all tasks
+  const int kSizeCells = cells_.size();
+  ThreadPool::Run(pool_, kSizeCells, task);
+
+  return true;
+}
+
+bool LineCableSaggingSheet::UpdatePulleyStates() const {
+  // initializes
+  const int kSizeTemperatures = temperatures_->size();
+  const int kSizeSpans = points_attachment_->size() - 1;
+  const int kSizeStructures = kSizeSpans + 1;
+  catenaries_pulleyed_.resize(kSizeTemperatures * kSizeSpans);
+  offsets_clipping_.resize(kSizeTemperatures * kSizeStructures);
+  std::vector<char> is_solved(kSizeTemperatures, 0);
+
+  // defines a task that solves the pulley state for a temperature
+  // each task only writes to its own temperature range
+  auto task = [this, kSizeSpans, kSizeStructures,
+               &is_solved](const int& index_temperature) {
+    // constrains a line cable copy to the ruling span tension at the
+    // temperature
+    LineCable line_cable = *line_cable_;
+    CableConstraint constraint = line_cable.constraint();
+    constraint.case_weather = &weathercases_[index_temperature];
+    constraint.condition = condition_sagging_;
+    constraint.limit = tensions_horizontal_[index_temperature];
+    constraint.type_limit = CableConstraint::LimitType::kHorizontalTension;
+    line_cable.set_constraint(constraint);
+
+    // solves the pulley state
+    CableSagPositionCorrector corrector;
+    corrector.set_linecable(&line_cable);
+    corrector.set_points_attachment(points_attachment_);
+
+    const std::vector<Catenary3d>* catenaries =
+        corrector.CatenariesPulleyed();
+    if (catenaries == nullptr) {
+      return;
+    }
+
+    const std::vector<double> offsets = corrector.ClippingOffsets();
+
+    // copies to the temperature range
+    std::copy(catenaries->cbegin(), catenaries->cend(),
+              catenaries_pulleyed_.begin() + (index_temperature * kSizeSpans));
+    std::copy(offsets.cbegin(), offsets.cend(),
+              offsets_clipping_.begin()
+              + (index_temperature * kSizeStructures));
+    is_solved[index_temperature] = 1;
+  };
+
+  // solves all tasks
+  ThreadPool::Run(pool_, kSizeTemperatures, task);
+
+  // checks that every temperature solved
+  for (auto iter = is_solved.cbegin(); iter != is_solved.cend(); iter++) {
+    if (*iter == 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool LineCableSaggingSheet::UpdateTensionsHorizontal() const {
+  // initializes
+  const int kSizeTemperatures = temperatures_->size();
+  tensions_horizontal_.resize(kSizeTemperatures);
+  weathercases_.resize(kSizeTemperatures);
+
+  // reloads the ruling span to every temperature
+  // the reloader keeps the constraint and stretch solution between
+  // temperatures, so only the reloaded state is solved again
+  for (int i = 0; i < kSizeTemperatures; i++) {
+    WeatherLoadCase& weathercase = weathercases_[i];
+    weathercase.density_ice = 0;
+    weathercase.description = "";
+    weathercase.pressure_wind = 0;
+    weathercase.temperature_cable = (*temperatures_)[i];
+    weathercase.thickness_ice = 0;
+
+    reloader_.set_weathercase_reloaded(&weathercase);
+    if (reloader_.Solve() == false) {
+      return false;
+    }
+
+    tensions_horizontal_[i] = reloader_.TensionHorizontal();
+  }
+
+  return true;
+}
@@ -0,0 +1,401 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/sagtension/line_cable_section_reloader.h"
+
+#include <cmath>
+
+#include "models/sagtension/catenary_cable_reloader.h"
+
+LineCableSectionReloader::LineCableSectionReloader() {
+  condition_reloaded_ = CableConditionType::kNull;
+  line_ = nullptr;
+  pool_ = nullptr;
+  type_model_span_ = SpanModelType::kRulingSpan;
+  weathercase_reloaded_ = nullptr;
+
+  is_updated_catenaries_reloaded_ = false;
+  is_updated_model_reloaded_ = false;
+  is_updated_spacings_span_ = false;
+}
+
+LineCableSectionReloader::~LineCableSectionReloader() {
+}
+
+const std::vector<Catenary3d>* LineCableSectionReloader::CatenariesReloaded()
+    const {
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return nullptr;
+  }
+
+  return &catenaries_reloaded_;
+}
+
+bool LineCableSectionReloader::Solve() const {
+  return (IsUpdated() == true) || (Update() == true);
+}
+
+const std::vector<Vector3d>* LineCableSectionReloader::SpacingsSpan() const {
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return nullptr;
+  }
+
+  return &spacings_span_;
+}
+
+bool LineCableSectionReloader::Validate(
+    const bool& is_included_warnings,
+    std::list<ErrorMessage>* messages) const {
+  // initializes
+  bool is_valid = true;
+  ErrorMessage message;
+  if (messages != nullptr) {
+    message.title = "LINE CABLE SECTION RELOADER";
+  }
+
+  // validates base class
+  if (LineCableLoaderBase::Validate(is_included_warnings, messages) == false) {
+    is_valid = false;
+  }
+
+  // validates condition-reloaded
+  if (condition_reloaded_ == CableConditionType::kNull) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid reloaded condition";
+      messages->push_back(message);
+    }
+  }
+
+  // validates line
+  if (line_ == nullptr) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid transmission line";
+      messages->push_back(message);
+    }
+  } else if (line_cable_ != nullptr) {
+    // validates that the connections are in the transmission line
+    const std::vector<LineCableConnection>* connections =
+        line_cable_->connections();
+    for (auto iter = connections->cbegin(); iter != connections->cend();
+         iter++) {
+      const LineCableConnection& connection = *iter;
+      if (line_->IndexLineStructure(connection.line_structure) == -1) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Invalid connection. Line structure is not "
+                                "in the transmission line.";
+          messages->push_back(message);
+        }
+      }
+    }
+  }
+
+  // validates type-model-span
+  if (type_model_span_ == SpanModelType::kNull) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid span model type";
+      messages->push_back(message);
+    }
+  }
+
+  // validates weathercase-reloaded
+  if (weathercase_reloaded_ == nullptr) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid reloaded weathercase";
+      messages->push_back(message);
+    }
+  } else {
+    if (weathercase_reloaded_->Validate(is_included_warnings,
+                                        messages) == false) {
+      is_valid = false;
+    }
+  }
+
+  // returns if errors are present
+  if (is_valid == false) {
+    return is_valid;
+  }
+
+  // validates update process
+  if (Update() == false) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "";
+      if (is_updated_spacings_span_ == false) {
+        message.description = "Error updating class. Could not solve for "
+                              "span spacings.";
+      } else if (is_updated_model_reloaded_ == false) {
+        message.description = "Error updating class. Could not solve for "
+                              "reloaded cable model.";
+      } else if (is_updated_catenaries_reloaded_ == false) {
+        message.description = "Error updating class. Could not solve for "
+                              "reloaded catenaries.";
+      }
+      messages->push_back(message);
+    }
+  }
+
+  return is_valid;
+}
+
+CableConditionType LineCableSectionReloader::condition_reloaded() const {
+  return condition_reloaded_;
+}
+
+void LineCableSectionReloader::set_condition_reloaded(
+    const CableConditionType& condition_reloaded) {
+  condition_reloaded_ = condition_reloaded;
+
+  is_updated_model_reloaded_ = false;
+  is_updated_catenaries_reloaded_ = false;
+}
+
+void LineCableSectionReloader::set_thread_pool(ThreadPool* pool) {
+  pool_ = pool;
+}
+
+void LineCableSectionReloader::set_transmission_line(
+    const TransmissionLine* line) {
+  line_ = line;
+
+  is_updated_spacings_span_ = false;
+  is_updated_catenaries_reloaded_ = false;
+}
+
+void LineCableSectionReloader::set_type_model_span(
+    const SpanModelType& type_model_span) {
+  type_model_span_ = type_model_span;
+
+  is_updated_catenaries_reloaded_ = false;
+}
+
+void LineCableSectionReloader::set_weathercase_reloaded(
+    const WeatherLoadCase* weathercase_reloaded) {
+  weathercase_reloaded_ = weathercase_reloaded;
+
+  is_updated_model_reloaded_ = false;
+  is_updated_catenaries_reloaded_ = false;
+}
+
+ThreadPool* LineCableSectionReloader::thread_pool() const {
+  return pool_;
+}
+
+const TransmissionLine* LineCableSectionReloader::transmission_line() const {
+  return line_;
+}
+
+LineCableSectionReloader::SpanModelType
+    LineCableSectionReloader::type_model_span() const {
+  return type_model_span_;
+}
+
+const WeatherLoadCase* LineCableSectionReloader::weathercase_reloaded()
+    const {
+  return weathercase_reloaded_;
+}
+
+bool LineCableSectionReloader::IsUpdated() const {
+  return (LineCableLoaderBase::IsUpdated() == true)
+      && (is_updated_spacings_span_ == true)
+      && (is_updated_model_reloaded_ == true)
+      && (is_updated_catenaries_reloaded_ == true);
+}
+
+bool LineCableSectionReloader::Update() const {
+  // updates base class
+  if (LineCableLoaderBase::IsUpdated() == false) {
+    // resets downstream update indicators
+    is_updated_spacings_span_ = false;
+    is_updated_model_reloaded_ = false;
+    is_updated_catenaries_reloaded_ = false;
+
+    if (LineCableLoaderBase::Update() == false) {
+      return false;
+    }
+  }
+
+  // updates span spacings
+  if (is_updated_spacings_span_ == false) {
+    is_updated_spacings_span_ = UpdateSpacingsSpan();
+    if (is_updated_spacings_span_ == false) {
+      return false;
+    }
+  }
+
+  // updates reloaded cable model
+  if (is_updated_model_reloaded_ == false) {
+    is_updated_model_reloaded_ = UpdateReloadedCableModel();
+    if (is_updated_model_reloaded_ == false) {
+      return false;
+    }
+  }
+
+  // updates reloaded catenaries
+  if (is_updated_catenaries_reloaded_ == false) {
+    is_updated_catenaries_reloaded_ = UpdateReloadedCatenaries();
+    if (is_updated_catenaries_reloaded_ == false) {
+      return false;
+    }
+  }
+
+  // if it reaches this point, update was successful
+  return true;
+}
+
+bool LineCableSectionReloader::UpdateReloadedCableModel() const {
+  // builds cable states based on reloaded weathercase and stretch
+  CableState state;
+  state.temperature = weathercase_reloaded_->temperature_cable;
+  state.type_polynomial = SagTensionCableComponent::PolynomialType::kLoadStrain;
+
+  CableStretchState state_stretch;
+  if (condition_reloaded_ == CableConditionType::kInitial) {
+    // stretch parameters don't matter, model isn't stretched
+    state_stretch.load = 0;
+    state_stretch.temperature = 0;
+    state_stretch.type_polynomial =
+        SagTensionCableComponent::PolynomialType::kLoadStrain;
+  } else if (condition_reloaded_ == CableConditionType::kCreep) {
+    state_stretch = state_stretch_creep_;
+  } else if (condition_reloaded_ == CableConditionType::kLoad) {
+    state_stretch = state_stretch_load_;
+  } else {
+    return false;
+  }
+
+  // updates model
+  model_reloaded_.set_cable(&cable_sagtension_);
+  model_reloaded_.set_state(state);
+  model_reloaded_.set_state_stretch(state_stretch);
+
+  // solves the model so that it is only read by the span reloads
+  return model_reloaded_.Validate(false, nullptr);
+}
+
+bool LineCableSectionReloader::UpdateReloadedCatenaries() const {
+  // calculates reloaded unit weight
+  const Vector3d weight_unit_reloaded = UnitLoad(*weathercase_reloaded_);
+
+  const int kSizeSpans = spacings_span_.size();
+  catenaries_reloaded_.clear();
+  catenaries_reloaded_.resize(kSizeSpans);
+
+  if (type_model_span_ == SpanModelType::kRulingSpan) {
+    // reloads the ruling span catenary
+    CatenaryCableReloader reloader;
+    reloader.set_catenary(&catenary_constraint_);
+    reloader.set_model_reference(&model_constraint_);
+    reloader.set_model_reloaded(&model_reloaded_);
+    reloader.set_weight_unit_reloaded(&weight_unit_reloaded);
+
+    if (reloader.Solve() == false) {
+      return false;
+    }
+
+    // applies the ruling span horizontal tension to every span
+    const double tension_horizontal = reloader.TensionHorizontal();
+    for (int index = 0; index < kSizeSpans; index++) {
+      Catenary3d& catenary = catenaries_reloaded_[index];
+      catenary.set_direction_transverse(
+          catenary_constraint_.direction_transverse());
+      catenary.set_spacing_endpoints(spacings_span_[index]);
+      catenary.set_tension_horizontal(tension_horizontal);
+      catenary.set_weight_unit(weight_unit_reloaded);
+    }
+
+    return true;
+  } else if (type_model_span_ == SpanModelType::kIndividual) {
+    // the constraint model was solved by the base class, and the reloaded
+    // model was solved when updated, so the tasks only read shared data
+    std::vector<char> is_solved(kSizeSpans, 0);
+
+    // defines a task that reloads a single span
+    // each task only writes to its own span index
+    auto task = [this, &is_solved, &weight_unit_reloaded](const int& index) {
+      // builds the installed span catenary at the constraint tension
+      Catenary3d catenary_constraint = catenary_constraint_;
+      catenary_constraint.set_spacing_endpoints(spacings_span_[index]);
+
+      CatenaryCableReloader reloader;
+      reloader.set_catenary(&catenary_constraint);
+      reloader.set_model_reference(&model_constraint_);
+      reloader.set_model_reloaded(&model_reloaded_);
+      reloader.set_weight_unit_reloaded(&weight_unit_reloaded);
+
+      if (reloader.Solve() == true) {
+        catenaries_reloaded_[index] = reloader.CatenaryReloaded();
+        is_solved[index] = 1;
+      }
+    };
+
+    // solves all tasks
+    ThreadPool::Run(pool_, kSizeSpans, task);
+
+    // checks that every span solved
+    for (auto iter = is_solved.cbegin(); iter != is_solved.cend(); iter++) {
+      if (*iter == 0) {
+        return false;
+      }
+    }
+
+    return true;
+  } else {
+    return false;
+  }
+}
+
+bool LineCableSectionReloader::UpdateSpacingsSpan() const {
+  spacings_span_.clear();
+
+  if (line_ == nullptr) {
+    return false;
+  }
+
+  // gets the attachment point for every connection
+  const std::vector<LineCableConnection>* connections =
+      line_cable_->connections();
+  std::vector<Point3d<double>> points;
+  points.reserve(connections->size());
+  for (auto iter = connections->cbegin(); iter != connections->cend();
+       iter++) {
+    const LineCableConnection& connection = *iter;
+
+    const int index_structure =
+        line_->IndexLineStructure(connection.line_structure);
+    const Point3d<double> point = line_->PointXyzLineStructureAttachment(
+        index_structure,
+        connection.index_attachment);
+    if (point.x == -999999) {
+      return false;
+    }
+
+    points.push_back(point);
+  }
+
+  // checks that there is at least one span
+  if (points.size() < 2) {
+    return false;
+  }
+
+  // calculates the spacing between adjacent attachment points
+  const int kSizeSpans = static_cast<int>(points.size()) - 1;
+  spacings_span_.reserve(kSizeSpans);
+  for (int index = 0; index < kSizeSpans; index++) {
+    const Point3d<double>& point_back = points[index];
+    const Point3d<double>& point_ahead = points[index + 1];
+
+    const double x = point_ahead.x - point_back.x;
+    const double y = point_ahead.y - point_back.y;
+    const double z = point_ahead.z - point_back.z;
+    spacings_span_.push_back(Vector3d(std::sqrt(x * x + y * y), 0, z));
+  }
+
+  return true;
+}
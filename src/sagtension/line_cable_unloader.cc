@@ -36,7 +36,9 @@ bool LineCableUnloader::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "LINE CABLE UNLOADER";
+  if (messages != nullptr) {
+    message.title = "LINE CABLE UNLOADER";
+  }
 
   // validates base class
   if (LineCableLoaderBase::Validate(is_included_warnings, messages) == false) {
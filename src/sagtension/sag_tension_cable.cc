@@ -20,7 +20,9 @@ bool SagTensionCableComponent::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "SAG TENSION CABLE COMPONENT";
+  if (messages != nullptr) {
+    message.title = "SAG TENSION CABLE COMPONENT";
+  }
 
   // validates base component
   if (component_base_ == nullptr) {
@@ -241,7 +243,9 @@ bool SagTensionCable::Validate(const bool& is_included_warnings,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "SAG TENSION CABLE";
+  if (messages != nullptr) {
+    message.title = "SAG TENSION CABLE";
+  }
 
   // validates base cable
   if (cable_base_ == nullptr) {
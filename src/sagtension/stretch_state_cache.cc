@@ -0,0 +1,390 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/sagtension/stretch_state_cache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include "models/base/binary_file_format.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+
+/// \par OVERVIEW
+///
+/// This struct is the cache file record for an entry.
+struct StretchStateCacheRecord {
+  std::uint64_t key;
+  double load_creep;
+  double load_load;
+  double temperature_creep;
+  double temperature_load;
+  double tension_horizontal_constraint;
+  std::int32_t type_polynomial_creep;
+  std::int32_t type_polynomial_load;
+};
+
+namespace {
+
+/// \var kMagic
+///   The string that identifies a cache file.
+const char kMagic[8] = {'O', 'T', 'L', 'S', 'S', 'T', 'R', 'C'};
+
+/// \par OVERVIEW
+///
+/// This struct is the cache file header.
+struct HeaderRecord {
+  binary_file::HeaderRecord common;
+  std::uint64_t size_records;
+};
+
+/// \brief Adds a cable component to the hash.
+void HashComponent(const CableComponent& component,
+                   binary_file::Hasher* hasher) {
+  hasher->AddDouble(component.coefficient_expansion_linear_thermal);
+  hasher->AddInt(component.coefficients_polynomial_creep.size());
+  for (auto iter = component.coefficients_polynomial_creep.cbegin();
+       iter != component.coefficients_polynomial_creep.cend(); iter++) {
+    hasher->AddDouble(*iter);
+  }
+  hasher->AddInt(component.coefficients_polynomial_loadstrain.size());
+  for (auto iter = component.coefficients_polynomial_loadstrain.cbegin();
+       iter != component.coefficients_polynomial_loadstrain.cend(); iter++) {
+    hasher->AddDouble(*iter);
+  }
+  hasher->AddDouble(component.load_limit_polynomial_creep);
+  hasher->AddDouble(component.load_limit_polynomial_loadstrain);
+  hasher->AddDouble(component.modulus_compression_elastic_area);
+  hasher->AddDouble(component.modulus_tension_elastic_area);
+  hasher->AddDouble(component.scale_polynomial_x);
+  hasher->AddDouble(component.scale_polynomial_y);
+}
+
+/// \brief Adds a weathercase to the hash.
+void HashWeathercase(const WeatherLoadCase& weathercase,
+                     binary_file::Hasher* hasher) {
+  hasher->AddDouble(weathercase.density_ice);
+  hasher->AddDouble(weathercase.pressure_wind);
+  hasher->AddDouble(weathercase.temperature_cable);
+  hasher->AddDouble(weathercase.thickness_ice);
+}
+
+/// \brief Converts an entry to a file record.
+StretchStateCacheRecord ToRecord(const std::uint64_t& key,
+                                 const StretchStateCacheEntry& entry) {
+  StretchStateCacheRecord record;
+  std::memset(&record, 0, sizeof(record));
+  record.key = key;
+  record.load_creep = entry.state_stretch_creep.load;
+  record.load_load = entry.state_stretch_load.load;
+  record.temperature_creep = entry.state_stretch_creep.temperature;
+  record.temperature_load = entry.state_stretch_load.temperature;
+  record.tension_horizontal_constraint = entry.tension_horizontal_constraint;
+  record.type_polynomial_creep =
+      static_cast<std::int32_t>(entry.state_stretch_creep.type_polynomial);
+  record.type_polynomial_load =
+      static_cast<std::int32_t>(entry.state_stretch_load.type_polynomial);
+  return record;
+}
+
+/// \brief Converts a file record to an entry.
+StretchStateCacheEntry ToEntry(const StretchStateCacheRecord& record) {
+  StretchStateCacheEntry entry;
+  entry.state_stretch_creep.load = record.load_creep;
+  entry.state_stretch_creep.temperature = record.temperature_creep;
+  entry.state_stretch_creep.type_polynomial =
+      static_cast<SagTensionCableComponent::PolynomialType>(
+          record.type_polynomial_creep);
+  entry.state_stretch_load.load = record.load_load;
+  entry.state_stretch_load.temperature = record.temperature_load;
+  entry.state_stretch_load.type_polynomial =
+      static_cast<SagTensionCableComponent::PolynomialType>(
+          record.type_polynomial_load);
+  entry.tension_horizontal_constraint = record.tension_horizontal_constraint;
+  return entry;
+}
+
+/// \brief Gets the records in a cache file.
+/// \param[in] data
+///   The file data.
+/// \param[in] size
+///   The file size, in bytes.
+/// \param[out] size_records
+///   The number of records.
+/// \return The records. If the file is not a valid cache file, a nullptr is
+///   returned.
+const StretchStateCacheRecord* Records(const char* data,
+                                       const std::size_t& size,
+                                       std::uint64_t* size_records) {
+  // checks header
+  if ((binary_file::IsValidHeader(data, size, kMagic,
+                                  StretchStateCache::kVersion) == false)
+      || (size < sizeof(HeaderRecord))) {
+    return nullptr;
+  }
+
+  const HeaderRecord& header = *reinterpret_cast<const HeaderRecord*>(data);
+
+  // checks that the records fill the rest of the file
+  const std::size_t size_data = size - sizeof(HeaderRecord);
+  if ((size_data % sizeof(StretchStateCacheRecord) != 0)
+      || (size_data / sizeof(StretchStateCacheRecord)
+          != header.size_records)) {
+    return nullptr;
+  }
+
+  // the records are not checked for sorting, so opening does not touch every
+  // page of the file
+  *size_records = header.size_records;
+  return reinterpret_cast<const StretchStateCacheRecord*>(
+      data + sizeof(HeaderRecord));
+}
+
+}  // namespace
+
+// the header size keeps the records aligned
+static_assert(sizeof(HeaderRecord) % 8 == 0,
+              "Cache header must be a multiple of 8 bytes.");
+
+StretchStateCacheEntry::StretchStateCacheEntry() {
+  tension_horizontal_constraint = -999999;
+}
+
+StretchStateCacheEntry::~StretchStateCacheEntry() {
+}
+
+const int StretchStateCache::kVersion = 1;
+
+StretchStateCache::StretchStateCache() {
+  records_ = nullptr;
+  size_records_ = 0;
+}
+
+StretchStateCache::~StretchStateCache() {
+}
+
+void StretchStateCache::Add(const std::uint64_t& key,
+                            const StretchStateCacheEntry& entry) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_added_[key] = entry;
+}
+
+void StretchStateCache::Close() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_added_.clear();
+  file_.Close();
+  records_ = nullptr;
+  size_records_ = 0;
+}
+
+bool StretchStateCache::Find(const std::uint64_t& key,
+                             StretchStateCacheEntry* entry) const {
+  // searches the added entries
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entries_added_.find(key);
+    if (iter != entries_added_.cend()) {
+      *entry = iter->second;
+      return true;
+    }
+  }
+
+  // searches the file records, which are not modified while open
+  const StretchStateCacheRecord* record = FindRecord(key);
+  if (record == nullptr) {
+    return false;
+  }
+
+  *entry = ToEntry(*record);
+  return true;
+}
+
+/// The values are hashed in a fixed order, and vector sizes are included so
+/// that values cannot shift between fields.
+std::uint64_t StretchStateCache::Key(const LineCable& line_cable) {
+  binary_file::Hasher hasher;
+  hasher.AddInt(kVersion);
+
+  // hashes the cable
+  const Cable& cable = *line_cable.cable();
+  HashComponent(cable.component_core, &hasher);
+  HashComponent(cable.component_shell, &hasher);
+  hasher.AddDouble(cable.diameter);
+  hasher.AddDouble(cable.strength_rated);
+  hasher.AddDouble(cable.temperature_properties_components);
+  hasher.AddDouble(cable.weight_unit);
+
+  // hashes the constraint
+  const CableConstraint constraint = line_cable.constraint();
+  HashWeathercase(*constraint.case_weather, &hasher);
+  hasher.AddInt(static_cast<std::int64_t>(constraint.condition));
+  hasher.AddDouble(constraint.limit);
+  hasher.AddInt(static_cast<std::int64_t>(constraint.type_limit));
+
+  // hashes the ruling span
+  const Vector3d spacing = line_cable.spacing_attachments_ruling_span();
+  hasher.AddDouble(spacing.x());
+  hasher.AddDouble(spacing.y());
+  hasher.AddDouble(spacing.z());
+
+  // hashes the stretch weathercases
+  HashWeathercase(*line_cable.weathercase_stretch_creep(), &hasher);
+  HashWeathercase(*line_cable.weathercase_stretch_load(), &hasher);
+
+  return hasher.hash();
+}
+
+bool StretchStateCache::Open(const std::string& filepath) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  file_.Close();
+  records_ = nullptr;
+  size_records_ = 0;
+
+  if (file_.Open(filepath) == false) {
+    return false;
+  }
+
+  if (Initialize() == false) {
+    file_.Close();
+    return false;
+  }
+
+  return true;
+}
+
+bool StretchStateCache::Write(const std::string& filepath) const {
+  // merges the entries in priority order, so newer entries replace older
+  // entries with the same key
+  std::map<std::uint64_t, StretchStateCacheRecord> records;
+
+  // gets the entries that are already in the target file, which may have been
+  // written by another process
+  MappedFile file_target;
+  if (file_target.Open(filepath) == true) {
+    std::uint64_t size_target = 0;
+    const StretchStateCacheRecord* records_target =
+        Records(file_target.data(), file_target.size(), &size_target);
+    for (std::uint64_t i = 0; i < size_target; i++) {
+      records[records_target[i].key] = records_target[i];
+    }
+  }
+  file_target.Close();
+
+  // gets the opened file and added entries
+  for (std::uint64_t i = 0; i < size_records_; i++) {
+    records[records_[i].key] = records_[i];
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto iter = entries_added_.cbegin(); iter != entries_added_.cend();
+         iter++) {
+      records[iter->first] = ToRecord(iter->first, iter->second);
+    }
+  }
+
+  // builds the file buffer
+  HeaderRecord header;
+  std::memset(&header, 0, sizeof(header));
+  header.common = binary_file::Header(kMagic, kVersion);
+  header.common.size_file =
+      sizeof(HeaderRecord) + records.size() * sizeof(StretchStateCacheRecord);
+  header.size_records = records.size();
+
+  std::vector<char> buffer(sizeof(HeaderRecord));
+  std::memcpy(buffer.data(), &header, sizeof(header));
+  buffer.reserve(header.common.size_file);
+  for (auto iter = records.cbegin(); iter != records.cend(); iter++) {
+    const char* data = reinterpret_cast<const char*>(&iter->second);
+    buffer.insert(buffer.end(), data, data + sizeof(StretchStateCacheRecord));
+  }
+
+  // writes to a temporary file, which is unique to the process
+  std::string filepath_temp = filepath + ".tmp";
+#if defined(__unix__) || defined(__APPLE__)
+  filepath_temp += std::to_string(getpid());
+#elif defined(_WIN32)
+  filepath_temp += std::to_string(GetCurrentProcessId());
+#endif
+
+  {
+    std::ofstream file(filepath_temp, std::ios::binary | std::ios::trunc);
+    if (file.is_open() == false) {
+      return false;
+    }
+
+    file.write(buffer.data(), buffer.size());
+    if (file.good() == false) {
+      file.close();
+      std::remove(filepath_temp.c_str());
+      return false;
+    }
+  }
+
+  // replaces the target file, which is atomic so the target is never missing
+  // or partially written
+#if defined(_WIN32)
+  const bool is_replaced = MoveFileExA(
+      filepath_temp.c_str(), filepath.c_str(),
+      MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+  const bool is_replaced =
+      std::rename(filepath_temp.c_str(), filepath.c_str()) == 0;
+#endif
+  if (is_replaced == false) {
+    std::remove(filepath_temp.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+/// Added entries that replace a file entry are only counted once.
+int StretchStateCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::uint64_t size = size_records_;
+  for (auto iter = entries_added_.cbegin(); iter != entries_added_.cend();
+       iter++) {
+    if (FindRecord(iter->first) == nullptr) {
+      size++;
+    }
+  }
+
+  return static_cast<int>(size);
+}
+
+const StretchStateCacheRecord* StretchStateCache::FindRecord(
+    const std::uint64_t& key) const {
+  const StretchStateCacheRecord* begin = records_;
+  const StretchStateCacheRecord* end = records_ + size_records_;
+  const StretchStateCacheRecord* record = std::lower_bound(
+      begin, end, key,
+      [](const StretchStateCacheRecord& a, const std::uint64_t& b) {
+        return a.key < b;
+      });
+  if ((record == end) || (record->key != key)) {
+    return nullptr;
+  }
+
+  return record;
+}
+
+bool StretchStateCache::Initialize() {
+  std::uint64_t size_records = 0;
+  const StretchStateCacheRecord* records =
+      Records(file_.data(), file_.size(), &size_records);
+  if (records == nullptr) {
+    return false;
+  }
+
+  records_ = records;
+  size_records_ = size_records;
+  return true;
+}
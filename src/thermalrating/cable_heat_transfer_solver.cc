@@ -132,7 +132,9 @@ bool CableHeatTransferSolver::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE HEAT TRANSFER SOLVER";
+  if (messages != nullptr) {
+    message.title = "CABLE HEAT TRANSFER SOLVER";
+  }
 
   // validates cable
   if (cable_ == nullptr) {
@@ -206,9 +208,8 @@ double CableHeatTransferSolver::HeatConvectionForced(
                          * weather_->speed_wind) / viscosity_air;
 
   // calculates wind direction factor
-  const double angle_wind_rad = units::ConvertAngle(
-      weather_->angle_wind,
-      units::AngleConversionType::kDegreesToRadians);
+  const double angle_wind_rad = units::Convert<units::Degrees, units::Radians>(
+      weather_->angle_wind);
 
   const double factor_wind_direction =
       1.194 - std::cos(angle_wind_rad)
@@ -20,7 +20,9 @@ bool CableHeatTransferState::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE HEAT TRANSFER STATE";
+  if (messages != nullptr) {
+    message.title = "CABLE HEAT TRANSFER STATE";
+  }
 
   // validates heat-convection
   if (0 < heat_convection) {
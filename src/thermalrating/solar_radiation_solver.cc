@@ -60,7 +60,9 @@ bool SolarRadiationSolver::Validate(const bool& /*is_included_warnings*/,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "SOLAR RADIATION SOLVER";
+  if (messages != nullptr) {
+    message.title = "SOLAR RADIATION SOLVER";
+  }
 
   // validates azimuth-cable
   if ((azimuth_cable_ < 0) || (360 < azimuth_cable_)) {
@@ -212,15 +214,12 @@ int SolarRadiationSolver::AngleHour(const int& hour) const {
 
 double SolarRadiationSolver::AngleIncidence() const {
   // converts terms to radians
-  const double altitude_sun_rad = units::ConvertAngle(
-      altitude_sun_,
-      units::AngleConversionType::kDegreesToRadians);
-  const double azimuth_sun_rad = units::ConvertAngle(
-      azimuth_sun_,
-      units::AngleConversionType::kDegreesToRadians);
-  const double azimuth_cable_rad = units::ConvertAngle(
-      azimuth_cable_,
-      units::AngleConversionType::kDegreesToRadians);
+  const double altitude_sun_rad =
+      units::Convert<units::Degrees, units::Radians>(altitude_sun_);
+  const double azimuth_sun_rad =
+      units::Convert<units::Degrees, units::Radians>(azimuth_sun_);
+  const double azimuth_cable_rad =
+      units::Convert<units::Degrees, units::Radians>(azimuth_cable_);
 
   // breaks down the into smaller chunks
   const double term1 = std::cos(altitude_sun_rad);
@@ -228,9 +227,8 @@ double SolarRadiationSolver::AngleIncidence() const {
 
   // calculates the incidence angle and converts to degrees
   double angle_incidence = std::acos(term1 * term2);
-  angle_incidence = units::ConvertAngle(
-      angle_incidence,
-      units::AngleConversionType::kRadiansToDegrees);
+  angle_incidence = units::Convert<units::Radians, units::Degrees>(
+      angle_incidence);
 
   return angle_incidence;
 }
@@ -238,9 +236,8 @@ double SolarRadiationSolver::AngleIncidence() const {
 double SolarRadiationSolver::Declination() const {
   // gets an angle based on day of year
   const double angle_degrees = static_cast<double>(284 + day_) / 365 * 360;
-  const double angle_radians = units::ConvertAngle(
-      angle_degrees,
-      units::AngleConversionType::kDegreesToRadians);
+  const double angle_radians =
+      units::Convert<units::Degrees, units::Radians>(angle_degrees);
 
   // scales to fit max declination
   return 23.46 * std::sin(angle_radians);
@@ -259,15 +256,12 @@ bool SolarRadiationSolver::SolveAltitudeSolar(
     const double& declination,
     const double& angle_hour) const {
   // converts terms to radians
-  const double angle_hour_rad = units::ConvertAngle(
-      angle_hour,
-      units::AngleConversionType::kDegreesToRadians);
-  const double declination_rad = units::ConvertAngle(
-      declination,
-      units::AngleConversionType::kDegreesToRadians);
-  const double latitude_rad = units::ConvertAngle(
-      latitude_,
-      units::AngleConversionType::kDegreesToRadians);
+  const double angle_hour_rad =
+      units::Convert<units::Degrees, units::Radians>(angle_hour);
+  const double declination_rad =
+      units::Convert<units::Degrees, units::Radians>(declination);
+  const double latitude_rad =
+      units::Convert<units::Degrees, units::Radians>(latitude_);
 
   // calculates the solar altitude
   const double term1 = std::cos(latitude_rad) * std::cos(declination_rad)
@@ -276,8 +270,7 @@ bool SolarRadiationSolver::SolveAltitudeSolar(
   altitude_sun_ = std::asin(term1 + term2);
 
   altitude_sun_ =
-      units::ConvertAngle(altitude_sun_,
-      units::AngleConversionType::kRadiansToDegrees);
+      units::Convert<units::Radians, units::Degrees>(altitude_sun_);
 
   return true;
 }
@@ -286,15 +279,12 @@ bool SolarRadiationSolver::SolveAzimuthSolar(
     const double& declination,
     const double& angle_hour) const {
   // converts terms to radians
-  const double angle_hour_rad = units::ConvertAngle(
-      angle_hour,
-      units::AngleConversionType::kDegreesToRadians);
-  const double declination_rad = units::ConvertAngle(
-      declination,
-      units::AngleConversionType::kDegreesToRadians);
-  const double latitude_rad = units::ConvertAngle(
-      latitude_,
-      units::AngleConversionType::kDegreesToRadians);
+  const double angle_hour_rad =
+      units::Convert<units::Degrees, units::Radians>(angle_hour);
+  const double declination_rad =
+      units::Convert<units::Degrees, units::Radians>(declination);
+  const double latitude_rad =
+      units::Convert<units::Degrees, units::Radians>(latitude_);
 
   // calculates the solar azimuth variable
   const double term1 = std::sin(angle_hour_rad);
@@ -321,9 +311,8 @@ bool SolarRadiationSolver::SolveAzimuthSolar(
   }
 
   // calculates solar azimuth
-  const double term4 = units::ConvertAngle(
-      std::atan(chi),
-      units::AngleConversionType::kRadiansToDegrees);
+  const double term4 =
+      units::Convert<units::Radians, units::Degrees>(std::atan(chi));
 
   azimuth_sun_ = kC + term4;
 
@@ -339,9 +328,8 @@ bool SolarRadiationSolver::SolveRadiation() const {
 
   // adjusts radiation based on incidence angle and elevation
   const double angle_incidence = AngleIncidence();
-  const double angle_incidence_rad = units::ConvertAngle(
-      angle_incidence,
-      units::AngleConversionType::kDegreesToRadians);
+  const double angle_incidence_rad =
+      units::Convert<units::Degrees, units::Radians>(angle_incidence);
 
   polynomial.set_coefficients(&coefficients_elevation_);
   const double factor_elevation_correction = polynomial.Y(elevation_);
@@ -47,7 +47,9 @@ bool SteadyCableCurrentSolver::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "STEADY CABLE CURRENT SOLVER";
+  if (messages != nullptr) {
+    message.title = "STEADY CABLE CURRENT SOLVER";
+  }
 
   // validates cable
   if (cable_ == nullptr) {
@@ -47,7 +47,9 @@ bool SteadyCableTemperatureSolver::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "STEADY CABLE TEMPERATURE SOLVER";
+  if (messages != nullptr) {
+    message.title = "STEADY CABLE TEMPERATURE SOLVER";
+  }
 
   // validates cable
   if (cable_ == nullptr) {
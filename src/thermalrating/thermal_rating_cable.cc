@@ -18,7 +18,9 @@ bool ThermalRatingCableComponent::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "THERMAL RATING CABLE COMPONENT";
+  if (messages != nullptr) {
+    message.title = "THERMAL RATING CABLE COMPONENT";
+  }
 
   // validates base component
   if (component_base_ == nullptr) {
@@ -119,7 +121,9 @@ bool ThermalRatingCable::Validate(const bool& is_included_warnings,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "THERMAL RATING CABLE";
+  if (messages != nullptr) {
+    message.title = "THERMAL RATING CABLE";
+  }
 
   // validates base cable
   if (cable_base_ == nullptr) {
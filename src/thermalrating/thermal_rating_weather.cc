@@ -20,7 +20,9 @@ bool ThermalRatingWeather::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "THERMAL RATING WEATHER";
+  if (messages != nullptr) {
+    message.title = "THERMAL RATING WEATHER";
+  }
 
   // validates angle-wind
   if ((angle_wind < 0) || (90 < angle_wind)) {
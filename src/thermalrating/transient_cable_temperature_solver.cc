@@ -37,7 +37,9 @@ bool TransientCableTemperatureSolver::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "TRANSIENT CABLE TEMPERATURE SOLVER";
+  if (messages != nullptr) {
+    message.title = "TRANSIENT CABLE TEMPERATURE SOLVER";
+  }
 
   // validates current-steady
   if (current_steady_ < 0) {
@@ -3,6 +3,7 @@
 
 #include "models/transmissionline/alignment.h"
 
+#include <algorithm>
 #include <cmath>
 
 AlignmentPoint::AlignmentPoint() {
@@ -19,7 +20,9 @@ bool AlignmentPoint::Validate(const bool& /*is_included_warnings*/,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "ALIGNMENT POINT";
+  if (messages != nullptr) {
+    message.title = "ALIGNMENT POINT";
+  }
 
   // validates elevation
   if (elevation < 0) {
@@ -60,26 +63,22 @@ Alignment::~Alignment() {
 }
 
 int Alignment::AddPoint(const AlignmentPoint& point) {
-  // searches list for the position to insert point
-  auto iter = points_.begin();
-  while (iter != points_.end()) {
-    const AlignmentPoint& point_list = *iter;
-    if (point.station < point_list.station) {
-      // position is found
-      break;
-    } else if (point.station == point_list.station) {
-      // exits due to duplicate station
-      return -1;
-    } else {
-      iter++;
-    }
+  // searches stations for the position to insert point
+  auto iter = std::lower_bound(stations_.cbegin(), stations_.cend(),
+                               point.station);
+
+  // exits due to duplicate station
+  if ((iter != stations_.cend()) && (*iter == point.station)) {
+    return -1;
   }
 
-  // inserts point into list
-  points_.insert(iter, point);
+  // inserts point and station into containers
+  const int index = std::distance(stations_.cbegin(), iter);
+  points_.insert(points_.cbegin() + index, point);
+  stations_.insert(stations_.cbegin() + index, point.station);
 
-  // gets index and returns
-  return std::distance(points_.begin(), iter) - 1;
+  // returns index
+  return index;
 }
 
 bool Alignment::DeletePoint(const int& index) {
@@ -88,9 +87,9 @@ bool Alignment::DeletePoint(const int& index) {
     return false;
   }
 
-  // gets iterator and erases point
-  auto iter = std::next(points_.cbegin(), index);
-  points_.erase(iter);
+  // erases point and station
+  points_.erase(points_.cbegin() + index);
+  stations_.erase(stations_.cbegin() + index);
 
   return true;
 }
@@ -102,32 +101,64 @@ int Alignment::IndexSegment(const double& station) const {
   }
 
   // checks for front point match
-  if (station == points_.front().station) {
+  if (station == stations_.front()) {
     return 0;
   }
 
-  // searches points for a position
-  auto iter = points_.cbegin();
-  while (iter != points_.cend()) {
-    const AlignmentPoint& point = *iter;
-    if (station <= point.station) {
-      break;
-    } else {
-      iter++;
+  // searches stations for the first point at or ahead of the station
+  auto iter = std::lower_bound(stations_.cbegin(), stations_.cend(), station);
+
+  // returns index
+  return std::distance(stations_.cbegin(), iter) - 1;
+}
+
+std::vector<int> Alignment::IndexesSegment(
+    const std::vector<double>& stations) const {
+  std::vector<int> indexes(stations.size(), -1);
+  if (stations_.empty() == true) {
+    return indexes;
+  }
+
+  // merges the stations with the alignment stations
+  // the segment index only moves ahead while the stations are ascending
+  const int kSizePoints = stations_.size();
+  const int kSizeStations = stations.size();
+  int index_segment = 0;
+  double station_prev = stations_.front();
+  for (int index = 0; index < kSizeStations; index++) {
+    const double& station = stations[index];
+
+    // checks station
+    if (IsValidStation(station) == false) {
+      continue;
+    }
+
+    // restarts with a binary search if the stations are not sorted
+    if (station < station_prev) {
+      index_segment = IndexSegment(station);
     }
+
+    // advances until the ahead point is at or ahead of the station
+    while ((index_segment < kSizePoints - 2)
+           && (stations_[index_segment + 1] < station)) {
+      index_segment++;
+    }
+
+    indexes[index] = index_segment;
+    station_prev = station;
   }
 
-  // returns index
-  return std::distance(points_.cbegin(), iter) - 1;
+  return indexes;
 }
 
 bool Alignment::IsValidStation(const double& station) const {
-  // gets the first and last alignment points
-  const AlignmentPoint& point_front = points_.front();
-  const AlignmentPoint& point_back = points_.back();
+  // checks if there are alignment points
+  if (stations_.empty() == true) {
+    return false;
+  }
 
   // checks if the station value is within range
-  return (point_front.station <= station) && (station <= point_back.station);
+  return (stations_.front() <= station) && (station <= stations_.back());
 }
 
 int Alignment::ModifyPoint(const int& index, const AlignmentPoint& point) {
@@ -137,7 +168,7 @@ int Alignment::ModifyPoint(const int& index, const AlignmentPoint& point) {
   }
 
   // caches specified point in case something goes wrong
-  AlignmentPoint point_cache = *std::next(points_.cbegin(), index);
+  AlignmentPoint point_cache = points_[index];
   if (DeletePoint(index) == false) {
     return -1;
   }
@@ -157,7 +188,9 @@ bool Alignment::Validate(const bool& is_included_warnings,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "ALIGNMENT";
+  if (messages != nullptr) {
+    message.title = "ALIGNMENT";
+  }
 
   // validates individual points and checks for ascending order
   const AlignmentPoint* point_prev = nullptr;
@@ -169,7 +202,11 @@ bool Alignment::Validate(const bool& is_included_warnings,
 
     if ((point_prev != nullptr)
          && (point.station < point_prev->station)) {
-      message.description = "Invalid point sorting";
+      is_valid = false;
+      if (messages != nullptr) {
+        message.description = "Invalid point sorting";
+        messages->push_back(message);
+      }
     }
 
     point_prev = &point;
@@ -178,7 +215,7 @@ bool Alignment::Validate(const bool& is_included_warnings,
   return is_valid;
 }
 
-const std::list<AlignmentPoint>* Alignment::points() const {
+const std::vector<AlignmentPoint>* Alignment::points() const {
   return &points_;
 }
 
@@ -50,7 +50,9 @@ bool Cable::Validate(const bool& is_included_warnings,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE";
+  if (messages != nullptr) {
+    message.title = "CABLE";
+  }
 
   // validates area-physical
   if (area_physical < 0) {
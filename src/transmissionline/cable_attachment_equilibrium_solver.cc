@@ -5,6 +5,8 @@
 
 #include <cmath>
 
+#include "models/base/units.h"
+
 CableAttachmentEquilibriumSolver::CableAttachmentEquilibriumSolver() {
   angle_catenaries_ = -999999;
   angle_hardware_ = -999999;
@@ -43,7 +45,9 @@ bool CableAttachmentEquilibriumSolver::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE ATTACHMENT EQUILIBRIUM SOLVER";
+  if (messages != nullptr) {
+    message.title = "CABLE ATTACHMENT EQUILIBRIUM SOLVER";
+  }
 
   // validates angle-catenaries
   if ((angle_catenaries_ < 0) || (180 < angle_catenaries_)) {
@@ -174,7 +178,11 @@ bool CableAttachmentEquilibriumSolver::Update() const {
 
   // solves for the amount to rotate each catenary tension vector so it
   // aligns with the class coordinate system
-  const double angle_rotate_xy = (180 - angle_catenaries_) / 2;
+  // the sine and cosine are solved once and shared by both catenaries
+  const double angle_rotate_xy = units::Convert<units::Degrees, units::Radians>(
+      (180 - angle_catenaries_) / 2);
+  const double cos_rotate_xy = std::cos(angle_rotate_xy);
+  const double sin_rotate_xy = std::sin(angle_rotate_xy);
 
   // solves cable tension vector
   // gets each catenary tension vector and rotates to align with coordinate
@@ -182,9 +190,9 @@ bool CableAttachmentEquilibriumSolver::Update() const {
   // sums the catenary tension vectors to get the cable tension vector
   tension = catenary_back_->Tension(1, AxisDirectionType::kNegative);
   if (direction_catenaries_ == AxisDirectionType::kPositive) {
-    tension.Rotate(Plane2dType::kXy, angle_rotate_xy * -1);
+    tension.RotateSinCos(Plane2dType::kXy, sin_rotate_xy * -1, cos_rotate_xy);
   } else {
-    tension.Rotate(Plane2dType::kXy, angle_rotate_xy);
+    tension.RotateSinCos(Plane2dType::kXy, sin_rotate_xy, cos_rotate_xy);
   }
 
   tension_cable_.set_x(tension.x());
@@ -193,9 +201,9 @@ bool CableAttachmentEquilibriumSolver::Update() const {
 
   tension = catenary_ahead_->Tension(0, AxisDirectionType::kPositive);
   if (direction_catenaries_ == AxisDirectionType::kPositive) {
-    tension.Rotate(Plane2dType::kXy, angle_rotate_xy);
+    tension.RotateSinCos(Plane2dType::kXy, sin_rotate_xy, cos_rotate_xy);
   } else {
-    tension.Rotate(Plane2dType::kXy, angle_rotate_xy * -1);
+    tension.RotateSinCos(Plane2dType::kXy, sin_rotate_xy * -1, cos_rotate_xy);
   }
 
   tension_cable_.set_x(tension_cable_.x() + tension.x());
@@ -206,16 +214,18 @@ bool CableAttachmentEquilibriumSolver::Update() const {
   // hardware angle unit vector, and then rotating to oppose cable vector
   const double tension_cable = tension_cable_.Magnitude();
 
-  tension_hardware_.set_z(1);
-  if (direction_catenaries_ == AxisDirectionType::kPositive) {
-    tension_hardware_.Rotate(Plane2dType::kZy, angle_hardware_);
-  } else {
-    tension_hardware_.Rotate(Plane2dType::kZy, 360 - angle_hardware_);
+  // the hardware unit vector is resolved directly from the hardware angle,
+  // and the 180 degree rotation is applied by reversing the scale
+  const double angle_hardware = units::Convert<units::Degrees, units::Radians>(
+      angle_hardware_);
+  double sin_hardware = std::sin(angle_hardware);
+  if (direction_catenaries_ != AxisDirectionType::kPositive) {
+    sin_hardware = sin_hardware * -1;
   }
-  tension_hardware_.set_x(tension_hardware_.x() * tension_cable);
-  tension_hardware_.set_y(tension_hardware_.y() * tension_cable);
-  tension_hardware_.set_z(tension_hardware_.z() * tension_cable);
-  tension_hardware_.Rotate(Plane2dType::kZy, 180);
+
+  tension_hardware_.set_y(sin_hardware);
+  tension_hardware_.set_z(std::cos(angle_hardware));
+  tension_hardware_.Scale(tension_cable * -1);
 
   // solves imbalance tension vector
   tension_imbalance_.set_x(-1 * (tension_hardware_.x() + tension_cable_.x()));
@@ -0,0 +1,938 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/cable_clearance_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include "models/transmissionline/catenary_functions.h"
+
+namespace {
+
+/// \brief Gets the squared distance between two points.
+/// \param[in] a
+///   The first point.
+/// \param[in] b
+///   The second point.
+/// \return The squared distance.
+double DistanceSquared(const Point3d<double>& a, const Point3d<double>& b) {
+  const double x = b.x - a.x;
+  const double y = b.y - a.y;
+  const double z = b.z - a.z;
+  return x * x + y * y + z * z;
+}
+
+/// \brief Gets the cross product of two vectors.
+/// \param[in] a
+///   The first vector.
+/// \param[in] b
+///   The second vector.
+/// \return The cross product.
+Point3d<double> Cross(const Point3d<double>& a, const Point3d<double>& b) {
+  return Point3d<double>(a.y * b.z - a.z * b.y,
+                         a.z * b.x - a.x * b.z,
+                         a.x * b.y - a.y * b.x);
+}
+
+/// \brief Gets the dot product of two vectors.
+/// \param[in] a
+///   The first vector.
+/// \param[in] b
+///   The second vector.
+/// \return The dot product.
+double Dot(const Point3d<double>& a, const Point3d<double>& b) {
+  return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+/// \brief Gets the length of a vector.
+/// \param[in] v
+///   The vector.
+/// \return The length.
+double Length(const Point3d<double>& v) {
+  return std::sqrt(Dot(v, v));
+}
+
+/// \brief Gets a vector plus two scaled vectors.
+/// \param[in] v
+///   The vector.
+/// \param[in] a
+///   The first vector to add.
+/// \param[in] scale_a
+///   The scale of the first vector to add.
+/// \param[in] b
+///   The second vector to add.
+/// \param[in] scale_b
+///   The scale of the second vector to add.
+/// \return The sum.
+Point3d<double> Sum(const Point3d<double>& v, const Point3d<double>& a,
+                    const double& scale_a, const Point3d<double>& b,
+                    const double& scale_b) {
+  return Point3d<double>(v.x + a.x * scale_a + b.x * scale_b,
+                         v.y + a.y * scale_a + b.y * scale_b,
+                         v.z + a.z * scale_a + b.z * scale_b);
+}
+
+/// \brief Gets the best distance of a clearance solution.
+/// \param[in] result
+///   The clearance solution.
+/// \return The distance, or infinity if the solution is not solved.
+double DistanceBest(const ClearanceResult& result) {
+  if (result.distance == -999999) {
+    return std::numeric_limits<double>::infinity();
+  }
+
+  return result.distance;
+}
+
+/// \var kToleranceDistance
+///   The length tolerance of a refined clearance. The refined clearance is not
+///   more than this above the true minimum.
+const double kToleranceDistance = 1e-6;
+
+/// \par OVERVIEW
+///
+/// This struct is a part of a span, or a fixed segment, that is bounded for a
+/// clearance search.
+///
+/// \par BOUNDS
+///
+/// The arc is contained in the parallelogram formed by its chord and its sag
+/// vector, which is the largest deviation of the curve from the chord. A
+/// fixed segment has no sag and is never split.
+struct SpanArc {
+  /// \var coordinate_begin
+  ///   The 2D catenary coordinate at the begin position.
+  Point2d<double> coordinate_begin;
+
+  /// \var coordinate_end
+  ///   The 2D catenary coordinate at the end position.
+  Point2d<double> coordinate_end;
+
+  /// \var point_begin
+  ///   The xyz point at the begin position.
+  Point3d<double> point_begin;
+
+  /// \var point_end
+  ///   The xyz point at the end position.
+  Point3d<double> point_end;
+
+  /// \var position_begin
+  ///   The begin position fraction along the span.
+  double position_begin;
+
+  /// \var position_end
+  ///   The end position fraction along the span.
+  double position_end;
+
+  /// \var sag
+  ///   The largest deviation of the curve from the chord, which is in the
+  ///   span sag direction.
+  double sag;
+
+  /// \var span
+  ///   The span geometry, or nullptr for a fixed segment.
+  const ClearanceSpanGeometry* span;
+};
+
+/// \par OVERVIEW
+///
+/// This struct is a pair of arcs that may contain the minimum clearance.
+struct SpanArcPair {
+  /// \var arc
+  ///   The arc on the cable.
+  SpanArc arc;
+
+  /// \var arc_other
+  ///   The arc on the other cable, or the fixed segment.
+  SpanArc arc_other;
+
+  /// \var distance_lower
+  ///   The lower bound of the distance between the arcs.
+  double distance_lower;
+};
+
+/// \brief Gets the distance from the origin to a segment.
+/// \param[in] start
+///   The segment start point, relative to the origin.
+/// \param[in] edge
+///   The vector from the segment start point to the end point.
+/// \return The distance.
+double DistanceSegment(const Point3d<double>& start,
+                       const Point3d<double>& edge) {
+  const double length_squared = Dot(edge, edge);
+  double t = 0;
+  if (0 < length_squared) {
+    t = std::min(1.0, std::max(0.0, -Dot(start, edge) / length_squared));
+  }
+  return Length(Sum(start, edge, t, edge, 0));
+}
+
+/// \brief Gets the distance from the origin to the interior of a
+///   parallelogram.
+/// \param[in] corner
+///   The parallelogram corner, relative to the origin.
+/// \param[in] edge_a
+///   The first edge vector.
+/// \param[in] edge_b
+///   The second edge vector.
+/// \return The distance, or infinity if the closest point on the plane is
+///   outside of the parallelogram.
+double DistanceParallelogramInterior(const Point3d<double>& corner,
+                                     const Point3d<double>& edge_a,
+                                     const Point3d<double>& edge_b) {
+  const double aa = Dot(edge_a, edge_a);
+  const double ab = Dot(edge_a, edge_b);
+  const double bb = Dot(edge_b, edge_b);
+  const double ac = Dot(edge_a, corner);
+  const double bc = Dot(edge_b, corner);
+  const double determinant = aa * bb - ab * ab;
+  if (determinant <= 0) {
+    return std::numeric_limits<double>::infinity();
+  }
+
+  const double a = (ab * bc - bb * ac) / determinant;
+  const double b = (ab * ac - aa * bc) / determinant;
+  if ((a < 0) || (1 < a) || (b < 0) || (1 < b)) {
+    return std::numeric_limits<double>::infinity();
+  }
+
+  return Length(Sum(corner, edge_a, a, edge_b, b));
+}
+
+/// \brief Gets the distance from the origin to a parallelepiped.
+/// \param[in] corner
+///   The parallelepiped corner, relative to the origin.
+/// \param[in] edges
+///   The three edge vectors.
+/// \return The distance, which is zero if the origin is inside.
+/// A flat parallelepiped is covered by its faces, so the faces and edges are
+/// searched whenever the origin is not found inside.
+double DistanceParallelepiped(const Point3d<double>& corner,
+                              const Point3d<double> edges[3]) {
+  // checks if the origin is inside
+  const Point3d<double> cross_bc = Cross(edges[1], edges[2]);
+  const double determinant = Dot(edges[0], cross_bc);
+  if (determinant != 0) {
+    const double a = -Dot(corner, cross_bc) / determinant;
+    const double b = -Dot(edges[0], Cross(corner, edges[2])) / determinant;
+    const double c = -Dot(edges[0], Cross(edges[1], corner)) / determinant;
+    if ((0 <= a) && (a <= 1) && (0 <= b) && (b <= 1)
+        && (0 <= c) && (c <= 1)) {
+      return 0;
+    }
+  }
+
+  double distance = std::numeric_limits<double>::infinity();
+  for (int k = 0; k < 3; k++) {
+    const Point3d<double>& edge = edges[k];
+    const Point3d<double>& edge_i = edges[(k + 1) % 3];
+    const Point3d<double>& edge_j = edges[(k + 2) % 3];
+
+    // searches the two faces that are normal to the edge
+    distance = std::min(distance,
+                        DistanceParallelogramInterior(corner, edge_i, edge_j));
+    distance = std::min(distance, DistanceParallelogramInterior(
+        Sum(corner, edge, 1, edge, 0), edge_i, edge_j));
+
+    // searches the four edges that are parallel to the edge
+    for (int i = 0; i <= 1; i++) {
+      for (int j = 0; j <= 1; j++) {
+        distance = std::min(distance, DistanceSegment(
+            Sum(corner, edge_i, i, edge_j, j), edge));
+      }
+    }
+  }
+
+  return distance;
+}
+
+/// \brief Gets a lower bound of the distance between two arcs, using the sag
+///   direction of the first arc.
+/// \param[in] arc
+///   The arc, which must be part of a span.
+/// \param[in] arc_other
+///   The other arc.
+/// \return The lower bound.
+/// The difference between points on the arcs is contained in a parallelepiped
+/// formed by the two chords and the sag direction of the first arc. The part
+/// of the other sag that is not in this direction is bounded by a sphere
+/// around half of it.
+double DistanceLowerBoundDirection(const SpanArc& arc,
+                                   const SpanArc& arc_other) {
+  const Vector3d& direction_sag = arc.span->direction_sag;
+  const Point3d<double> direction(direction_sag.x(), direction_sag.y(),
+                                  direction_sag.z());
+
+  // splits the other sag into the parallel and perpendicular parts
+  Point3d<double> sag_other(0, 0, 0);
+  if (arc_other.span != nullptr) {
+    const Vector3d& direction_other = arc_other.span->direction_sag;
+    sag_other = Point3d<double>(direction_other.x() * arc_other.sag,
+                                direction_other.y() * arc_other.sag,
+                                direction_other.z() * arc_other.sag);
+  }
+
+  const double sag_parallel = Dot(sag_other, direction);
+  const Point3d<double> sag_perpendicular =
+      Sum(sag_other, direction, -sag_parallel, direction, 0);
+
+  // solves the range of the combined sag along the direction
+  const double lower = std::min(0.0, -sag_parallel);
+  const double upper = arc.sag + std::max(0.0, -sag_parallel);
+
+  const Point3d<double> corner = Sum(
+      Sum(arc.point_begin, arc_other.point_begin, -1, sag_perpendicular, -0.5),
+      direction, lower, direction, 0);
+  const Point3d<double> edges[3] = {
+      Sum(arc.point_end, arc.point_begin, -1, direction, 0),
+      Sum(arc_other.point_begin, arc_other.point_end, -1, direction, 0),
+      Sum(Point3d<double>(0, 0, 0), direction, upper - lower, direction, 0)};
+
+  return DistanceParallelepiped(corner, edges)
+         - Length(sag_perpendicular) / 2;
+}
+
+/// \brief Gets a lower bound of the distance between two arcs.
+/// \param[in] arc
+///   The arc.
+/// \param[in] arc_other
+///   The other arc.
+/// \return The lower bound.
+/// The bound is solved with the sag direction of each span, and the larger
+/// bound is used. It is exact for parallel spans that sag in the same
+/// direction.
+double DistanceLowerBound(const SpanArc& arc, const SpanArc& arc_other) {
+  if (arc.span == nullptr) {
+    return DistanceLowerBoundDirection(arc_other, arc);
+  } else if (arc_other.span == nullptr) {
+    return DistanceLowerBoundDirection(arc, arc_other);
+  } else {
+    return std::max(DistanceLowerBoundDirection(arc, arc_other),
+                    DistanceLowerBoundDirection(arc_other, arc));
+  }
+}
+
+/// \brief Updates the sag of an arc from its end coordinates.
+/// \param[in,out] arc
+///   The arc.
+/// The largest deviation is where the curve tangent is parallel with the
+/// chord, which is solved directly from the catenary equation.
+void UpdateSag(SpanArc* arc) {
+  const Point2d<double>& begin = arc->coordinate_begin;
+  const Point2d<double>& end = arc->coordinate_end;
+  if (end.x <= begin.x) {
+    arc->sag = 0;
+    return;
+  }
+
+  const Catenary2d& catenary = arc->span->catenary_2d;
+  const double h = catenary.tension_horizontal();
+  const double w = catenary.weight_unit();
+  const double slope = (end.y - begin.y) / (end.x - begin.x);
+  const double x = std::min(end.x, std::max(
+      begin.x, catenary.Constant() * std::asinh(slope)));
+  arc->sag = std::max(
+      0.0,
+      begin.y + (x - begin.x) * slope - catenary::CoordinateY(h, w, x));
+}
+
+/// \brief Gets an arc that covers an entire span.
+/// \param[in] span
+///   The span geometry.
+/// \return The arc.
+SpanArc ArcSpan(const ClearanceSpanGeometry& span) {
+  SpanArc arc;
+  arc.span = &span;
+  arc.position_begin = 0;
+  arc.position_end = 1;
+  arc.coordinate_begin = span.catenary_2d.Coordinate(0);
+  arc.coordinate_end = span.catenary_2d.Coordinate(1);
+  arc.point_begin = CableClearanceSolver::PointSpan(span, 0);
+  arc.point_end = CableClearanceSolver::PointSpan(span, 1);
+  UpdateSag(&arc);
+
+  return arc;
+}
+
+/// \brief Gets a fixed segment arc.
+/// \param[in] point_begin
+///   The segment start point.
+/// \param[in] point_end
+///   The segment end point.
+/// \return The arc.
+SpanArc ArcSegment(const Point3d<double>& point_begin,
+                   const Point3d<double>& point_end) {
+  SpanArc arc;
+  arc.span = nullptr;
+  arc.position_begin = 0;
+  arc.position_end = 0;
+  arc.point_begin = point_begin;
+  arc.point_end = point_end;
+  arc.sag = 0;
+
+  return arc;
+}
+
+/// \brief Splits an arc at its middle position.
+/// \param[in] arc
+///   The arc.
+/// \param[out] first
+///   The first half.
+/// \param[out] second
+///   The second half.
+void SplitArc(const SpanArc& arc, SpanArc* first, SpanArc* second) {
+  const double position = (arc.position_begin + arc.position_end) / 2;
+  const Point2d<double> coordinate = arc.span->catenary_2d.Coordinate(position);
+  const Point3d<double> point =
+      CableClearanceSolver::PointSpan(*arc.span, position);
+
+  *first = arc;
+  first->position_end = position;
+  first->coordinate_end = coordinate;
+  first->point_end = point;
+  UpdateSag(first);
+
+  *second = arc;
+  second->position_begin = position;
+  second->coordinate_begin = coordinate;
+  second->point_begin = point;
+  UpdateSag(second);
+}
+
+/// \brief Determines if an arc can be split.
+/// \param[in] arc
+///   The arc.
+/// \return If the arc is part of a span and is not at the position fraction
+///   precision.
+bool IsSplittable(const SpanArc& arc) {
+  return (arc.span != nullptr)
+      && (1e-12 < (arc.position_end - arc.position_begin));
+}
+
+/// \brief Solves the minimum distance between two arcs.
+/// \param[in] arc
+///   The arc on the cable.
+/// \param[in] arc_other
+///   The arc on the other cable, or a fixed segment.
+/// \param[in] distance_max
+///   The distance to beat. Arcs that cannot be closer than this are skipped.
+/// \param[out] result
+///   The clearance solution. Only the distance and points are modified, and
+///   only if a closer distance is found.
+/// \return If a distance closer than the maximum was found.
+/// The arc pairs are split until the lower bound of every remaining pair is
+/// within the length tolerance of the best distance found. The best distance
+/// is updated from the arc end points, so it is always the distance between
+/// two points on the arcs.
+bool MinimizeArcs(const SpanArc& arc, const SpanArc& arc_other,
+                  const double& distance_max, ClearanceResult* result) {
+  double distance_best = distance_max;
+  bool is_found = false;
+
+  std::vector<SpanArcPair> stack;
+  SpanArcPair pair_root;
+  pair_root.arc = arc;
+  pair_root.arc_other = arc_other;
+  pair_root.distance_lower = DistanceLowerBound(arc, arc_other);
+  stack.push_back(pair_root);
+
+  while (stack.empty() == false) {
+    const SpanArcPair pair = stack.back();
+    stack.pop_back();
+
+    // skips pairs that cannot contain a closer distance
+    if (distance_best - kToleranceDistance <= pair.distance_lower) {
+      continue;
+    }
+
+    // updates the best distance from the end points
+    const Point3d<double>* points[2] = {&pair.arc.point_begin,
+                                        &pair.arc.point_end};
+    const Point3d<double>* points_other[2] = {&pair.arc_other.point_begin,
+                                              &pair.arc_other.point_end};
+    for (int i = 0; i < 2; i++) {
+      for (int j = 0; j < 2; j++) {
+        const double distance =
+            std::sqrt(DistanceSquared(*points[i], *points_other[j]));
+        if (distance < distance_best) {
+          distance_best = distance;
+          is_found = true;
+          result->distance = distance;
+          result->point_cable = *points[i];
+          result->point_other = *points_other[j];
+        }
+      }
+    }
+
+    if (distance_best - kToleranceDistance <= pair.distance_lower) {
+      continue;
+    }
+
+    // splits the longer arc that can be split
+    const bool is_splittable = IsSplittable(pair.arc);
+    const bool is_splittable_other = IsSplittable(pair.arc_other);
+    if ((is_splittable == false) && (is_splittable_other == false)) {
+      continue;
+    }
+
+    bool is_split_other = is_splittable_other;
+    if ((is_splittable == true) && (is_splittable_other == true)) {
+      is_split_other =
+          DistanceSquared(pair.arc.point_begin, pair.arc.point_end)
+          < DistanceSquared(pair.arc_other.point_begin,
+                            pair.arc_other.point_end);
+    }
+
+    SpanArcPair pair_first = pair;
+    SpanArcPair pair_second = pair;
+    if (is_split_other == false) {
+      SplitArc(pair.arc, &pair_first.arc, &pair_second.arc);
+    } else {
+      SplitArc(pair.arc_other, &pair_first.arc_other,
+               &pair_second.arc_other);
+    }
+
+    pair_first.distance_lower =
+        DistanceLowerBound(pair_first.arc, pair_first.arc_other);
+    pair_second.distance_lower =
+        DistanceLowerBound(pair_second.arc, pair_second.arc_other);
+
+    // pushes the farther pair first, so the nearer pair is visited first
+    if (pair_first.distance_lower < pair_second.distance_lower) {
+      stack.push_back(pair_second);
+      stack.push_back(pair_first);
+    } else {
+      stack.push_back(pair_first);
+      stack.push_back(pair_second);
+    }
+  }
+
+  return is_found;
+}
+
+}  // namespace
+
+CableClearanceSolver::CableClearanceSolver() {
+  cables_ = nullptr;
+  points_terrain_ = nullptr;
+
+  is_updated_spans_ = false;
+  is_updated_terrain_ = false;
+}
+
+CableClearanceSolver::~CableClearanceSolver() {
+}
+
+ClearanceResult CableClearanceSolver::ClearanceCables(
+    const int& index_cable,
+    const int& index_cable_other) const {
+  ClearanceResult result;
+
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return result;
+  }
+
+  // checks indexes
+  const int kSizeCables = cables_->size();
+  if ((index_cable < 0) || (kSizeCables <= index_cable)
+      || (index_cable_other < 0) || (kSizeCables <= index_cable_other)
+      || (index_cable == index_cable_other)) {
+    return result;
+  }
+
+  // refines every span pair that the hierarchies cannot rule out
+  const std::vector<ClearanceSpanGeometry>& spans = spans_[index_cable];
+  const std::vector<ClearanceSpanGeometry>& spans_other =
+      spans_[index_cable_other];
+
+  // each span pair only searches for a distance closer than the best so far
+  auto distance_spans = [&](const int& index_span,
+                            const int& index_span_other) {
+    ClearanceResult solution;
+    if (RefineSpans(spans[index_span], spans_other[index_span_other],
+                    DistanceBest(result), &solution) == false) {
+      return std::numeric_limits<double>::infinity();
+    }
+
+    result = solution;
+    result.index_span = index_span;
+    result.index_other = index_span_other;
+    return solution.distance;
+  };
+
+  BoundingVolumeHierarchy::DistanceMinimum(
+      hierarchies_cable_[index_cable],
+      hierarchies_cable_[index_cable_other],
+      distance_spans);
+
+  return result;
+}
+
+ClearanceResult CableClearanceSolver::ClearancePoint(
+    const ClearanceSpanGeometry& span,
+    const Point3d<double>& point) {
+  ClearanceResult result;
+  MinimizeArcs(ArcSpan(span), ArcSegment(point, point),
+               std::numeric_limits<double>::infinity(), &result);
+
+  return result;
+}
+
+ClearanceResult CableClearanceSolver::ClearanceTerrain(
+    const int& index_cable) const {
+  ClearanceResult result;
+
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return result;
+  }
+
+  // checks index
+  const int kSizeCables = cables_->size();
+  if ((index_cable < 0) || (kSizeCables <= index_cable)) {
+    return result;
+  }
+
+  // refines every span and terrain segment pair that the hierarchies cannot
+  // rule out
+  const std::vector<ClearanceSpanGeometry>& spans = spans_[index_cable];
+
+  // each span and segment pair only searches for a distance closer than the
+  // best so far
+  auto distance_segments = [&](const int& index_span,
+                               const int& index_segment) {
+    ClearanceResult solution;
+    if (RefineTerrain(spans[index_span],
+                      (*points_terrain_)[index_segment],
+                      (*points_terrain_)[index_segment + 1],
+                      DistanceBest(result), &solution) == false) {
+      return std::numeric_limits<double>::infinity();
+    }
+
+    result = solution;
+    result.index_span = index_span;
+    result.index_other = index_segment;
+    return solution.distance;
+  };
+
+  BoundingVolumeHierarchy::DistanceMinimum(hierarchies_cable_[index_cable],
+                                           hierarchy_terrain_,
+                                           distance_segments);
+
+  return result;
+}
+
+Point3d<double> CableClearanceSolver::PointSpan(
+    const ClearanceSpanGeometry& span,
+    const double& position_fraction) {
+  const Point3d<double> point = span.catenary.Coordinate(position_fraction);
+
+  // rotates from the span coordinate system and translates to the back
+  // attachment
+  return Point3d<double>(
+      span.point_back.x + point.x * span.angle_xy_cos
+                        - point.y * span.angle_xy_sin,
+      span.point_back.y + point.x * span.angle_xy_sin
+                        + point.y * span.angle_xy_cos,
+      span.point_back.z + point.z);
+}
+
+bool CableClearanceSolver::SolveSpanGeometry(const ClearanceCable& cable,
+                                             const int& index_span,
+                                             ClearanceSpanGeometry* span) {
+  // checks index
+  const int kSizeSpans = static_cast<int>(cable.points_attachment.size()) - 1;
+  if ((index_span < 0) || (kSizeSpans <= index_span)) {
+    return false;
+  }
+
+  const Point3d<double>& point_back = cable.points_attachment[index_span];
+  const Point3d<double>& point_ahead = cable.points_attachment[index_span + 1];
+
+  // solves the span direction in the xy plane
+  const double x = point_ahead.x - point_back.x;
+  const double y = point_ahead.y - point_back.y;
+  const double length_xy = std::sqrt(x * x + y * y);
+  if (length_xy == 0) {
+    return false;
+  }
+
+  span->angle_xy_cos = x / length_xy;
+  span->angle_xy_sin = y / length_xy;
+  span->point_back = point_back;
+
+  // builds the span catenary
+  span->catenary.set_direction_transverse(cable.direction_transverse);
+  span->catenary.set_spacing_endpoints(
+      Vector3d(length_xy, 0, point_ahead.z - point_back.z));
+  span->catenary.set_tension_horizontal(cable.tension_horizontal);
+  span->catenary.set_weight_unit(cable.weight_unit);
+  if (span->catenary.Validate(false, nullptr) == false) {
+    return false;
+  }
+
+  // builds the 2D catenary, which matches the span catenary position
+  // fractions
+  const CatenaryProjection projection = span->catenary.Projection();
+  span->catenary_2d.set_spacing_endpoints(projection.spacing_endpoints);
+  span->catenary_2d.set_tension_horizontal(cable.tension_horizontal);
+  span->catenary_2d.set_weight_unit(projection.weight_unit);
+  if (span->catenary_2d.Validate(false, nullptr) == false) {
+    return false;
+  }
+
+  // solves the sag vector, which is the largest deviation from the chord
+  const double position_sag = span->catenary.PositionFractionSagPoint();
+  const Point3d<double> point_curve = PointSpan(*span, position_sag);
+  const Point3d<double> point_chord =
+      span->catenary.CoordinateChord(position_sag);
+  const Point3d<double> point_chord_xyz(
+      point_back.x + point_chord.x * span->angle_xy_cos
+                   - point_chord.y * span->angle_xy_sin,
+      point_back.y + point_chord.x * span->angle_xy_sin
+                   + point_chord.y * span->angle_xy_cos,
+      point_back.z + point_chord.z);
+  const double sag_x = point_curve.x - point_chord_xyz.x;
+  const double sag_y = point_curve.y - point_chord_xyz.y;
+  const double sag_z = point_curve.z - point_chord_xyz.z;
+  const double sag = std::sqrt(sag_x * sag_x + sag_y * sag_y + sag_z * sag_z);
+  if (sag <= 0) {
+    return false;
+  }
+
+  span->direction_sag = Vector3d(sag_x / sag, sag_y / sag, sag_z / sag);
+
+  // bounds the parallelogram of the chord and sag vector
+  BoundingBox3d& box = span->box;
+  box = BoundingBox3d();
+  box.Expand(point_back);
+  box.Expand(point_ahead);
+  box.Expand(Point3d<double>(point_back.x + sag_x,
+                             point_back.y + sag_y,
+                             point_back.z + sag_z));
+  box.Expand(Point3d<double>(point_ahead.x + sag_x,
+                             point_ahead.y + sag_y,
+                             point_ahead.z + sag_z));
+
+  return true;
+}
+
+bool CableClearanceSolver::Validate(const bool& /*is_included_warnings*/,
+                                    std::list<ErrorMessage>* messages) const {
+  // initializes
+  bool is_valid = true;
+  ErrorMessage message;
+  if (messages != nullptr) {
+    message.title = "CABLE CLEARANCE SOLVER";
+  }
+
+  // validates cables
+  if (cables_ == nullptr) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid cables";
+      messages->push_back(message);
+    }
+  } else {
+    const int kSizeCables = cables_->size();
+    for (int index = 0; index < kSizeCables; index++) {
+      const ClearanceCable& cable = (*cables_)[index];
+
+      if (cable.direction_transverse == AxisDirectionType::kNull) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Cable " + std::to_string(index)
+                                + ": Invalid transverse direction";
+          messages->push_back(message);
+        }
+      }
+
+      if (cable.points_attachment.size() < 2) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Cable " + std::to_string(index)
+                                + ": Invalid attachment points. At least two "
+                                "points are required";
+          messages->push_back(message);
+        }
+      }
+
+      if (cable.tension_horizontal <= 0) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Cable " + std::to_string(index)
+                                + ": Invalid horizontal tension";
+          messages->push_back(message);
+        }
+      }
+
+      if (cable.weight_unit.y() < 0) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Cable " + std::to_string(index)
+                                + ": Invalid transverse unit weight";
+          messages->push_back(message);
+        }
+      }
+
+      if (cable.weight_unit.z() <= 0) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Cable " + std::to_string(index)
+                                + ": Invalid vertical unit weight";
+          messages->push_back(message);
+        }
+      }
+    }
+  }
+
+  // returns if errors are present
+  if (is_valid == false) {
+    return is_valid;
+  }
+
+  // validates update process
+  if (Update() == false) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Error updating class. Could not solve for span "
+                            "geometry.";
+      messages->push_back(message);
+    }
+  }
+
+  return is_valid;
+}
+
+const std::vector<ClearanceCable>* CableClearanceSolver::cables() const {
+  return cables_;
+}
+
+const std::vector<Point3d<double>>* CableClearanceSolver::points_terrain()
+    const {
+  return points_terrain_;
+}
+
+void CableClearanceSolver::set_cables(
+    const std::vector<ClearanceCable>* cables) {
+  cables_ = cables;
+
+  is_updated_spans_ = false;
+}
+
+void CableClearanceSolver::set_points_terrain(
+    const std::vector<Point3d<double>>* points_terrain) {
+  points_terrain_ = points_terrain;
+
+  is_updated_terrain_ = false;
+}
+
+bool CableClearanceSolver::IsUpdated() const {
+  return (is_updated_spans_ == true) && (is_updated_terrain_ == true);
+}
+
+bool CableClearanceSolver::RefineSpans(
+    const ClearanceSpanGeometry& span,
+    const ClearanceSpanGeometry& span_other,
+    const double& distance_max,
+    ClearanceResult* result) {
+  return MinimizeArcs(ArcSpan(span), ArcSpan(span_other), distance_max,
+                      result);
+}
+
+bool CableClearanceSolver::RefineTerrain(const ClearanceSpanGeometry& span,
+                                         const Point3d<double>& point_start,
+                                         const Point3d<double>& point_end,
+                                         const double& distance_max,
+                                         ClearanceResult* result) {
+  return MinimizeArcs(ArcSpan(span), ArcSegment(point_start, point_end),
+                      distance_max, result);
+}
+
+bool CableClearanceSolver::Update() const {
+  // updates spans
+  if (is_updated_spans_ == false) {
+    is_updated_spans_ = UpdateSpans();
+    if (is_updated_spans_ == false) {
+      return false;
+    }
+  }
+
+  // updates terrain
+  if (is_updated_terrain_ == false) {
+    is_updated_terrain_ = UpdateTerrain();
+    if (is_updated_terrain_ == false) {
+      return false;
+    }
+  }
+
+  // if it reaches this point, update was successful
+  return true;
+}
+
+bool CableClearanceSolver::UpdateSpans() const {
+  spans_.clear();
+  hierarchies_cable_.clear();
+
+  if (cables_ == nullptr) {
+    return false;
+  }
+
+  const int kSizeCables = cables_->size();
+  spans_.resize(kSizeCables);
+  hierarchies_cable_.resize(kSizeCables);
+
+  for (int index_cable = 0; index_cable < kSizeCables; index_cable++) {
+    const ClearanceCable& cable = (*cables_)[index_cable];
+    std::vector<ClearanceSpanGeometry>& spans = spans_[index_cable];
+
+    const int kSizeSpans = static_cast<int>(cable.points_attachment.size()) - 1;
+    if (kSizeSpans < 1) {
+      return false;
+    }
+
+    spans.resize(kSizeSpans);
+    std::vector<BoundingBox3d> boxes(kSizeSpans);
+    for (int index = 0; index < kSizeSpans; index++) {
+      ClearanceSpanGeometry& span = spans[index];
+      if (SolveSpanGeometry(cable, index, &span) == false) {
+        return false;
+      }
+
+      boxes[index] = span.box;
+    }
+
+    hierarchies_cable_[index_cable].Build(boxes);
+  }
+
+  return true;
+}
+
+bool CableClearanceSolver::UpdateTerrain() const {
+  hierarchy_terrain_.Clear();
+
+  // the terrain profile is optional
+  if (points_terrain_ == nullptr) {
+    return true;
+  }
+
+  // bounds every terrain segment
+  const int kSizeSegments = static_cast<int>(points_terrain_->size()) - 1;
+  if (kSizeSegments < 1) {
+    return true;
+  }
+
+  std::vector<BoundingBox3d> boxes(kSizeSegments);
+  for (int index = 0; index < kSizeSegments; index++) {
+    boxes[index].Expand((*points_terrain_)[index]);
+    boxes[index].Expand((*points_terrain_)[index + 1]);
+  }
+
+  hierarchy_terrain_.Build(boxes);
+
+  return true;
+}
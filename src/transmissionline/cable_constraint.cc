@@ -18,7 +18,9 @@ bool CableConstraint::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE CONSTRAINT";
+  if (messages != nullptr) {
+    message.title = "CABLE CONSTRAINT";
+  }
 
   // validates case-weather
   if (case_weather == nullptr) {
@@ -0,0 +1,583 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/cable_library.h"
+
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+#include "models/base/binary_file_format.h"
+
+/// \par OVERVIEW
+///
+/// This struct is the library record for a cable component.
+struct CableLibraryComponentRecord {
+  double capacity_heat;
+  double coefficient_expansion_linear_thermal;
+  double load_limit_polynomial_creep;
+  double load_limit_polynomial_loadstrain;
+  double modulus_compression_elastic_area;
+  double modulus_tension_elastic_area;
+  double scale_polynomial_x;
+  double scale_polynomial_y;
+  std::uint32_t begin_coefficients_creep;
+  std::uint32_t begin_coefficients_loadstrain;
+  std::uint32_t size_coefficients_creep;
+  std::uint32_t size_coefficients_loadstrain;
+};
+
+/// \par OVERVIEW
+///
+/// This struct is the library record for a cable.
+struct CableLibraryRecord {
+  double absorptivity;
+  double area_physical;
+  CableLibraryComponentRecord component_core;
+  CableLibraryComponentRecord component_shell;
+  double diameter;
+  double emissivity;
+  double strength_rated;
+  double temperature_properties_components;
+  double weight_unit;
+  std::uint32_t begin_resistances;
+  std::uint32_t length_name;
+  std::uint32_t offset_name;
+  std::uint32_t size_resistances;
+};
+
+namespace {
+
+// the resistance points are stored in the file as-is
+static_assert(std::is_standard_layout<Cable::ResistancePoint>::value
+              && (sizeof(Cable::ResistancePoint) == 2 * sizeof(double)),
+              "Resistance points must be two packed doubles.");
+
+/// \par OVERVIEW
+///
+/// This enum contains the library sections, in file order.
+enum SectionIndex {
+  kSectionStrings,
+  kSectionCables,
+  kSectionCoefficients,
+  kSectionResistances,
+  kSectionBuckets,
+  kSizeSections
+};
+
+/// \var kMagic
+///   The string that identifies a library file.
+const char kMagic[8] = {'O', 'T', 'L', 'S', 'C', 'B', 'L', 'E'};
+
+/// \par OVERVIEW
+///
+/// This struct is the library header.
+struct HeaderRecord {
+  binary_file::HeaderRecord common;
+  binary_file::SectionRecord sections[kSizeSections];
+};
+
+/// \var kSizesRecord
+///   The record size of each section, in bytes.
+const std::size_t kSizesRecord[kSizeSections] = {
+  sizeof(char),
+  sizeof(CableLibraryRecord),
+  sizeof(double),
+  sizeof(Cable::ResistancePoint),
+  sizeof(std::uint32_t)
+};
+
+/// \brief Hashes a name.
+/// \param[in] data
+///   The name characters.
+/// \param[in] length
+///   The name length.
+/// \return The hash value.
+std::uint64_t HashName(const char* data, const std::size_t& length) {
+  binary_file::Hasher hasher;
+  hasher.AddBytes(data, length);
+  return hasher.hash();
+}
+
+/// \brief Converts a cable component to a library record.
+CableLibraryComponentRecord ToRecord(const CableComponent& component,
+                                     std::vector<double>* coefficients) {
+  CableLibraryComponentRecord record;
+  std::memset(&record, 0, sizeof(record));
+  record.capacity_heat = component.capacity_heat;
+  record.coefficient_expansion_linear_thermal =
+      component.coefficient_expansion_linear_thermal;
+  record.load_limit_polynomial_creep = component.load_limit_polynomial_creep;
+  record.load_limit_polynomial_loadstrain =
+      component.load_limit_polynomial_loadstrain;
+  record.modulus_compression_elastic_area =
+      component.modulus_compression_elastic_area;
+  record.modulus_tension_elastic_area = component.modulus_tension_elastic_area;
+  record.scale_polynomial_x = component.scale_polynomial_x;
+  record.scale_polynomial_y = component.scale_polynomial_y;
+
+  record.begin_coefficients_creep = coefficients->size();
+  record.size_coefficients_creep =
+      component.coefficients_polynomial_creep.size();
+  coefficients->insert(coefficients->end(),
+                       component.coefficients_polynomial_creep.cbegin(),
+                       component.coefficients_polynomial_creep.cend());
+
+  record.begin_coefficients_loadstrain = coefficients->size();
+  record.size_coefficients_loadstrain =
+      component.coefficients_polynomial_loadstrain.size();
+  coefficients->insert(coefficients->end(),
+                       component.coefficients_polynomial_loadstrain.cbegin(),
+                       component.coefficients_polynomial_loadstrain.cend());
+
+  return record;
+}
+
+}  // namespace
+
+CableComponentView::CableComponentView() {
+  coefficients_ = nullptr;
+  record_ = nullptr;
+}
+
+CableComponentView::CableComponentView(
+    const CableLibraryComponentRecord* record,
+    const double* coefficients) {
+  coefficients_ = coefficients;
+  record_ = record;
+}
+
+CableComponent CableComponentView::ToCableComponent() const {
+  CableComponent component;
+  component.capacity_heat = capacity_heat();
+  component.coefficient_expansion_linear_thermal =
+      coefficient_expansion_linear_thermal();
+  component.coefficients_polynomial_creep.assign(
+      coefficients_polynomial_creep(),
+      coefficients_polynomial_creep() + size_coefficients_polynomial_creep());
+  component.coefficients_polynomial_loadstrain.assign(
+      coefficients_polynomial_loadstrain(),
+      coefficients_polynomial_loadstrain()
+          + size_coefficients_polynomial_loadstrain());
+  component.load_limit_polynomial_creep = load_limit_polynomial_creep();
+  component.load_limit_polynomial_loadstrain =
+      load_limit_polynomial_loadstrain();
+  component.modulus_compression_elastic_area =
+      modulus_compression_elastic_area();
+  component.modulus_tension_elastic_area = modulus_tension_elastic_area();
+  component.scale_polynomial_x = scale_polynomial_x();
+  component.scale_polynomial_y = scale_polynomial_y();
+  return component;
+}
+
+double CableComponentView::capacity_heat() const {
+  return record_->capacity_heat;
+}
+
+double CableComponentView::coefficient_expansion_linear_thermal() const {
+  return record_->coefficient_expansion_linear_thermal;
+}
+
+const double* CableComponentView::coefficients_polynomial_creep() const {
+  return coefficients_ + record_->begin_coefficients_creep;
+}
+
+const double* CableComponentView::coefficients_polynomial_loadstrain() const {
+  return coefficients_ + record_->begin_coefficients_loadstrain;
+}
+
+double CableComponentView::load_limit_polynomial_creep() const {
+  return record_->load_limit_polynomial_creep;
+}
+
+double CableComponentView::load_limit_polynomial_loadstrain() const {
+  return record_->load_limit_polynomial_loadstrain;
+}
+
+double CableComponentView::modulus_compression_elastic_area() const {
+  return record_->modulus_compression_elastic_area;
+}
+
+double CableComponentView::modulus_tension_elastic_area() const {
+  return record_->modulus_tension_elastic_area;
+}
+
+double CableComponentView::scale_polynomial_x() const {
+  return record_->scale_polynomial_x;
+}
+
+double CableComponentView::scale_polynomial_y() const {
+  return record_->scale_polynomial_y;
+}
+
+int CableComponentView::size_coefficients_polynomial_creep() const {
+  return record_->size_coefficients_creep;
+}
+
+int CableComponentView::size_coefficients_polynomial_loadstrain() const {
+  return record_->size_coefficients_loadstrain;
+}
+
+CableView::CableView() {
+  coefficients_ = nullptr;
+  record_ = nullptr;
+  resistances_ = nullptr;
+  strings_ = nullptr;
+}
+
+CableView::CableView(const CableLibraryRecord* record,
+                     const char* strings,
+                     const double* coefficients,
+                     const Cable::ResistancePoint* resistances) {
+  coefficients_ = coefficients;
+  record_ = record;
+  resistances_ = resistances;
+  strings_ = strings;
+}
+
+Cable CableView::ToCable() const {
+  Cable cable;
+  cable.absorptivity = absorptivity();
+  cable.area_physical = area_physical();
+  cable.component_core = component_core().ToCableComponent();
+  cable.component_shell = component_shell().ToCableComponent();
+  cable.diameter = diameter();
+  cable.emissivity = emissivity();
+  cable.name.assign(name(), size_name());
+  cable.resistances_ac.assign(resistances_ac(),
+                              resistances_ac() + size_resistances_ac());
+  cable.strength_rated = strength_rated();
+  cable.temperature_properties_components =
+      temperature_properties_components();
+  cable.weight_unit = weight_unit();
+  return cable;
+}
+
+double CableView::absorptivity() const {
+  return record_->absorptivity;
+}
+
+double CableView::area_physical() const {
+  return record_->area_physical;
+}
+
+CableComponentView CableView::component_core() const {
+  return CableComponentView(&record_->component_core, coefficients_);
+}
+
+CableComponentView CableView::component_shell() const {
+  return CableComponentView(&record_->component_shell, coefficients_);
+}
+
+double CableView::diameter() const {
+  return record_->diameter;
+}
+
+double CableView::emissivity() const {
+  return record_->emissivity;
+}
+
+const char* CableView::name() const {
+  return strings_ + record_->offset_name;
+}
+
+const Cable::ResistancePoint* CableView::resistances_ac() const {
+  return resistances_ + record_->begin_resistances;
+}
+
+int CableView::size_name() const {
+  return record_->length_name;
+}
+
+int CableView::size_resistances_ac() const {
+  return record_->size_resistances;
+}
+
+double CableView::strength_rated() const {
+  return record_->strength_rated;
+}
+
+double CableView::temperature_properties_components() const {
+  return record_->temperature_properties_components;
+}
+
+double CableView::weight_unit() const {
+  return record_->weight_unit;
+}
+
+const int CableLibrary::kVersion = 1;
+
+CableLibrary::CableLibrary() {
+  buckets_ = nullptr;
+  size_buckets_ = 0;
+}
+
+CableLibrary::~CableLibrary() {
+}
+
+void CableLibrary::Close() {
+  buckets_ = nullptr;
+  cables_.clear();
+  file_.Close();
+  size_buckets_ = 0;
+  views_.clear();
+}
+
+const Cable* CableLibrary::CableObject(const int& index) const {
+  const CableView* view = View(index);
+  if (view == nullptr) {
+    return nullptr;
+  }
+
+  // builds the cable object on first request
+  std::unique_ptr<Cable>& cable = cables_[index];
+  if (cable == nullptr) {
+    cable.reset(new Cable(view->ToCable()));
+  }
+
+  return cable.get();
+}
+
+int CableLibrary::IndexCable(const std::string& name) const {
+  if (size_buckets_ == 0) {
+    return -1;
+  }
+
+  // probes the hash table until the name or an empty bucket is found
+  const std::uint32_t kMask = size_buckets_ - 1;
+  std::uint32_t index_bucket = HashName(name.data(), name.size()) & kMask;
+  while (buckets_[index_bucket] != 0) {
+    const int index = buckets_[index_bucket] - 1;
+    const CableView& view = views_[index];
+    if ((view.size_name() == static_cast<int>(name.size()))
+        && (std::memcmp(view.name(), name.data(), name.size()) == 0)) {
+      return index;
+    }
+
+    index_bucket = (index_bucket + 1) & kMask;
+  }
+
+  return -1;
+}
+
+bool CableLibrary::Open(const std::string& filepath) {
+  Close();
+
+  if (file_.Open(filepath) == false) {
+    return false;
+  }
+
+  if (Initialize() == false) {
+    Close();
+    return false;
+  }
+
+  return true;
+}
+
+bool CableLibrary::Serialize(const std::vector<Cable>& cables,
+                             std::vector<char>* buffer) {
+  if (buffer == nullptr) {
+    return false;
+  }
+
+  // sizes the hash table to a power of two that is at least twice the number
+  // of cables, so probe sequences stay short
+  std::uint32_t size_buckets = 1;
+  while (size_buckets < 2 * cables.size()) {
+    size_buckets *= 2;
+  }
+
+  std::vector<char> strings;
+  std::vector<CableLibraryRecord> records;
+  std::vector<double> coefficients;
+  std::vector<Cable::ResistancePoint> resistances;
+  std::vector<std::uint32_t> buckets(size_buckets, 0);
+
+  for (auto iter = cables.cbegin(); iter != cables.cend(); iter++) {
+    const Cable& cable = *iter;
+    const std::uint32_t index = records.size();
+
+    // inserts into the hash table, checking for a duplicate name
+    std::uint32_t index_bucket =
+        HashName(cable.name.data(), cable.name.size()) & (size_buckets - 1);
+    while (buckets[index_bucket] != 0) {
+      if (cables[buckets[index_bucket] - 1].name == cable.name) {
+        return false;
+      }
+      index_bucket = (index_bucket + 1) & (size_buckets - 1);
+    }
+    buckets[index_bucket] = index + 1;
+
+    // builds the record
+    CableLibraryRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.absorptivity = cable.absorptivity;
+    record.area_physical = cable.area_physical;
+    record.component_core = ToRecord(cable.component_core, &coefficients);
+    record.component_shell = ToRecord(cable.component_shell, &coefficients);
+    record.diameter = cable.diameter;
+    record.emissivity = cable.emissivity;
+    record.strength_rated = cable.strength_rated;
+    record.temperature_properties_components =
+        cable.temperature_properties_components;
+    record.weight_unit = cable.weight_unit;
+
+    // names are null-terminated so views can return them directly
+    record.length_name = cable.name.size();
+    record.offset_name = strings.size();
+    strings.insert(strings.end(), cable.name.cbegin(), cable.name.cend());
+    strings.push_back('\0');
+
+    record.begin_resistances = resistances.size();
+    record.size_resistances = cable.resistances_ac.size();
+    resistances.insert(resistances.end(), cable.resistances_ac.cbegin(),
+                       cable.resistances_ac.cend());
+
+    records.push_back(record);
+  }
+
+  // writes the header and sections
+  HeaderRecord header;
+  std::memset(&header, 0, sizeof(header));
+  header.common = binary_file::Header(kMagic, kVersion);
+
+  buffer->assign(sizeof(HeaderRecord), 0);
+  binary_file::AppendSection(strings, &header.sections[kSectionStrings],
+                             buffer);
+  binary_file::AppendSection(records, &header.sections[kSectionCables],
+                             buffer);
+  binary_file::AppendSection(coefficients,
+                             &header.sections[kSectionCoefficients], buffer);
+  binary_file::AppendSection(resistances,
+                             &header.sections[kSectionResistances], buffer);
+  binary_file::AppendSection(buckets, &header.sections[kSectionBuckets],
+                             buffer);
+
+  header.common.size_file = buffer->size();
+  std::memcpy(buffer->data(), &header, sizeof(header));
+
+  return true;
+}
+
+const CableView* CableLibrary::View(const int& index) const {
+  if ((index < 0) || (size() <= index)) {
+    return nullptr;
+  }
+
+  return &views_[index];
+}
+
+bool CableLibrary::Write(const std::vector<Cable>& cables,
+                         const std::string& filepath) {
+  std::vector<char> buffer;
+  if (Serialize(cables, &buffer) == false) {
+    return false;
+  }
+
+  std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+  if (file.is_open() == false) {
+    return false;
+  }
+
+  file.write(buffer.data(), buffer.size());
+  return file.good();
+}
+
+int CableLibrary::size() const {
+  return views_.size();
+}
+
+bool CableLibrary::Initialize() {
+  const char* data = file_.data();
+  const std::size_t size = file_.size();
+
+  // checks header
+  if ((binary_file::IsValidHeader(data, size, kMagic, kVersion) == false)
+      || (size < sizeof(HeaderRecord))) {
+    return false;
+  }
+
+  // checks that every section is aligned and fits within the file
+  const HeaderRecord& header = *reinterpret_cast<const HeaderRecord*>(data);
+  if (binary_file::IsValidSections(header.sections, kSizesRecord,
+                                   kSizeSections, sizeof(HeaderRecord),
+                                   size) == false) {
+    return false;
+  }
+
+  const char* strings = binary_file::Records<char>(
+      data, header.sections[kSectionStrings]);
+  const CableLibraryRecord* records =
+      binary_file::Records<CableLibraryRecord>(
+          data, header.sections[kSectionCables]);
+  const double* coefficients = binary_file::Records<double>(
+      data, header.sections[kSectionCoefficients]);
+  const Cable::ResistancePoint* resistances =
+      binary_file::Records<Cable::ResistancePoint>(
+          data, header.sections[kSectionResistances]);
+
+  const std::uint64_t kSizeStrings = header.sections[kSectionStrings].count;
+  const std::uint64_t kSizeCables = header.sections[kSectionCables].count;
+  const std::uint64_t kSizeCoefficients =
+      header.sections[kSectionCoefficients].count;
+  const std::uint64_t kSizeResistances =
+      header.sections[kSectionResistances].count;
+
+  // checks the hash table, which must be a power of two larger than the
+  // number of cables so that probing always reaches an empty bucket
+  const std::uint64_t kSizeBuckets = header.sections[kSectionBuckets].count;
+  if ((kSizeBuckets <= kSizeCables)
+      || ((kSizeBuckets & (kSizeBuckets - 1)) != 0)) {
+    return false;
+  }
+
+  buckets_ = binary_file::Records<std::uint32_t>(
+      data, header.sections[kSectionBuckets]);
+  size_buckets_ = kSizeBuckets;
+  for (std::uint32_t i = 0; i < size_buckets_; i++) {
+    if (kSizeCables < buckets_[i]) {
+      return false;
+    }
+  }
+
+  // checks every cable record and builds the views
+  views_.reserve(kSizeCables);
+  for (std::uint64_t i = 0; i < kSizeCables; i++) {
+    const CableLibraryRecord& record = records[i];
+
+    // the name must be null-terminated within the string section
+    if ((binary_file::IsValidRange(record.offset_name, record.length_name,
+                                   kSizeStrings) == false)
+        || (kSizeStrings - record.offset_name <= record.length_name)
+        || (strings[record.offset_name + record.length_name] != '\0')) {
+      return false;
+    }
+
+    const CableLibraryComponentRecord* components[2] = {
+        &record.component_core, &record.component_shell};
+    for (int j = 0; j < 2; j++) {
+      const CableLibraryComponentRecord& component = *components[j];
+      if ((binary_file::IsValidRange(component.begin_coefficients_creep,
+                                     component.size_coefficients_creep,
+                                     kSizeCoefficients) == false)
+          || (binary_file::IsValidRange(
+                  component.begin_coefficients_loadstrain,
+                  component.size_coefficients_loadstrain,
+                  kSizeCoefficients) == false)) {
+        return false;
+      }
+    }
+
+    if (binary_file::IsValidRange(record.begin_resistances,
+                                  record.size_resistances,
+                                  kSizeResistances) == false) {
+      return false;
+    }
+
+    views_.push_back(CableView(&record, strings, coefficients, resistances));
+  }
+
+  cables_.resize(kSizeCables);
+  return true;
+}
@@ -10,10 +10,13 @@
 
 CablePositionLocator::CablePositionLocator() {
   direction_wind_ = AxisDirectionType::kNull;
+  geometry_connections_ = nullptr;
   index_cable_ = -9999;
+  iterations_ = -9999;
   line_ = nullptr;
   size_connections_ = -9999;
   tension_horizontal_ = -999999;
+  type_solver_ = SolverType::kFixedPoint;
   weight_unit_ = nullptr;
 
   is_updated_ = false;
@@ -56,7 +59,11 @@ std::list<Point3d<double>> CablePositionLocator::PointsCable(
   // calculates points
   const double increment = 1 / (static_cast<double>(num) - 1);
   double position_fraction = 0;
-  const double kAngleXy = spacing_xy.Angle();
+  // the xy rotation is resolved from the spacing once, and shared by all
+  // points
+  const double kMagnitudeXy = spacing_xy.Magnitude();
+  const double kCosXy = spacing_xy.x() / kMagnitudeXy;
+  const double kSinXy = spacing_xy.y() / kMagnitudeXy;
   for (int i = 0; i < num; i++) {
     // gets point from catenary
     Point3d<double> point_catenary = catenary.Coordinate(position_fraction);
@@ -65,7 +72,7 @@ std::list<Point3d<double>> CablePositionLocator::PointsCable(
     Vector2d vector;
     vector.set_x(point_catenary.x);
     vector.set_y(point_catenary.y);
-    vector.Rotate(kAngleXy);
+    vector.RotateSinCos(kSinXy, kCosXy);
 
     Point3d<double> point_global = point_back;
     point_global.x += vector.x();
@@ -93,12 +100,72 @@ const std::vector<Point3d<double>>*
   return &points_cable_;
 }
 
+bool CablePositionLocator::ResolveConnectionGeometry(
+    const TransmissionLine& line,
+    const int& index_line_cable,
+    CableConnectionGeometry* geometry) {
+  // gets the line cable
+  const SlotVector<LineCable>* line_cables = line.line_cables();
+  const int kSizeLineCables = line_cables->size();
+  if ((index_line_cable < 0) || (kSizeLineCables <= index_line_cable)) {
+    return false;
+  }
+
+  const LineCable& line_cable = (*line_cables)[index_line_cable];
+
+  // resizes containers to match connection count
+  const std::vector<LineCableConnection>* connections = line_cable.connections();
+  const int kSizeConnections = connections->size();
+
+  geometry->hardwares.clear();
+  geometry->hardwares.resize(kSizeConnections, nullptr);
+
+  geometry->points_structure.clear();
+  geometry->points_structure.resize(kSizeConnections);
+
+  // adds data for every connection
+  int index = 0;
+  for (auto iter = connections->cbegin(); iter != connections->cend(); iter++) {
+    const LineCableConnection& connection = *iter;
+
+    // gets structure and attachment index
+    const LineStructure* line_structure = connection.line_structure;
+    const int& index_structure = line.IndexLineStructure(line_structure);
+    const int& index_attachment = connection.index_attachment;
+
+    // calculates structure attachment point and caches
+    const Point3d<double>& point = line.PointXyzLineStructureAttachment(
+        index_structure,
+        connection.index_attachment);
+    if (point.x == -999999) {
+      return false;
+    } else {
+      geometry->points_structure[index] = point;
+    }
+
+    // gets hardware
+    const Hardware* hardware =
+        line_structure->hardwares()->at(index_attachment);
+    if (hardware == nullptr) {
+      return false;
+    } else {
+      geometry->hardwares[index] = hardware;
+    }
+
+    index++;
+  }
+
+  return true;
+}
+
 bool CablePositionLocator::Validate(const bool& is_included_warnings,
                                     std::list<ErrorMessage>* messages) const {
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE POSITION LOCATOR";
+  if (messages != nullptr) {
+    message.title = "CABLE POSITION LOCATOR";
+  }
 
   // validates direction-wind
   if (direction_wind_ == AxisDirectionType::kNull) {
@@ -140,6 +207,15 @@ bool CablePositionLocator::Validate(const bool& is_included_warnings,
     }
   }
 
+  // validates type-solver
+  if (type_solver_ == SolverType::kNull) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid solver type";
+      messages->push_back(message);
+    }
+  }
+
   // validates weight-unit
   if (weight_unit_ == nullptr) {
     is_valid = false;
@@ -190,16 +266,36 @@ AxisDirectionType CablePositionLocator::direction_wind() const {
   return direction_wind_;
 }
 
+const CableConnectionGeometry* CablePositionLocator::geometry_connections()
+    const {
+  return geometry_connections_;
+}
+
 int CablePositionLocator::index_line_cable() const {
   return index_cable_;
 }
 
+int CablePositionLocator::iterations() const {
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return -1;
+  }
+
+  return iterations_;
+}
+
 void CablePositionLocator::set_direction_wind(
     const AxisDirectionType& direction_wind) {
   direction_wind_ = direction_wind;
   is_updated_ = false;
 }
 
+void CablePositionLocator::set_geometry_connections(
+    const CableConnectionGeometry* geometry_connections) {
+  geometry_connections_ = geometry_connections;
+  is_updated_ = false;
+}
+
 void CablePositionLocator::set_index_line_cable(const int& index_line_cable) {
   index_cable_ = index_line_cable;
   is_updated_ = false;
@@ -216,6 +312,11 @@ void CablePositionLocator::set_transmission_line(const TransmissionLine* line) {
   is_updated_ = false;
 }
 
+void CablePositionLocator::set_type_solver(const SolverType& type_solver) {
+  type_solver_ = type_solver;
+  is_updated_ = false;
+}
+
 void CablePositionLocator::set_weight_unit(const Vector3d* weight_unit) {
   weight_unit_ = weight_unit;
   is_updated_ = false;
@@ -229,63 +330,135 @@ const TransmissionLine* CablePositionLocator::transmission_line() const {
   return line_;
 }
 
+CablePositionLocator::SolverType CablePositionLocator::type_solver() const {
+  return type_solver_;
+}
+
 const Vector3d* CablePositionLocator::weight_unit() const {
   return weight_unit_;
 }
 
-bool CablePositionLocator::InitializeConnectionData() const {
-  // gets the line cable
-  const std::list<LineCable>* line_cables = line_->line_cables();
-  const int kSizeLineCables = line_cables->size();
-  if ((index_cable_ < 0) || (kSizeLineCables <= index_cable_)) {
-    return false;
-  }
+double CablePositionLocator::AngleEquilibrium(
+    const int& index,
+    double* tension_imbalance) const {
+  // gets cable attachment points for back, current, and ahead attachments
+  const Point3d<double>& point_back = points_cable_[index - 1];
+  const Point3d<double>& point_current = points_cable_[index];
+  const Point3d<double>& point_ahead = points_cable_[index + 1];
 
-  const LineCable& line_cable = *std::next(line_cables->cbegin(), index_cable_);
+  Vector2d spacing_horizontal(0, 0);
+  Vector3d spacing(0, 0, 0);
 
-  // adds data for every connection
-  const std::list<LineCableConnection>* connections = line_cable.connections();
-  int index = 0;
-  for (auto iter = connections->cbegin(); iter != connections->cend(); iter++) {
-    const LineCableConnection& connection = *iter;
+  // creates back catenary
+  spacing_horizontal.set_x(point_current.x - point_back.x);
+  spacing_horizontal.set_y(point_current.y - point_back.y);
 
-    // gets structure and attachment index
-    const LineStructure* line_structure = connection.line_structure;
-    const int& index_structure = line_->IndexLineStructure(line_structure);
-    const int& index_attachment = connection.index_attachment;
+  spacing.set_x(spacing_horizontal.Magnitude());
+  spacing.set_z(point_current.z - point_back.z);
 
-    // calculates structure attachment point and caches
-    const Point3d<double>& point = line_->PointXyzLineStructureAttachment(
-        index_structure,
-        connection.index_attachment);
-    if (point.x == -999999) {
-      return false;
-    } else {
-      points_structure_[index] = point;
-    }
+  Catenary3d catenary_back;
+  catenary_back.set_direction_transverse(direction_wind_);
+  catenary_back.set_spacing_endpoints(spacing);
+  catenary_back.set_tension_horizontal(tension_horizontal_);
+  catenary_back.set_weight_unit(*weight_unit_);
+
+  // creates ahead catenary
+  spacing_horizontal.set_x(point_ahead.x - point_current.x);
+  spacing_horizontal.set_y(point_ahead.y - point_current.y);
+
+  spacing.set_x(spacing_horizontal.Magnitude());
+  spacing.set_z(point_ahead.z - point_current.z);
+
+  Catenary3d catenary_ahead;
+  catenary_ahead.set_direction_transverse(direction_wind_);
+  catenary_ahead.set_spacing_endpoints(spacing);
+  catenary_ahead.set_tension_horizontal(tension_horizontal_);
+  catenary_ahead.set_weight_unit(*weight_unit_);
+
+  // creates unit vectors from current point to back and ahead points
+  // finds the difference between the angles
+  Vector2d vector_back;
+  vector_back.set_x(point_back.x - point_current.x);
+  vector_back.set_y(point_back.y - point_current.y);
+  const double angle_back = vector_back.Angle();
+
+  Vector2d vector_ahead;
+  vector_ahead.set_x(point_ahead.x - point_current.x);
+  vector_ahead.set_y(point_ahead.y - point_current.y);
+  vector_ahead.Scale(1 / vector_ahead.Magnitude());
+  const double angle_ahead = vector_ahead.Angle();
+
+  const double angle_catenaries = std::abs(angle_ahead - angle_back);
+
+  // determines the direction of the line angle
+  AxisDirectionType direction_line_angle;
+  vector_back.Rotate(180);
+  const double angle_diff_xy = std::abs(angle_ahead - angle_back);
+  if (angle_diff_xy <= 180) {
+    direction_line_angle = AxisDirectionType::kPositive;
+  } else {
+    direction_line_angle = AxisDirectionType::kNegative;
+  }
+
+  // solves the static equilibrium
+  CableAttachmentEquilibriumSolver solver_equilibrium;
+  solver_equilibrium.set_angle_catenaries(angle_catenaries);
+  solver_equilibrium.set_angle_hardware(points_hardware_[index].angle_z);
+  solver_equilibrium.set_catenary_back(&catenary_back);
+  solver_equilibrium.set_catenary_ahead(&catenary_ahead);
+  solver_equilibrium.set_direction_catenaries(direction_line_angle);
+
+  *tension_imbalance = solver_equilibrium.TensionImbalance();
+  return solver_equilibrium.AngleEquilibrium();
+}
+
+bool CablePositionLocator::InitializeConnectionData() const {
+  // copies the shared connection geometry if provided
+  if (geometry_connections_ != nullptr) {
+    for (int index = 0; index < size_connections_; index++) {
+      const Hardware* hardware = geometry_connections_->hardwares[index];
+      if (hardware == nullptr) {
+        return false;
+      }
 
-    // gets hardware
-    const Hardware* hardware =
-        line_structure->hardwares()->at(index_attachment);
-    if (hardware == nullptr) {
-      return false;
-    } else {
       hardwares_[index] = hardware;
+      points_structure_[index] = geometry_connections_->points_structure[index];
     }
 
-    index++;
+    return true;
+  }
+
+  // resolves the connection geometry from the transmission line
+  CableConnectionGeometry geometry;
+  if (ResolveConnectionGeometry(*line_, index_cable_, &geometry) == false) {
+    return false;
   }
 
+  hardwares_ = geometry.hardwares;
+  points_structure_ = geometry.points_structure;
+
   return true;
 }
 
 bool CablePositionLocator::InitializeContainers() const {
-  // gets the line cable
-  const std::list<LineCable>* line_cables = line_->line_cables();
-  const LineCable& line_cable = *std::next(line_cables->cbegin(), index_cable_);
-
   // caches the number of connections
-  size_connections_ = line_cable.connections()->size();
+  if (geometry_connections_ != nullptr) {
+    size_connections_ = geometry_connections_->points_structure.size();
+    if (geometry_connections_->hardwares.size()
+        != geometry_connections_->points_structure.size()) {
+      return false;
+    }
+  } else {
+    // gets the line cable
+    const SlotVector<LineCable>* line_cables = line_->line_cables();
+    const int kSizeLineCables = line_cables->size();
+    if ((index_cable_ < 0) || (kSizeLineCables <= index_cable_)) {
+      return false;
+    }
+
+    const LineCable& line_cable = (*line_cables)[index_cable_];
+    size_connections_ = line_cable.connections()->size();
+  }
 
   // resizes containers to match connection count
   hardwares_.clear();
@@ -356,30 +529,217 @@ bool CablePositionLocator::IsUpdated() const {
   return is_updated_ == true;
 }
 
+double CablePositionLocator::ResidualsHardware(
+    std::vector<double>* residuals) const {
+  double tension_imbalance_max = 0;
+
+  for (int index = 0; index < size_connections_; index++) {
+    // first and last connections have dead-end assemblies
+    // the cable attachment has no movement relative to the structure attachment
+    if ((index == 0) || (index == size_connections_ - 1)) {
+      (*residuals)[index] = 0;
+      continue;
+    }
+
+    // calculates the difference from the equilibrium angle
+    double tension_imbalance = -999999;
+    const double angle_equilibrium = AngleEquilibrium(index,
+                                                      &tension_imbalance);
+    (*residuals)[index] = points_hardware_[index].angle_z - angle_equilibrium;
+
+    // updates the max tension imbalance
+    if (tension_imbalance_max < tension_imbalance) {
+      tension_imbalance_max = tension_imbalance;
+    }
+  }
+
+  return tension_imbalance_max;
+}
+
 bool CablePositionLocator::SolveCablePosition() const {
+  if (type_solver_ == SolverType::kFixedPoint) {
+    return SolveCablePositionFixedPoint();
+  } else if (type_solver_ == SolverType::kNewton) {
+    return SolveCablePositionNewton();
+  } else {
+    return false;
+  }
+}
+
+bool CablePositionLocator::SolveCablePositionFixedPoint() const {
+  // initializes hardware and cable positions
+  InitializePointsHardware();
+  UpdatePointsCable();
+
+  iterations_ = 0;
+  return UpdateCablePositionFixedPoint();
+}
+
+bool CablePositionLocator::SolveCablePositionNewton() const {
   // initializes hardware and cable positions
+  // a fixed point update is done to get a starting point that is close to
+  // the equilibrium solution
   InitializePointsHardware();
   UpdatePointsCable();
+  UpdatePointsHardware();
+  UpdatePointsCable();
+
+  // initializes containers
+  // the dead-end connections are kept in the system as identity rows so the
+  // indexes align with the other containers
+  const int kSize = size_connections_;
+  std::vector<double> angles(kSize, 0);
+  std::vector<double> diagonal(kSize, 1);
+  std::vector<double> lower(kSize, 0);
+  std::vector<double> residuals(kSize, 0);
+  std::vector<double> residuals_perturbed(kSize, 0);
+  std::vector<double> steps(kSize, 0);
+  std::vector<double> upper(kSize, 0);
+
+  // the perturbation and max step are hardware angles, in degrees
+  const double kAnglePerturbation = 0.001;
+  const double kAngleStepMax = 30;
+  const double precision = 5;
 
   // iterates until the tension imbalance is within range
-  double tension_imbalance = -999999;
+  // the starting fixed point update is counted as an iteration
+  double tension_imbalance = ResidualsHardware(&residuals);
+  iterations_ = 1;
   int iter = 0;
-  const double precision = 5;
-  while ((precision <= std::abs(tension_imbalance)) && (iter < 100)) {
-    // updates hardware points
-    // does a force balance at all points and gets the max tension imbalance
-    tension_imbalance = UpdatePointsHardware();
+  while ((precision <= tension_imbalance) && (iter < 100)) {
+    // assembles the jacobian using finite differences
+    // a hardware angle only influences the residuals of the adjacent
+    // connections, so every third angle can be perturbed at the same time
+    for (int offset = 0; offset < 3; offset++) {
+      for (int index = 1 + offset; index < kSize - 1; index += 3) {
+        points_hardware_[index].angle_z += kAnglePerturbation;
+      }
 
-    // updates the cable attachment points
-    UpdatePointsCable();
+      UpdatePointsCable();
+      ResidualsHardware(&residuals_perturbed);
+
+      for (int index = 1 + offset; index < kSize - 1; index += 3) {
+        points_hardware_[index].angle_z -= kAnglePerturbation;
+
+        diagonal[index] = (residuals_perturbed[index] - residuals[index])
+                          / kAnglePerturbation;
+        if (2 <= index) {
+          upper[index - 1] =
+              (residuals_perturbed[index - 1] - residuals[index - 1])
+              / kAnglePerturbation;
+        }
+        if (index <= kSize - 3) {
+          lower[index + 1] =
+              (residuals_perturbed[index + 1] - residuals[index + 1])
+              / kAnglePerturbation;
+        }
+      }
+    }
+
+    // solves for the newton steps
+    // falls back to a fixed point step if the jacobian is singular
+    for (int index = 0; index < kSize; index++) {
+      steps[index] = -residuals[index];
+    }
+
+    if (SolveTridiagonal(lower, diagonal, upper, &steps) == false) {
+      for (int index = 0; index < kSize; index++) {
+        steps[index] = -residuals[index];
+      }
+    }
+
+    // limits the step size so the hardware does not swing past the
+    // valid angle range
+    double step_max = 0;
+    for (int index = 0; index < kSize; index++) {
+      if (step_max < std::abs(steps[index])) {
+        step_max = std::abs(steps[index]);
+      }
+    }
+
+    double factor = 1;
+    if (kAngleStepMax < step_max) {
+      factor = kAngleStepMax / step_max;
+    }
+
+    // applies the step, and halves it until the tension imbalance decreases
+    for (int index = 0; index < kSize; index++) {
+      angles[index] = points_hardware_[index].angle_z;
+    }
+
+    double tension_imbalance_step = -999999;
+    for (int iter_step = 0; iter_step < 10; iter_step++) {
+      for (int index = 1; index < kSize - 1; index++) {
+        points_hardware_[index].angle_z = angles[index]
+                                          + (factor * steps[index]);
+      }
+
+      UpdatePointsCable();
+      tension_imbalance_step = ResidualsHardware(&residuals);
+      if (tension_imbalance_step < tension_imbalance) {
+        break;
+      }
+
+      factor = factor / 2;
+    }
 
     iter++;
+    iterations_++;
+
+    // restores the angles if no step decreased the tension imbalance, and
+    // finishes with fixed point iteration from the restored position
+    if (tension_imbalance <= tension_imbalance_step) {
+      for (int index = 1; index < kSize - 1; index++) {
+        points_hardware_[index].angle_z = angles[index];
+      }
+
+      UpdatePointsCable();
+      return UpdateCablePositionFixedPoint();
+    }
+
+    tension_imbalance = tension_imbalance_step;
   }
 
   // returns based on whether solution converged
   return iter < 100;
 }
 
+bool CablePositionLocator::SolveTridiagonal(
+    const std::vector<double>& lower,
+    const std::vector<double>& diagonal,
+    const std::vector<double>& upper,
+    std::vector<double>* values) {
+  const int kSize = diagonal.size();
+  std::vector<double> upper_modified(kSize, 0);
+
+  // forward sweep
+  double pivot = diagonal[0];
+  if (pivot == 0) {
+    return false;
+  }
+
+  upper_modified[0] = upper[0] / pivot;
+  (*values)[0] = (*values)[0] / pivot;
+  for (int index = 1; index < kSize; index++) {
+    pivot = diagonal[index] - (lower[index] * upper_modified[index - 1]);
+    if (pivot == 0) {
+      return false;
+    }
+
+    upper_modified[index] = upper[index] / pivot;
+    (*values)[index] = ((*values)[index]
+                        - (lower[index] * (*values)[index - 1])) / pivot;
+  }
+
+  // back substitution
+  for (int index = kSize - 2; 0 <= index; index--) {
+    (*values)[index] = (*values)[index]
+                       - (upper_modified[index] * (*values)[index + 1]);
+  }
+
+  return true;
+}
+
 bool CablePositionLocator::Update() const {
   // resizes containers to match connection size
   is_updated_ = InitializeContainers();
@@ -403,6 +763,27 @@ bool CablePositionLocator::Update() const {
   return true;
 }
 
+bool CablePositionLocator::UpdateCablePositionFixedPoint() const {
+  // iterates until the tension imbalance is within range
+  double tension_imbalance = -999999;
+  int iter = 0;
+  const double precision = 5;
+  while ((precision <= std::abs(tension_imbalance)) && (iter < 100)) {
+    // updates hardware points
+    // does a force balance at all points and gets the max tension imbalance
+    tension_imbalance = UpdatePointsHardware();
+
+    // updates the cable attachment points
+    UpdatePointsCable();
+
+    iter++;
+    iterations_++;
+  }
+
+  // returns based on whether solution converged
+  return iter < 100;
+}
+
 bool CablePositionLocator::UpdatePointsCable() const {
   // updates all cable attachment points
   for (int index = 0; index < size_connections_; index++) {
@@ -412,12 +793,10 @@ bool CablePositionLocator::UpdatePointsCable() const {
     // converts hardware spherical point to cartesian point
     // adds to structure xyz point to solve
     const double angle_x_rad =
-        units::ConvertAngle(point_hardware.angle_x,
-                            units::AngleConversionType::kDegreesToRadians);
+        units::Convert<units::Degrees, units::Radians>(point_hardware.angle_x);
 
     const double angle_z_rad =
-        units::ConvertAngle(point_hardware.angle_z,
-                            units::AngleConversionType::kDegreesToRadians);
+        units::Convert<units::Degrees, units::Radians>(point_hardware.angle_z);
 
     Point3d<double> point_cable;
     point_cable.x = point_hardware.radius * std::cos(angle_x_rad)
@@ -439,21 +818,6 @@ bool CablePositionLocator::UpdatePointsCable() const {
 double CablePositionLocator::UpdatePointsHardware() const {
   double tension_imbalance_max = 0;
 
-  Catenary3d catenary_back;
-  catenary_back.set_direction_transverse(direction_wind_);
-  catenary_back.set_tension_horizontal(tension_horizontal_);
-  catenary_back.set_weight_unit(*weight_unit_);
-
-  Catenary3d catenary_ahead;
-  catenary_ahead.set_direction_transverse(direction_wind_);
-  catenary_ahead.set_tension_horizontal(tension_horizontal_);
-  catenary_ahead.set_weight_unit(*weight_unit_);
-
-  Vector2d spacing_horizontal(0, 0);
-  Vector3d spacing(0, 0, 0);
-
-  CableAttachmentEquilibriumSolver solver_equilibrium;
-
   for (int index = 0; index < size_connections_; index++) {
     // first and last connections have dead-end assemblies
     // the cable attachment has no movement relative to the structure attachment
@@ -462,69 +826,12 @@ double CablePositionLocator::UpdatePointsHardware() const {
       continue;
     }
 
-    // gets cable attachment points for back, current, and ahead attachments
-    const Point3d<double>& point_back = points_cable_[index - 1];
-    const Point3d<double>& point_current = points_cable_[index];
-    const Point3d<double>& point_ahead = points_cable_[index + 1];
-
-    // updates back catenary
-    spacing_horizontal.set_x(point_current.x - point_back.x);
-    spacing_horizontal.set_y(point_current.y - point_back.y);
-
-    spacing.set_x(spacing_horizontal.Magnitude());
-    spacing.set_z(point_current.z - point_back.z);
-
-    catenary_back.set_spacing_endpoints(spacing);
-
-    // updates ahead catenary
-    spacing_horizontal.set_x(point_ahead.x - point_current.x);
-    spacing_horizontal.set_y(point_ahead.y - point_current.y);
-
-    spacing.set_x(spacing_horizontal.Magnitude());
-    spacing.set_z(point_ahead.z - point_current.z);
-
-    catenary_ahead.set_spacing_endpoints(spacing);
-
-    // creates unit vectors from current point to back and ahead points
-    // finds the difference between the angles
-    Vector2d vector_back;
-    vector_back.set_x(point_back.x - point_current.x);
-    vector_back.set_y(point_back.y - point_current.y);
-    const double angle_back = vector_back.Angle();
-
-    Vector2d vector_ahead;
-    vector_ahead.set_x(point_ahead.x - point_current.x);
-    vector_ahead.set_y(point_ahead.y - point_current.y);
-    vector_ahead.Scale(1 / vector_ahead.Magnitude());
-    const double angle_ahead = vector_ahead.Angle();
-
-    const double angle_catenaries = std::abs(angle_ahead - angle_back);
-
-    // determines the direction of the line angle
-    AxisDirectionType direction_line_angle;
-    vector_back.Rotate(180);
-    const double angle_diff_xy = std::abs(angle_ahead - angle_back);
-    if (angle_diff_xy <= 180) {
-      direction_line_angle = AxisDirectionType::kPositive;
-    } else {
-      direction_line_angle = AxisDirectionType::kNegative;
-    }
-
-    // gets the hardware point
-    SphericalPoint3d<double>& point_hardware = points_hardware_[index];
-
-    // updates the equilibrium solver
-    solver_equilibrium.set_angle_catenaries(angle_catenaries);
-    solver_equilibrium.set_angle_hardware(point_hardware.angle_z);
-    solver_equilibrium.set_catenary_back(&catenary_back);
-    solver_equilibrium.set_catenary_ahead(&catenary_ahead);
-    solver_equilibrium.set_direction_catenaries(direction_line_angle);
-
     // updates the hardware point z-axis angle
-    point_hardware.angle_z = solver_equilibrium.AngleEquilibrium();
+    double tension_imbalance = -999999;
+    points_hardware_[index].angle_z = AngleEquilibrium(index,
+                                                       &tension_imbalance);
 
     // updates the max tension imbalance
-    const double tension_imbalance = solver_equilibrium.TensionImbalance();
     if (tension_imbalance_max < tension_imbalance) {
       tension_imbalance_max = tension_imbalance;
     }
@@ -3,7 +3,7 @@
 
 #include "models/transmissionline/cable_unit_load_solver.h"
 
-#include "models/base/geometric_shapes.h"
+#include "models/base/units.h"
 
 CableUnitLoadSolver::CableUnitLoadSolver() {
   diameter_cable_ = nullptr;
@@ -19,7 +19,9 @@ bool CableUnitLoadSolver::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CABLE UNIT LOAD CALCULATOR";
+  if (messages != nullptr) {
+    message.title = "CABLE UNIT LOAD CALCULATOR";
+  }
 
   // validates diameter-cable
   if ((diameter_cable_ == nullptr) ||  (*diameter_cable_ <= 0)) {
@@ -49,25 +51,22 @@ bool CableUnitLoadSolver::Validate(
 /// \f[ T = AP \f]
 Vector3d CableUnitLoadSolver::UnitCableLoad(
     const WeatherLoadCase& case_load_weather) const {
-  // creates bare and iced cylinders
-  Cylinder cylinder_bare;
-  cylinder_bare.set_diameter(*diameter_cable_);
-  cylinder_bare.set_length(1);
-
-  Cylinder cylinder_iced;
-  cylinder_iced.set_diameter(*diameter_cable_
-                             + (2 * case_load_weather.thickness_ice));
-  cylinder_iced.set_length(1);
-
-  const double volume_ice = cylinder_iced.Volume() - cylinder_bare.Volume();
-  const double density_ice = case_load_weather.density_ice;
-  const double weight_ice = volume_ice * density_ice;
+  // solves the bare and iced diameters
+  // the ice volume is solved directly for a unit length, instead of through
+  // cylinder objects, because this is called for every weathercase
+  const double& diameter_bare = *diameter_cable_;
+  const double diameter_iced = diameter_bare
+                               + (2 * case_load_weather.thickness_ice);
+
+  const double volume_ice = (units::kPi / 4)
+                            * ((diameter_iced * diameter_iced)
+                               - (diameter_bare * diameter_bare));
+  const double weight_ice = volume_ice * case_load_weather.density_ice;
 
   // solves for unit load
   Vector3d load_unit_cable;
   load_unit_cable.set_x(0);
-  load_unit_cable.set_y(cylinder_iced.diameter() * cylinder_iced.length()
-                        * case_load_weather.pressure_wind);
+  load_unit_cable.set_y(diameter_iced * case_load_weather.pressure_wind);
   load_unit_cable.set_z(*weight_unit_cable_ + weight_ice);
 
   return load_unit_cable;
@@ -0,0 +1,111 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/cable_unit_load_table.h"
+
+#include "models/transmissionline/cable_unit_load_solver.h"
+
+CableUnitLoadTable::CableUnitLoadTable() {
+}
+
+CableUnitLoadTable::~CableUnitLoadTable() {
+}
+
+int CableUnitLoadTable::AddCable(const double& diameter,
+                                 const double& weight_unit) {
+  // searches for an existing cable
+  // projects only have a few cables, so a linear search is used
+  const int kSizeCables = cables_.size();
+  for (int index = 0; index < kSizeCables; index++) {
+    const std::pair<double, double>& cable = cables_[index];
+    if ((cable.first == diameter) && (cable.second == weight_unit)) {
+      return index;
+    }
+  }
+
+  // adds a row and solves the unit load for every weathercase
+  cables_.push_back(std::make_pair(diameter, weight_unit));
+  loads_.push_back(std::vector<Vector3d>());
+
+  const int kSizeWeathercases = weathercases_.size();
+  std::vector<Vector3d>& loads = loads_.back();
+  loads.reserve(kSizeWeathercases);
+  for (int index = 0; index < kSizeWeathercases; index++) {
+    loads.push_back(SolveUnitLoad(kSizeCables, index));
+  }
+
+  return kSizeCables;
+}
+
+int CableUnitLoadTable::AddWeathercase(const WeatherLoadCase* weathercase) {
+  if (weathercase == nullptr) {
+    return -1;
+  }
+
+  // searches for an existing weathercase
+  auto iter = indexes_weathercase_.find(weathercase);
+  if (iter != indexes_weathercase_.end()) {
+    return iter->second;
+  }
+
+  // adds a column and solves the unit load for every cable
+  const int index_weathercase = weathercases_.size();
+  indexes_weathercase_[weathercase] = index_weathercase;
+  weathercases_.push_back(weathercase);
+
+  const int kSizeCables = cables_.size();
+  for (int index = 0; index < kSizeCables; index++) {
+    loads_[index].push_back(SolveUnitLoad(index, index_weathercase));
+  }
+
+  return index_weathercase;
+}
+
+void CableUnitLoadTable::Clear() {
+  cables_.clear();
+  indexes_weathercase_.clear();
+  loads_.clear();
+  weathercases_.clear();
+}
+
+const Vector3d* CableUnitLoadTable::UnitLoad(
+    const double& diameter,
+    const double& weight_unit,
+    const WeatherLoadCase* weathercase) const {
+  // gets the weathercase column
+  auto iter = indexes_weathercase_.find(weathercase);
+  if (iter == indexes_weathercase_.cend()) {
+    return nullptr;
+  }
+
+  // gets the cable row
+  const int kSizeCables = cables_.size();
+  for (int index = 0; index < kSizeCables; index++) {
+    const std::pair<double, double>& cable = cables_[index];
+    if ((cable.first == diameter) && (cable.second == weight_unit)) {
+      return &loads_[index][iter->second];
+    }
+  }
+
+  return nullptr;
+}
+
+int CableUnitLoadTable::size_cables() const {
+  return cables_.size();
+}
+
+int CableUnitLoadTable::size_weathercases() const {
+  return weathercases_.size();
+}
+
+Vector3d CableUnitLoadTable::SolveUnitLoad(
+    const int& index_cable,
+    const int& index_weathercase) const {
+  const std::pair<double, double>& cable = cables_[index_cable];
+
+  CableUnitLoadSolver solver;
+  solver.set_diameter_cable(&cable.first);
+  solver.set_weight_unit_cable(&cable.second);
+
+  return solver.UnitCableLoad(*weathercases_[index_weathercase]);
+}
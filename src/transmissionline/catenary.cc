@@ -6,6 +6,7 @@
 #include <cmath>
 
 #include "models/base/units.h"
+#include "models/transmissionline/catenary_functions.h"
 
 Catenary2d::Catenary2d() {
   tension_horizontal_ = -999999;
@@ -101,8 +102,7 @@ double Catenary2d::PositionFraction(const double& tangent_angle) const {
 
   // converts angle to radians and solves for slope
   const double angle_radians =
-      units::ConvertAngle(tangent_angle,
-                          units::AngleConversionType::kDegreesToRadians);
+      units::Convert<units::Degrees, units::Radians>(tangent_angle);
   const double& slope = std::tan(angle_radians);
 
   // uses inverse slope function to get x coordinate
@@ -163,25 +163,35 @@ double Catenary2d::TangentAngle(const double& position_fraction,
     return -999999;
   }
 
+  // gets slope at position
+  const double slope = TangentSlope(position_fraction, direction);
+
+  // converts to degrees
+  return units::Convert<units::Radians, units::Degrees>(std::atan(slope));
+}
+
+double Catenary2d::TangentSlope(const double& position_fraction,
+                                const AxisDirectionType& direction) const {
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return -999999;
+  }
+
   // gets x coordinate at position
   const double x = CoordinateX(position_fraction);
 
   // calculates slope at position
-  const double slope = std::sinh(x / (tension_horizontal_/weight_unit_));
-
-  // converts to degrees
-  double tangent_angle = units::ConvertAngle(
-      std::atan(slope),
-      units::AngleConversionType::kRadiansToDegrees);
+  double slope = std::sinh(x / (tension_horizontal_/weight_unit_));
 
   // adjusts if direction is negative
   if (direction == AxisDirectionType::kNegative) {
-    tangent_angle = tangent_angle * -1;
+    slope = slope * -1;
   }
 
-  return tangent_angle;
+  return slope;
 }
 
+/// The unit vector is solved from the tangent slope, so no trigonometric
+/// functions are evaluated.
 Vector2d Catenary2d::TangentVector(const double& position_fraction,
                                    const AxisDirectionType& direction) const {
   Vector2d tangent_vector;
@@ -190,19 +200,17 @@ Vector2d Catenary2d::TangentVector(const double& position_fraction,
     return tangent_vector;
   }
 
-  // gets tangent angle
-  const double angle_tangent = TangentAngle(position_fraction, direction);
+  // gets tangent slope
+  const double slope = TangentSlope(position_fraction, direction);
 
   // resolves to a unit vector
-  const double angle_radians = units::ConvertAngle(
-      angle_tangent,
-      units::AngleConversionType::kDegreesToRadians);
+  const double factor = 1 / std::sqrt(1 + (slope * slope));
   if (direction == AxisDirectionType::kNegative) {
-    tangent_vector.set_x(-(1 * std::cos(angle_radians)));
-    tangent_vector.set_y(std::sin(angle_radians));
+    tangent_vector.set_x(-factor);
+    tangent_vector.set_y(slope * factor);
   } else if (direction == AxisDirectionType::kPositive) {
-    tangent_vector.set_x(std::cos(angle_radians));
-    tangent_vector.set_y(std::sin(angle_radians));
+    tangent_vector.set_x(factor);
+    tangent_vector.set_y(slope * factor);
   }
 
   return tangent_vector;
@@ -216,24 +224,32 @@ double Catenary2d::Tension(const double& position_fraction) const {
   // gets x coordinate
   const double x = CoordinateX(position_fraction);
 
-  return tension_horizontal_
-         * std::cosh(x / (tension_horizontal_ / weight_unit_));
+  return catenary::Tension(tension_horizontal_, weight_unit_, x);
 }
 
+/// The horizontal tension component is constant, and the vertical tension
+/// component is the horizontal tension scaled by the tangent slope.
 Vector2d Catenary2d::Tension(const double& position_fraction,
                              const AxisDirectionType& direction) const {
-  Vector2d vector_tangent;
+  Vector2d vector_tension;
 
   if ((IsUpdated() == false) && (Update() == false)) {
-    return vector_tangent;
+    return vector_tension;
   }
 
-  // gets a unit vector and scales according to tension magnitude
-  vector_tangent = TangentVector(position_fraction, direction);
-  const double magnitude = Tension(position_fraction);
-  vector_tangent.Scale(magnitude);
+  // gets tangent slope
+  const double slope = TangentSlope(position_fraction, direction);
 
-  return vector_tangent;
+  // resolves to tension components
+  if (direction == AxisDirectionType::kNegative) {
+    vector_tension.set_x(-tension_horizontal_);
+    vector_tension.set_y(slope * tension_horizontal_);
+  } else if (direction == AxisDirectionType::kPositive) {
+    vector_tension.set_x(tension_horizontal_);
+    vector_tension.set_y(slope * tension_horizontal_);
+  }
+
+  return vector_tension;
 }
 
 double Catenary2d::TensionAverage(const int& num_points) const {
@@ -295,7 +311,9 @@ bool Catenary2d::Validate(const bool& is_included_warnings,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CATENARY 2D";
+  if (messages != nullptr) {
+    message.title = "CATENARY 2D";
+  }
 
   // validates tension-horizontal
   if (tension_horizontal_ <= 0) {
@@ -400,17 +418,12 @@ double Catenary2d::CoordinateX(const double& position_fraction) const {
 
   // converts to x coordinate and returns
   // uses inverse of the LengthFromOrigin method
-  const double& h = tension_horizontal_;
-  const double& w = weight_unit_;
-
-  return (h / w) * (std::asinh(length_from_origin / (h / w)));
+  return catenary::CoordinateX(tension_horizontal_, weight_unit_,
+                               length_from_origin);
 }
 
 double Catenary2d::CoordinateY(const double& x) const {
-  const double& h = tension_horizontal_;
-  const double& w = weight_unit_;
-
-  return (h / w) * (std::cosh(x / (h / w)) - 1);
+  return catenary::CoordinateY(tension_horizontal_, weight_unit_, x);
 }
 
 bool Catenary2d::IsUpdated() const {
@@ -418,10 +431,7 @@ bool Catenary2d::IsUpdated() const {
 }
 
 double Catenary2d::LengthFromOrigin(const double& x) const {
-  const double& h = tension_horizontal_;
-  const double& w = weight_unit_;
-
-  return (h / w) * std::sinh(x / (h / w));
+  return catenary::LengthFromOrigin(tension_horizontal_, weight_unit_, x);
 }
 
 bool Catenary2d::Update() const {
@@ -446,14 +456,13 @@ bool Catenary2d::UpdateEndPoints() const {
   const double& w = weight_unit_;
   const double& a = spacing_endpoints_.x();
   const double& b = spacing_endpoints_.y();
-  const double& z = (a / 2) / (h / w);
 
   // solves for left endpoint coordinate (Ehrenburg)
-  point_end_left_.x = (h / w) * (std::asinh((b * z) / (a * std::sinh(z))) - z);
+  point_end_left_.x = catenary::PointEndLeftX(h, w, a, b);
   point_end_left_.y = CoordinateY(point_end_left_.x);
 
   // solves for right endpoint coordinate (Ehrenburg)
-  point_end_right_.x = (h / w) * (std::asinh((b * z) / (a * std::sinh(z))) + z);
+  point_end_right_.x = catenary::PointEndRightX(h, w, a, b);
   point_end_right_.y = CoordinateY(point_end_right_.x);
 
   return true;
@@ -475,7 +484,9 @@ bool Catenary2d::ValidateCurveAndSpacing(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CATENARY 2D";
+  if (messages != nullptr) {
+    message.title = "CATENARY 2D";
+  }
 
   const double constant_minimum =
       ConstantMinimum(spacing_endpoints_.Magnitude());
@@ -493,9 +504,26 @@ bool Catenary2d::ValidateCurveAndSpacing(
   return is_valid;
 }
 
+CatenaryProjection::CatenaryProjection() {
+  cos_rotation_spacing = -999999;
+  cos_rotation_swing = -999999;
+  sin_rotation_spacing = -999999;
+  sin_rotation_swing = -999999;
+  weight_unit = -999999;
+}
+
+CatenaryProjection::~CatenaryProjection() {
+}
+
 Catenary3d::Catenary3d() {
+  cos_rotation_spacing_ = -999999;
+  cos_rotation_swing_ = -999999;
   direction_transverse_ = AxisDirectionType::kPositive;
+  sin_rotation_spacing_ = -999999;
+  sin_rotation_swing_ = -999999;
+
   is_updated_catenary_2d_ = false;
+  is_updated_rotations_ = false;
 }
 
 Catenary3d::~Catenary3d() {}
@@ -521,9 +549,6 @@ Point3d<double> Catenary3d::Coordinate(const double& position_fraction) const {
     return coordinate;
   }
 
-  // initializes
-  double angle = -999999;
-
   // gets a 2D curve coordinate
   Point2d<double> coord_2d_curve = catenary_2d_.Coordinate(position_fraction,
                                                            true);
@@ -533,32 +558,21 @@ Point3d<double> Catenary3d::Coordinate(const double& position_fraction) const {
                                                     position_fraction,
                                                     true);
 
-  // gets a 3D chord coordinate
-  Point3d<double> coord_3d_chord = CoordinateChord(position_fraction);
+  // gets a 3D chord coordinate by rotating along xz axis
+  Vector3d vector_chord(coord_2d_chord.x, 0, coord_2d_chord.y);
+  vector_chord.RotateSinCos(Plane2dType::kXz, sin_rotation_spacing_,
+                            cos_rotation_spacing_);
 
   // creates a vector between 2d chord coordinate and 2d curve coordinate
-  Vector3d vector;
-  vector.set_x(coord_2d_curve.x - coord_2d_chord.x);
-  vector.set_y(0);
-  vector.set_z(coord_2d_curve.y - coord_2d_chord.y);
-
-  // rotates vector along xz axis
-  const double kAngleXz2d = catenary_2d_.spacing_endpoints().Angle();
-  const double kAngleXz3d = spacing_endpoints_.Angle(Plane2dType::kXz);
-  angle = kAngleXz3d - kAngleXz2d;
-  vector.Rotate(Plane2dType::kXz, angle);
-
-  // rotates vector along yz axis
-  angle = weight_unit_.Angle(Plane2dType::kZy);
-  if (direction_transverse_ == AxisDirectionType::kNegative) {
-    angle = angle * -1;
-  }
-  vector.Rotate(Plane2dType::kYz, angle);
+  // rotates to 3D
+  const Vector3d vector = RotateTo3d(
+      Vector2d(coord_2d_curve.x - coord_2d_chord.x,
+               coord_2d_curve.y - coord_2d_chord.y));
 
   // adds rotated vector components to chord coordinate
-  coordinate.x = coord_3d_chord.x + vector.x();
-  coordinate.y = coord_3d_chord.y + vector.y();
-  coordinate.z = coord_3d_chord.z + vector.z();
+  coordinate.x = vector_chord.x() + vector.x();
+  coordinate.y = vector_chord.y() + vector.y();
+  coordinate.z = vector_chord.z() + vector.z();
 
   return coordinate;
 }
@@ -571,9 +585,6 @@ Point3d<double> Catenary3d::CoordinateChord(
     return coordinate;
   }
 
-  // initializes
-  double angle = -999999;
-
   // gets a 2D chord coordiante
   Point2d<double> coord_2d_chord = catenary_2d_.CoordinateChord(
                                                     position_fraction,
@@ -586,10 +597,8 @@ Point3d<double> Catenary3d::CoordinateChord(
   vector.set_z(coord_2d_chord.y - 0);
 
   // rotates vector along xz axis
-  const double kAngleXz2d = catenary_2d_.spacing_endpoints().Angle();
-  const double kAngleXz3d = spacing_endpoints_.Angle(Plane2dType::kXz);
-  angle = kAngleXz3d - kAngleXz2d;
-  vector.Rotate(Plane2dType::kXz, angle);
+  vector.RotateSinCos(Plane2dType::kXz, sin_rotation_spacing_,
+                      cos_rotation_spacing_);
 
   // returns
   coordinate.x = vector.x();
@@ -633,6 +642,26 @@ double Catenary3d::PositionFractionSagPoint() const {
   return catenary_2d_.PositionFractionSagPoint();
 }
 
+CatenaryProjection Catenary3d::Projection() const {
+  CatenaryProjection projection;
+
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return projection;
+  }
+
+  projection.cos_rotation_spacing = cos_rotation_spacing_;
+  projection.cos_rotation_swing = cos_rotation_swing_;
+  projection.sin_rotation_spacing = sin_rotation_spacing_;
+  projection.sin_rotation_swing = sin_rotation_swing_;
+  if (direction_transverse_ == AxisDirectionType::kNegative) {
+    projection.sin_rotation_swing = projection.sin_rotation_swing * -1;
+  }
+  projection.spacing_endpoints = catenary_2d_.spacing_endpoints();
+  projection.weight_unit = catenary_2d_.weight_unit();
+
+  return projection;
+}
+
 double Catenary3d::Sag() const {
   if ((IsUpdated() == false) && (Update() == false)) {
     return -999999;
@@ -656,9 +685,8 @@ double Catenary3d::SwingAngle() const {
     return -999999;
   }
 
-  angle_swing = units::ConvertAngle(
-      std::atan(weight_unit_.y() / weight_unit_.z()),
-      units::AngleConversionType::kRadiansToDegrees);
+  angle_swing = units::Convert<units::Radians, units::Degrees>(
+      std::atan(weight_unit_.y() / weight_unit_.z()));
   return angle_swing;
 }
 
@@ -705,37 +733,10 @@ Vector3d Catenary3d::TangentVector(const double& position_fraction,
     return tangent_vector;
   }
 
-  // gets 2D tangent vector
-  Vector2d tangent_vector_2d = catenary_2d_.TangentVector(position_fraction,
-                                                          direction);
-
-  // sets initial 3D vector values
-  tangent_vector.set_x(tangent_vector_2d.x());
-  tangent_vector.set_y(0);
-  tangent_vector.set_z(tangent_vector_2d.y());
-
-  // rotates 3D vector due to different endpoint spacing of 2D and 3D catenary.
-  // only applicable when endpoint spacing has a vertical component, and
-  // transverse load is present
-  if (spacing_endpoints_.z() != 0 && weight_unit_.y() != 0) {
-    Vector2d spacing_endpoints_2d = catenary_2d_.spacing_endpoints();
-    double angle_endpoints_2d = spacing_endpoints_2d.Angle(true);
-    double angle_endpoints_3d = spacing_endpoints_.Angle(Plane2dType::kXz,
-                                                         true);
-
-    tangent_vector.Rotate(Plane2dType::kXz,
-                          angle_endpoints_3d - angle_endpoints_2d);
-  }
-
-  // rotates 3D vector due to transverse loading
-  if (weight_unit_.y() != 0) {
-    double angle_rotation = SwingAngle();
-    if (direction_transverse_ == AxisDirectionType::kNegative) {
-      angle_rotation = angle_rotation * -1;
-    }
-
-    tangent_vector.Rotate(Plane2dType::kYz, angle_rotation);
-  }
+  // gets 2D tangent vector and rotates to 3D
+  const Vector2d tangent_vector_2d =
+      catenary_2d_.TangentVector(position_fraction, direction);
+  tangent_vector = RotateTo3d(tangent_vector_2d);
 
   return tangent_vector;
 }
@@ -748,6 +749,8 @@ double Catenary3d::Tension(const double& position_fraction) const {
   return catenary_2d_.Tension(position_fraction);
 }
 
+/// The 2D tension vector is solved from the tangent slope, and rotated to 3D
+/// with the cached rotations.
 Vector3d Catenary3d::Tension(const double& position_fraction,
                              const AxisDirectionType& direction) const {
   Vector3d tension_vector;
@@ -756,16 +759,12 @@ Vector3d Catenary3d::Tension(const double& position_fraction,
     return tension_vector;
   }
 
-  // gets tension magnitude
-  const double tension = catenary_2d_.Tension(position_fraction);
-
-  // gets tangent vector
-  Vector3d tangent_vector = TangentVector(position_fraction, direction);
+  // gets 2D tension vector and rotates to 3D
+  const Vector2d tension_vector_2d =
+      catenary_2d_.Tension(position_fraction, direction);
+  tension_vector = RotateTo3d(tension_vector_2d);
 
-  // scales vector
-  tangent_vector.Scale(tension);
-
-  return tangent_vector;
+  return tension_vector;
 }
 
 double Catenary3d::TensionAverage(const int& num_points) const {
@@ -789,7 +788,9 @@ bool Catenary3d::Validate(const bool& is_included_warnings,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CATENARY 3D";
+  if (messages != nullptr) {
+    message.title = "CATENARY 3D";
+  }
 
   // validates spacing-endpoints-horizontal
   if (spacing_endpoints_.x() <= 0) {
@@ -908,17 +909,46 @@ Vector3d Catenary3d::weight_unit() const {
 }
 
 bool Catenary3d::IsUpdated() const {
-  return is_updated_catenary_2d_ == true;
+  return (is_updated_catenary_2d_ == true)
+      && (is_updated_rotations_ == true);
+}
+
+Vector3d Catenary3d::RotateTo3d(const Vector2d& vector_2d) const {
+  Vector3d vector(vector_2d.x(), 0, vector_2d.y());
+
+  // rotates along xz axis
+  vector.RotateSinCos(Plane2dType::kXz, sin_rotation_spacing_,
+                      cos_rotation_spacing_);
+
+  // rotates along yz axis
+  double sin_rotation_swing = sin_rotation_swing_;
+  if (direction_transverse_ == AxisDirectionType::kNegative) {
+    sin_rotation_swing = sin_rotation_swing * -1;
+  }
+  vector.RotateSinCos(Plane2dType::kYz, sin_rotation_swing,
+                      cos_rotation_swing_);
+
+  return vector;
 }
 
 bool Catenary3d::Update() const {
   if (is_updated_catenary_2d_ == false) {
+    // resets downstream update indicators
+    is_updated_rotations_ = false;
+
     is_updated_catenary_2d_ = UpdateCatenary2d();
     if (is_updated_catenary_2d_ == false) {
       return false;
     }
   }
 
+  if (is_updated_rotations_ == false) {
+    is_updated_rotations_ = UpdateRotations();
+    if (is_updated_rotations_ == false) {
+      return false;
+    }
+  }
+
   // if it reaches this point, update was successful
   return true;
 }
@@ -941,3 +971,33 @@ bool Catenary3d::UpdateCatenary2d() const {
 
   return true;
 }
+
+/// The rotations are solved from the end point spacing and unit weight
+/// vectors, so no trigonometric functions are evaluated. The spacing rotation
+/// only applies when the end point spacing has a vertical component and
+/// transverse load is present, otherwise the 2D and 3D spacings are aligned.
+bool Catenary3d::UpdateRotations() const {
+  // solves the rotation between the 2D and 3D end point spacing
+  if ((spacing_endpoints_.z() != 0) && (weight_unit_.y() != 0)) {
+    const Vector2d spacing_2d = catenary_2d_.spacing_endpoints();
+    const double a = spacing_endpoints_.x();
+    const double b = spacing_endpoints_.z();
+    const double magnitude = spacing_2d.Magnitude()
+                             * std::sqrt((a * a) + (b * b));
+
+    cos_rotation_spacing_ = ((spacing_2d.x() * a) + (spacing_2d.y() * b))
+                            / magnitude;
+    sin_rotation_spacing_ = ((spacing_2d.x() * b) - (spacing_2d.y() * a))
+                            / magnitude;
+  } else {
+    cos_rotation_spacing_ = 1;
+    sin_rotation_spacing_ = 0;
+  }
+
+  // solves the swing angle rotation
+  const double slope_swing = weight_unit_.y() / weight_unit_.z();
+  cos_rotation_swing_ = 1 / std::sqrt(1 + (slope_swing * slope_swing));
+  sin_rotation_swing_ = slope_swing * cos_rotation_swing_;
+
+  return true;
+}
@@ -0,0 +1,110 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/catenary_sampler.h"
+
+#include "models/transmissionline/catenary_functions.h"
+
+CatenarySampler::CatenarySampler() {
+  catenary_ = Catenary3d();
+
+  constant_ = -999999;
+  cosh_left_ = -999999;
+  length_ = -999999;
+  sinh_left_ = -999999;
+  slope_chord_ = -999999;
+  u_left_ = -999999;
+
+  is_updated_ = false;
+}
+
+CatenarySampler::~CatenarySampler() {
+}
+
+bool CatenarySampler::Validate(const bool& is_included_warnings,
+                               std::list<ErrorMessage>* messages) const {
+  // initializes
+  bool is_valid = true;
+  ErrorMessage message;
+  if (messages != nullptr) {
+    message.title = "CATENARY SAMPLER";
+  }
+
+  // validates catenary
+  if (catenary_.Validate(is_included_warnings, messages) == false) {
+    is_valid = false;
+  }
+
+  // returns if errors are present
+  if (is_valid == false) {
+    return is_valid;
+  }
+
+  // validates update process
+  if (Update() == false) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Error updating class";
+      messages->push_back(message);
+    }
+  }
+
+  return is_valid;
+}
+
+Catenary3d CatenarySampler::catenary() const {
+  return catenary_;
+}
+
+void CatenarySampler::set_catenary(const Catenary3d& catenary) {
+  catenary_ = catenary;
+  is_updated_ = false;
+}
+
+bool CatenarySampler::IsUpdated() const {
+  return is_updated_ == true;
+}
+
+/// The 2D catenary and the rotations are taken from the catenary projection,
+/// so the points match Catenary3d::Coordinate.
+bool CatenarySampler::Update() const {
+  // gets the 2D catenary
+  const CatenaryProjection projection = catenary_.Projection();
+  const double a = projection.spacing_endpoints.x();
+  const double b = projection.spacing_endpoints.y();
+  const double w = projection.weight_unit;
+  const double h = catenary_.tension_horizontal();
+  if ((a <= 0) || (w <= 0) || (h <= 0)) {
+    is_updated_ = false;
+    return false;
+  }
+
+  // caches the 2D curve values
+  constant_ = h / w;
+  length_ = catenary::Length(h, w, a, b);
+  slope_chord_ = b / a;
+  u_left_ = catenary::PointEndLeftX(h, w, a, b) / constant_;
+  cosh_left_ = std::cosh(u_left_);
+  sinh_left_ = std::sinh(u_left_);
+
+  // caches the 3D mapping vectors
+  Vector3d q(1, 0, slope_chord_);
+  q.RotateSinCos(Plane2dType::kXz, projection.sin_rotation_spacing,
+                 projection.cos_rotation_spacing);
+
+  Vector3d n(0, 0, 1);
+  n.RotateSinCos(Plane2dType::kXz, projection.sin_rotation_spacing,
+                 projection.cos_rotation_spacing);
+  n.RotateSinCos(Plane2dType::kYz, projection.sin_rotation_swing,
+                 projection.cos_rotation_swing);
+
+  q_[0] = q.x();
+  q_[1] = q.y();
+  q_[2] = q.z();
+  n_[0] = n.x();
+  n_[1] = n.y();
+  n_[2] = n.z();
+
+  is_updated_ = std::isfinite(length_) && std::isfinite(sinh_left_);
+  return is_updated_;
+}
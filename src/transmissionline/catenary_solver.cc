@@ -41,7 +41,9 @@ bool CatenarySolver::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "CATENARY SOLVER";
+  if (messages != nullptr) {
+    message.title = "CATENARY SOLVER";
+  }
 
   // validates position-target
   if (position_target_ == -1) {
@@ -20,7 +20,9 @@ bool Hardware::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "HARDWARE";
+  if (messages != nullptr) {
+    message.title = "HARDWARE";
+  }
 
   // validates area-cross-section
   if (area_cross_section < 0) {
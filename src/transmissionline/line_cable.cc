@@ -30,7 +30,7 @@ int LineCable::AddConnection(const LineCableConnection& connection) {
 
   const LineStructure* line_structure = connection.line_structure;
 
-  // searches list for the position to insert connection
+  // searches container for the position to insert connection
   auto iter = connections_.begin();
   while (iter != connections_.end()) {
     const LineCableConnection& connection_list = *iter;
@@ -46,11 +46,11 @@ int LineCable::AddConnection(const LineCableConnection& connection) {
     }
   }
 
-  // inserts connection into list
-  connections_.insert(iter, connection);
+  // inserts connection into container
+  iter = connections_.insert(iter, connection);
 
   // gets index and returns
-  return std::distance(connections_.begin(), iter) - 1;
+  return std::distance(connections_.begin(), iter);
 }
 
 Catenary3d LineCable::CatenaryRulingSpan() const {
@@ -113,9 +113,8 @@ bool LineCable::DeleteConnection(const int& index) {
     return false;
   }
 
-  // gets iterator and erases point
-  auto iter = std::next(connections_.cbegin(), index);
-  connections_.erase(iter);
+  // erases connection
+  connections_.erase(connections_.cbegin() + index);
 
   return true;
 }
@@ -128,8 +127,7 @@ int LineCable::ModifyConnection(const int& index,
   }
 
   // caches specified connection in case something goes wrong
-  LineCableConnection connection_cache = *std::next(connections_.cbegin(),
-                                                    index);
+  LineCableConnection connection_cache = connections_[index];
   if (DeleteConnection(index) == false) {
     return -1;
   }
@@ -149,7 +147,9 @@ bool LineCable::Validate(const bool& is_included_warnings,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "LINE CABLE";
+  if (messages != nullptr) {
+    message.title = "LINE CABLE";
+  }
 
   // validates cable
   if (cable_ == nullptr) {
@@ -246,14 +246,16 @@ bool LineCable::ValidateConnections(const bool& /*is_included_warnings*/,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "LINE CABLE";
+  if (messages != nullptr) {
+    message.title = "LINE CABLE";
+  }
 
   // validates all connections
   const int kSizeConnections = connections_.size();
   if (kSizeConnections < 2) {
     is_valid = false;
-    message.description = "Not enough connections";
     if (messages != nullptr) {
+      message.description = "Not enough connections";
       messages->push_back(message);
     }
   } else {
@@ -267,18 +269,18 @@ bool LineCable::ValidateConnections(const bool& /*is_included_warnings*/,
           || (connection == &connections_.back())) {
         // checks for dead-end hardware at start and end connections
         if (hardware->type != Hardware::HardwareType::kDeadEnd) {
-          message.description = "Terminal line cable connection does not have "
-                                "dead-end type hardware";
           if (messages != nullptr) {
+            message.description = "Terminal line cable connection does not "
+                                  "have dead-end type hardware";
             messages->push_back(message);
           }
         }
       } else {
         // checks for suspension hardware at all middle connections
         if (hardware->type != Hardware::HardwareType::kSuspension) {
-          message.description = "Interior line cable connection does not have "
-                                "suspension type hardware";
           if (messages != nullptr) {
+            message.description = "Interior line cable connection does not "
+                                  "have suspension type hardware";
             messages->push_back(message);
           }
         }
@@ -293,7 +295,7 @@ const Cable* LineCable::cable() const {
   return cable_;
 }
 
-const std::list<LineCableConnection>* LineCable::connections() const {
+const std::vector<LineCableConnection>* LineCable::connections() const {
   return &connections_;
 }
 
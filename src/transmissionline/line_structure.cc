@@ -43,7 +43,9 @@ bool LineStructure::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "LINE STRUCTURE";
+  if (messages != nullptr) {
+    message.title = "LINE STRUCTURE";
+  }
 
   // validates assemblies
   for (auto iter = hardwares_.cbegin(); iter != hardwares_.cend(); iter++) {
@@ -0,0 +1,333 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/multi_cable_position_locator.h"
+
+#include <string>
+
+MultiCablePositionLocator::MultiCablePositionLocator() {
+  indexes_cable_ = nullptr;
+  line_ = nullptr;
+  load_states_ = nullptr;
+  pool_ = nullptr;
+  type_solver_ = CablePositionLocator::SolverType::kFixedPoint;
+
+  is_updated_ = false;
+}
+
+MultiCablePositionLocator::~MultiCablePositionLocator() {
+}
+
+const std::vector<Point3d<double>>*
+    MultiCablePositionLocator::PointsCableAttachment(
+        const int& index_cable,
+        const int& index_state) const {
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return nullptr;
+  }
+
+  // checks indexes
+  const int kSizeCables = indexes_cable_->size();
+  const int kSizeStates = load_states_->size();
+  if ((index_cable < 0) || (kSizeCables <= index_cable)
+      || (index_state < 0) || (kSizeStates <= index_state)) {
+    return nullptr;
+  }
+
+  // checks if the solution exists
+  const int index = (index_cable * kSizeStates) + index_state;
+  if (is_solved_[index] == 0) {
+    return nullptr;
+  }
+
+  return &points_cable_[index];
+}
+
+bool MultiCablePositionLocator::Validate(
+    const bool& is_included_warnings,
+    std::list<ErrorMessage>* messages) const {
+  // initializes
+  bool is_valid = true;
+  ErrorMessage message;
+  if (messages != nullptr) {
+    message.title = "MULTI CABLE POSITION LOCATOR";
+  }
+
+  // validates line
+  if (line_ == nullptr) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid transmission line";
+      messages->push_back(message);
+    }
+  } else {
+    if (line_->Validate(is_included_warnings, messages) == false) {
+      is_valid = false;
+    }
+  }
+
+  // validates indexes-line-cable
+  if (indexes_cable_ == nullptr) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid line cable indexes";
+      messages->push_back(message);
+    }
+  } else if (line_ != nullptr) {
+    const int kSizeLineCables = line_->line_cables()->size();
+    for (auto iter = indexes_cable_->cbegin(); iter != indexes_cable_->cend();
+         iter++) {
+      const int& index = *iter;
+      if ((index < 0) || (kSizeLineCables <= index)) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Invalid line cable index: "
+                                + std::to_string(index);
+          messages->push_back(message);
+        }
+      }
+    }
+  }
+
+  // validates load-states
+  if (load_states_ == nullptr) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid load states";
+      messages->push_back(message);
+    }
+  } else {
+    const int kSizeStates = load_states_->size();
+    for (int index = 0; index < kSizeStates; index++) {
+      const CablePositionLoadState& state = (*load_states_)[index];
+
+      if (state.direction_wind == AxisDirectionType::kNull) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Load state " + std::to_string(index)
+                                + ": Invalid wind direction";
+          messages->push_back(message);
+        }
+      }
+
+      if (state.tension_horizontal <= 0) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Load state " + std::to_string(index)
+                                + ": Invalid horizontal tension";
+          messages->push_back(message);
+        }
+      }
+
+      if (state.weight_unit.x() != 0) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Load state " + std::to_string(index)
+                                + ": Invalid horizontal unit weight. It must "
+                                "equal zero";
+          messages->push_back(message);
+        }
+      }
+
+      if (state.weight_unit.y() < 0) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Load state " + std::to_string(index)
+                                + ": Invalid transverse unit weight";
+          messages->push_back(message);
+        }
+      }
+
+      if (state.weight_unit.z() <= 0) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description = "Load state " + std::to_string(index)
+                                + ": Invalid vertical unit weight";
+          messages->push_back(message);
+        }
+      }
+    }
+  }
+
+  // validates type-solver
+  if (type_solver_ == CablePositionLocator::SolverType::kNull) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid solver type";
+      messages->push_back(message);
+    }
+  }
+
+  // returns if errors are present
+  if (is_valid == false) {
+    return is_valid;
+  }
+
+  // validates update process
+  if (Update() == false) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Error updating class.";
+      messages->push_back(message);
+    }
+  } else {
+    // validates that every cable position solved
+    const int kSizeSolutions = is_solved_.size();
+    for (int index = 0; index < kSizeSolutions; index++) {
+      if (is_solved_[index] == 0) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description =
+              "Could not solve cable position for line cable "
+              + std::to_string((*indexes_cable_)[index / load_states_->size()])
+              + " and load state "
+              + std::to_string(index % load_states_->size());
+          messages->push_back(message);
+        }
+      }
+    }
+  }
+
+  return is_valid;
+}
+
+const std::vector<int>* MultiCablePositionLocator::indexes_line_cable() const {
+  return indexes_cable_;
+}
+
+const std::vector<CablePositionLoadState>*
+    MultiCablePositionLocator::load_states() const {
+  return load_states_;
+}
+
+void MultiCablePositionLocator::set_indexes_line_cable(
+    const std::vector<int>* indexes_line_cable) {
+  indexes_cable_ = indexes_line_cable;
+  is_updated_ = false;
+}
+
+void MultiCablePositionLocator::set_load_states(
+    const std::vector<CablePositionLoadState>* load_states) {
+  load_states_ = load_states;
+  is_updated_ = false;
+}
+
+void MultiCablePositionLocator::set_thread_pool(ThreadPool* pool) {
+  pool_ = pool;
+}
+
+void MultiCablePositionLocator::set_transmission_line(
+    const TransmissionLine* line) {
+  line_ = line;
+  is_updated_ = false;
+}
+
+void MultiCablePositionLocator::set_type_solver(
+    const CablePositionLocator::SolverType& type_solver) {
+  type_solver_ = type_solver;
+  is_updated_ = false;
+}
+
+ThreadPool* MultiCablePositionLocator::thread_pool() const {
+  return pool_;
+}
+
+const TransmissionLine* MultiCablePositionLocator::transmission_line() const {
+  return line_;
+}
+
+CablePositionLocator::SolverType MultiCablePositionLocator::type_solver()
+    const {
+  return type_solver_;
+}
+
+bool MultiCablePositionLocator::IsUpdated() const {
+  return is_updated_ == true;
+}
+
+bool MultiCablePositionLocator::Update() const {
+  // updates the connection geometry
+  is_updated_ = UpdateGeometries();
+  if (is_updated_ == false) {
+    return false;
+  }
+
+  // updates the cable attachment points
+  is_updated_ = UpdatePointsCableAttachment();
+  if (is_updated_ == false) {
+    return false;
+  }
+
+  // if it reaches this point, update was successful
+  return true;
+}
+
+bool MultiCablePositionLocator::UpdateGeometries() const {
+  if ((line_ == nullptr) || (indexes_cable_ == nullptr)) {
+    return false;
+  }
+
+  // resolves the geometry for each line cable
+  // this is done on the calling thread because the transmission line updates
+  // its cached points when queried
+  const int kSizeCables = indexes_cable_->size();
+  geometries_.clear();
+  geometries_.resize(kSizeCables);
+  for (int index = 0; index < kSizeCables; index++) {
+    const bool status = CablePositionLocator::ResolveConnectionGeometry(
+        *line_,
+        (*indexes_cable_)[index],
+        &geometries_[index]);
+    if (status == false) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool MultiCablePositionLocator::UpdatePointsCableAttachment() const {
+  if (load_states_ == nullptr) {
+    return false;
+  }
+
+  // initializes containers
+  const int kSizeStates = load_states_->size();
+  const int kSizeSolutions = geometries_.size() * kSizeStates;
+
+  is_solved_.clear();
+  is_solved_.resize(kSizeSolutions, 0);
+
+  points_cable_.clear();
+  points_cable_.resize(kSizeSolutions);
+
+  // defines a task that solves a single line cable and load state
+  // each task only writes to its own solution index
+  auto task = [this, kSizeStates](const int& index) {
+    const int index_cable = index / kSizeStates;
+    const int index_state = index % kSizeStates;
+    const CablePositionLoadState& state = (*load_states_)[index_state];
+
+    CablePositionLocator locator;
+    locator.set_direction_wind(state.direction_wind);
+    locator.set_geometry_connections(&geometries_[index_cable]);
+    locator.set_index_line_cable((*indexes_cable_)[index_cable]);
+    locator.set_tension_horizontal(state.tension_horizontal);
+    locator.set_transmission_line(line_);
+    locator.set_type_solver(type_solver_);
+    locator.set_weight_unit(&state.weight_unit);
+
+    const std::vector<Point3d<double>>* points =
+        locator.PointsCableAttachment();
+    if (points != nullptr) {
+      points_cable_[index] = *points;
+      is_solved_[index] = 1;
+    }
+  };
+
+  // solves all tasks
+  ThreadPool::Run(pool_, kSizeSolutions, task);
+
+  return true;
+}
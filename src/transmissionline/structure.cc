@@ -18,7 +18,9 @@ bool StructureAttachment::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "STRUCTURE ATTACHMENT";
+  if (messages != nullptr) {
+    message.title = "STRUCTURE ATTACHMENT";
+  }
 
   // validates offset-vertical-top
   if (offset_vertical_top < 0) {
@@ -47,7 +49,9 @@ bool Structure::Validate(
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "STRUCTURE";
+  if (messages != nullptr) {
+    message.title = "STRUCTURE";
+  }
 
   // validates attachments
   if (attachments.size() == 0) {
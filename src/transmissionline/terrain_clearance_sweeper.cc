@@ -0,0 +1,420 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/terrain_clearance_sweeper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace {
+
+/// \brief Gets the span position fraction at a distance along the span.
+/// \param[in] span
+///   The span geometry.
+/// \param[in] x
+///   The horizontal distance from the back attachment, along the span.
+/// \return The position fraction.
+double PositionFractionX(const ClearanceSpanGeometry& span, const double& x) {
+  // bisects the position fraction, which increases with the x coordinate
+  double a = 0;
+  double b = 1;
+  while (1e-10 < (b - a)) {
+    const double position = (a + b) / 2;
+    if (span.catenary.Coordinate(position).x < x) {
+      a = position;
+    } else {
+      b = position;
+    }
+  }
+
+  return (a + b) / 2;
+}
+
+}  // namespace
+
+TerrainClearanceSweeper::TerrainClearanceSweeper() {
+  indexes_cable_ = nullptr;
+  line_ = nullptr;
+  load_states_ = nullptr;
+  pool_ = nullptr;
+  terrain_ = nullptr;
+  tolerance_horizontal_ = -999999;
+
+  is_updated_ = false;
+}
+
+TerrainClearanceSweeper::~TerrainClearanceSweeper() {
+}
+
+const std::vector<TerrainClearance>* TerrainClearanceSweeper::Clearances(
+    const int& index_cable,
+    const int& index_state) const {
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return nullptr;
+  }
+
+  // checks indexes
+  const int kSizeCables = indexes_cable_->size();
+  const int kSizeStates = load_states_->size();
+  if ((index_cable < 0) || (kSizeCables <= index_cable)
+      || (index_state < 0) || (kSizeStates <= index_state)) {
+    return nullptr;
+  }
+
+  // checks if the solution exists
+  const int index = (index_cable * kSizeStates) + index_state;
+  if (is_solved_[index] == 0) {
+    return nullptr;
+  }
+
+  return &clearances_[index];
+}
+
+bool TerrainClearanceSweeper::Validate(
+    const bool& is_included_warnings,
+    std::list<ErrorMessage>* messages) const {
+  // initializes
+  bool is_valid = true;
+  ErrorMessage message;
+  if (messages != nullptr) {
+    message.title = "TERRAIN CLEARANCE SWEEPER";
+  }
+
+  // validates cable position locator, which validates the line, line cable
+  // indexes, and load states
+  if (locator_.Validate(is_included_warnings, messages) == false) {
+    is_valid = false;
+  }
+
+  // validates terrain profile
+  if (terrain_ == nullptr) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid terrain profile";
+      messages->push_back(message);
+    }
+  } else {
+    if (terrain_->Validate(is_included_warnings, messages) == false) {
+      is_valid = false;
+    }
+  }
+
+  // validates tolerance-horizontal
+  if (tolerance_horizontal_ < 0) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid horizontal tolerance";
+      messages->push_back(message);
+    }
+  }
+
+  // returns if errors are present
+  if (is_valid == false) {
+    return is_valid;
+  }
+
+  // validates update process
+  if (Update() == false) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Error updating class.";
+      messages->push_back(message);
+    }
+  } else {
+    // validates that every sweep solved
+    const int kSizeSolutions = is_solved_.size();
+    for (int index = 0; index < kSizeSolutions; index++) {
+      if (is_solved_[index] == 0) {
+        is_valid = false;
+        if (messages != nullptr) {
+          message.description =
+              "Could not solve terrain clearance for line cable "
+              + std::to_string((*indexes_cable_)[index / load_states_->size()])
+              + " and load state "
+              + std::to_string(index % load_states_->size());
+          messages->push_back(message);
+        }
+      }
+    }
+  }
+
+  return is_valid;
+}
+
+const std::vector<int>* TerrainClearanceSweeper::indexes_line_cable() const {
+  return indexes_cable_;
+}
+
+const std::vector<CablePositionLoadState>*
+    TerrainClearanceSweeper::load_states() const {
+  return load_states_;
+}
+
+void TerrainClearanceSweeper::set_indexes_line_cable(
+    const std::vector<int>* indexes_line_cable) {
+  indexes_cable_ = indexes_line_cable;
+  locator_.set_indexes_line_cable(indexes_line_cable);
+  is_updated_ = false;
+}
+
+void TerrainClearanceSweeper::set_load_states(
+    const std::vector<CablePositionLoadState>* load_states) {
+  load_states_ = load_states;
+  locator_.set_load_states(load_states);
+  is_updated_ = false;
+}
+
+void TerrainClearanceSweeper::set_terrain_profile(
+    const TerrainProfile* terrain) {
+  terrain_ = terrain;
+  is_updated_ = false;
+}
+
+void TerrainClearanceSweeper::set_thread_pool(ThreadPool* pool) {
+  pool_ = pool;
+  locator_.set_thread_pool(pool);
+}
+
+void TerrainClearanceSweeper::set_tolerance_horizontal(
+    const double& tolerance_horizontal) {
+  tolerance_horizontal_ = tolerance_horizontal;
+  is_updated_ = false;
+}
+
+void TerrainClearanceSweeper::set_transmission_line(
+    const TransmissionLine* line) {
+  line_ = line;
+  locator_.set_transmission_line(line);
+  is_updated_ = false;
+}
+
+const TerrainProfile* TerrainClearanceSweeper::terrain_profile() const {
+  return terrain_;
+}
+
+ThreadPool* TerrainClearanceSweeper::thread_pool() const {
+  return pool_;
+}
+
+double TerrainClearanceSweeper::tolerance_horizontal() const {
+  return tolerance_horizontal_;
+}
+
+const TransmissionLine* TerrainClearanceSweeper::transmission_line() const {
+  return line_;
+}
+
+bool TerrainClearanceSweeper::IsUpdated() const {
+  return is_updated_ == true;
+}
+
+TerrainClearance TerrainClearanceSweeper::SweepSpan(
+    const ClearanceSpanGeometry& span,
+    const int& index_begin,
+    const int& index_end) const {
+  TerrainClearance clearance;
+
+  const double length_xy = span.catenary.spacing_endpoints().x();
+  for (int index = index_begin; index < index_end; index++) {
+    const Point3d<double>& point = points_terrain_[index];
+
+    // skips points that are not on the alignment
+    if (point.x == -999999) {
+      continue;
+    }
+
+    // solves the cable point at the point position along the span
+    double x = (point.x - span.point_back.x) * span.angle_xy_cos
+               + (point.y - span.point_back.y) * span.angle_xy_sin;
+    x = std::min(length_xy, std::max(0.0, x));
+
+    const Point3d<double> point_cable = CableClearanceSolver::PointSpan(
+        span, PositionFractionX(span, x));
+
+    // solves the vertical clearance if the point is beneath the cable
+    const double distance_horizontal =
+        std::sqrt(std::pow(point_cable.x - point.x, 2)
+                  + std::pow(point_cable.y - point.y, 2));
+    if (distance_horizontal <= tolerance_horizontal_) {
+      const double distance_vertical = point_cable.z - point.z;
+      if ((clearance.index_point_vertical == -1)
+          || (distance_vertical < clearance.distance_vertical)) {
+        clearance.distance_vertical = distance_vertical;
+        clearance.index_point_vertical = index;
+      }
+    }
+
+    // skips the radial search if the span bounds are not closer than the
+    // best radial clearance
+    BoundingBox3d box;
+    box.Expand(point);
+    if ((clearance.index_point_radial != -1)
+        && (clearance.distance_radial <= span.box.Distance(box))) {
+      continue;
+    }
+
+    // solves the radial clearance
+    const ClearanceResult result =
+        CableClearanceSolver::ClearancePoint(span, point);
+    if ((clearance.index_point_radial == -1)
+        || (result.distance < clearance.distance_radial)) {
+      clearance.distance_radial = result.distance;
+      clearance.index_point_radial = index;
+    }
+  }
+
+  return clearance;
+}
+
+bool TerrainClearanceSweeper::Update() const {
+  // updates the terrain xyz points
+  is_updated_ = UpdatePointsTerrain();
+  if (is_updated_ == false) {
+    return false;
+  }
+
+  // updates the terrain point range beneath every span
+  is_updated_ = UpdateIndexesPointSpan();
+  if (is_updated_ == false) {
+    return false;
+  }
+
+  // updates the clearances
+  is_updated_ = UpdateClearances();
+  if (is_updated_ == false) {
+    return false;
+  }
+
+  // if it reaches this point, update was successful
+  return true;
+}
+
+bool TerrainClearanceSweeper::UpdateClearances() const {
+  if (load_states_ == nullptr) {
+    return false;
+  }
+
+  // initializes containers
+  const int kSizeStates = load_states_->size();
+  const int kSizeSolutions = indexes_point_span_.size() * kSizeStates;
+
+  is_solved_.clear();
+  is_solved_.resize(kSizeSolutions, 0);
+
+  clearances_.clear();
+  clearances_.resize(kSizeSolutions);
+
+  // gets the cable attachment points for every solution
+  // this is done on the calling thread because the locator updates when
+  // queried
+  std::vector<const std::vector<Point3d<double>>*> points_cable(
+      kSizeSolutions, nullptr);
+  for (int index = 0; index < kSizeSolutions; index++) {
+    points_cable[index] = locator_.PointsCableAttachment(
+        index / kSizeStates,
+        index % kSizeStates);
+  }
+
+  // defines a task that sweeps a single line cable and load state
+  // each task only writes to its own solution index
+  auto task = [this, kSizeStates, &points_cable](const int& index) {
+    if (points_cable[index] == nullptr) {
+      return;
+    }
+
+    const int index_cable = index / kSizeStates;
+    const int index_state = index % kSizeStates;
+    const CablePositionLoadState& state = (*load_states_)[index_state];
+    const std::vector<int>& indexes_point = indexes_point_span_[index_cable];
+
+    ClearanceCable cable;
+    cable.direction_transverse = state.direction_wind;
+    cable.points_attachment = *points_cable[index];
+    cable.tension_horizontal = state.tension_horizontal;
+    cable.weight_unit = state.weight_unit;
+
+    // sweeps every span
+    const int kSizeSpans = static_cast<int>(cable.points_attachment.size()) - 1;
+    std::vector<TerrainClearance>& clearances = clearances_[index];
+    clearances.resize(kSizeSpans);
+    for (int index_span = 0; index_span < kSizeSpans; index_span++) {
+      ClearanceSpanGeometry span;
+      if (CableClearanceSolver::SolveSpanGeometry(cable, index_span,
+                                                  &span) == false) {
+        return;
+      }
+
+      clearances[index_span] = SweepSpan(span,
+                                         indexes_point[2 * index_span],
+                                         indexes_point[2 * index_span + 1]);
+    }
+
+    is_solved_[index] = 1;
+  };
+
+  // solves all tasks
+  ThreadPool::Run(pool_, kSizeSolutions, task);
+
+  return true;
+}
+
+bool TerrainClearanceSweeper::UpdateIndexesPointSpan() const {
+  if (indexes_cable_ == nullptr) {
+    return false;
+  }
+
+  const std::vector<TerrainPoint>* points = terrain_->points();
+  const int kSizePoints = points->size();
+  const SlotVector<LineCable>* line_cables = line_->line_cables();
+  const int kSizeLineCables = line_cables->size();
+
+  // finds the terrain point range between the structures of every span
+  const int kSizeCables = indexes_cable_->size();
+  indexes_point_span_.clear();
+  indexes_point_span_.resize(kSizeCables);
+  for (int index_cable = 0; index_cable < kSizeCables; index_cable++) {
+    const int& index_line_cable = (*indexes_cable_)[index_cable];
+    if ((index_line_cable < 0) || (kSizeLineCables <= index_line_cable)) {
+      return false;
+    }
+
+    const std::vector<LineCableConnection>* connections =
+        (*line_cables)[index_line_cable].connections();
+    const int kSizeSpans = static_cast<int>(connections->size()) - 1;
+
+    std::vector<int>& indexes_point = indexes_point_span_[index_cable];
+    indexes_point.reserve(2 * std::max(0, kSizeSpans));
+    for (int index_span = 0; index_span < kSizeSpans; index_span++) {
+      const double station_back =
+          (*connections)[index_span].line_structure->station();
+      const double station_ahead =
+          (*connections)[index_span + 1].line_structure->station();
+      const double station_min = std::min(station_back, station_ahead);
+      const double station_max = std::max(station_back, station_ahead);
+
+      // includes the points on the structure stations
+      int index_end = terrain_->IndexPoint(station_max);
+      while ((index_end < kSizePoints)
+             && ((*points)[index_end].station == station_max)) {
+        index_end++;
+      }
+
+      indexes_point.push_back(terrain_->IndexPoint(station_min));
+      indexes_point.push_back(index_end);
+    }
+  }
+
+  return true;
+}
+
+bool TerrainClearanceSweeper::UpdatePointsTerrain() const {
+  if ((line_ == nullptr) || (terrain_ == nullptr)) {
+    return false;
+  }
+
+  points_terrain_ = terrain_->PointsXyz(*line_);
+
+  return true;
+}
@@ -0,0 +1,209 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/terrain_profile.h"
+
+#include <algorithm>
+#include <cmath>
+
+TerrainPoint::TerrainPoint() {
+  elevation = -999999;
+  offset = -999999;
+  station = -999999;
+}
+
+TerrainPoint::~TerrainPoint() {
+}
+
+bool TerrainPoint::Validate(const bool& /*is_included_warnings*/,
+                            std::list<ErrorMessage>* messages) const {
+  // initializes
+  bool is_valid = true;
+  ErrorMessage message;
+  if (messages != nullptr) {
+    message.title = "TERRAIN POINT";
+  }
+
+  // validates elevation
+  if (elevation < 0) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid elevation";
+      messages->push_back(message);
+    }
+  }
+
+  // validates offset
+  if (offset == -999999) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid offset";
+      messages->push_back(message);
+    }
+  }
+
+  // validates station
+  if (station < 0) {
+    is_valid = false;
+    if (messages != nullptr) {
+      message.description = "Invalid station";
+      messages->push_back(message);
+    }
+  }
+
+  // returns validation status
+  return is_valid;
+}
+
+
+TerrainProfile::TerrainProfile() {
+  is_sorted_ = true;
+}
+
+TerrainProfile::~TerrainProfile() {
+}
+
+void TerrainProfile::AddPoint(const TerrainPoint& point) {
+  // flags for sorting if the point is behind the last point
+  if ((stations_.empty() == false) && (point.station < stations_.back())) {
+    is_sorted_ = false;
+  }
+
+  points_.push_back(point);
+  stations_.push_back(point.station);
+}
+
+void TerrainProfile::AddPoints(const std::vector<TerrainPoint>& points) {
+  Reserve(points_.size() + points.size());
+  for (auto iter = points.cbegin(); iter != points.cend(); iter++) {
+    AddPoint(*iter);
+  }
+}
+
+void TerrainProfile::Clear() {
+  points_.clear();
+  stations_.clear();
+  is_sorted_ = true;
+}
+
+int TerrainProfile::IndexPoint(const double& station) const {
+  Sort();
+
+  auto iter = std::lower_bound(stations_.cbegin(), stations_.cend(), station);
+  return std::distance(stations_.cbegin(), iter);
+}
+
+std::vector<int> TerrainProfile::IndexesSegment(
+    const Alignment& alignment) const {
+  Sort();
+
+  // the stations are sorted, so the alignment is merged in a single pass
+  return alignment.IndexesSegment(stations_);
+}
+
+std::vector<Point3d<double>> TerrainProfile::PointsXyz(
+    const TransmissionLine& line) const {
+  const int kSizePoints = points()->size();
+  std::vector<Point3d<double>> points_xyz(kSizePoints, Point3d<double>());
+
+  // gets the alignment xyz points
+  const std::vector<Point3d<double>>* points_xyz_alignment =
+      line.PointsXyzAlignment();
+  if (points_xyz_alignment == nullptr) {
+    return points_xyz;
+  }
+
+  const std::vector<AlignmentPoint>* points_alignment =
+      line.alignment()->points();
+
+  // gets segment indexes
+  const std::vector<int> indexes = IndexesSegment(*line.alignment());
+
+  // solves points for valid segments
+  for (int index = 0; index < kSizePoints; index++) {
+    const int& index_segment = indexes[index];
+    if (index_segment == -1) {
+      continue;
+    }
+
+    const TerrainPoint& point = points_[index];
+    const AlignmentPoint& point_align_back =
+        (*points_alignment)[index_segment];
+    const Point3d<double>& point_xyz_back =
+        (*points_xyz_alignment)[index_segment];
+    const Point3d<double>& point_xyz_ahead =
+        (*points_xyz_alignment)[index_segment + 1];
+
+    // gets a unit xy vector along the alignment segment
+    double x = point_xyz_ahead.x - point_xyz_back.x;
+    double y = point_xyz_ahead.y - point_xyz_back.y;
+    const double length = std::sqrt(x * x + y * y);
+    x = x / length;
+    y = y / length;
+
+    // moves along the segment, and then perpendicular to it
+    // a positive offset is to the right of the alignment path
+    const double distance_station = point.station - point_align_back.station;
+
+    Point3d<double>& point_xyz = points_xyz[index];
+    point_xyz.x = point_xyz_back.x + (x * distance_station)
+                  + (y * point.offset);
+    point_xyz.y = point_xyz_back.y + (y * distance_station)
+                  - (x * point.offset);
+    point_xyz.z = point_xyz_back.z
+                  + (point.elevation - point_align_back.elevation);
+  }
+
+  return points_xyz;
+}
+
+void TerrainProfile::Reserve(const int& size) {
+  points_.reserve(size);
+  stations_.reserve(size);
+}
+
+bool TerrainProfile::Validate(const bool& is_included_warnings,
+                              std::list<ErrorMessage>* messages) const {
+  // initializes
+  bool is_valid = true;
+  ErrorMessage message;
+  if (messages != nullptr) {
+    message.title = "TERRAIN PROFILE";
+  }
+
+  // validates points
+  for (auto iter = points_.cbegin(); iter != points_.cend(); iter++) {
+    const TerrainPoint& point = *iter;
+    if (point.Validate(is_included_warnings, messages) == false) {
+      is_valid = false;
+    }
+  }
+
+  // returns validation status
+  return is_valid;
+}
+
+const std::vector<TerrainPoint>* TerrainProfile::points() const {
+  Sort();
+  return &points_;
+}
+
+void TerrainProfile::Sort() const {
+  if (is_sorted_ == true) {
+    return;
+  }
+
+  // sorts the points, keeping the added order for matching stations
+  std::stable_sort(points_.begin(), points_.end(),
+                   [](const TerrainPoint& a, const TerrainPoint& b) {
+                     return a.station < b.station;
+                   });
+
+  // rebuilds the stations
+  const int kSize = points_.size();
+  for (int index = 0; index < kSize; index++) {
+    stations_[index] = points_[index].station;
+  }
+
+  is_sorted_ = true;
+}
@@ -3,9 +3,12 @@
 
 #include "models/transmissionline/transmission_line.h"
 
+#include <algorithm>
+#include <set>
+#include <utility>
+
 TransmissionLine::TransmissionLine() {
-  is_updated_points_xyz_alignment_ = false;
-  is_updated_points_xyz_structures_ = false;
+  is_updated_points_xyz_structures_ = true;
 }
 
 TransmissionLine::TransmissionLine(const TransmissionLine& that) {
@@ -16,31 +19,30 @@ TransmissionLine::TransmissionLine(const TransmissionLine& that) {
 TransmissionLine& TransmissionLine::operator=(const TransmissionLine& that) {
   // transfers members as-is
   this->alignment_ = that.alignment_;
-  this->is_updated_points_xyz_alignment_ =
-      that.is_updated_points_xyz_alignment_;
+  this->is_stale_points_xyz_structures_ = that.is_stale_points_xyz_structures_;
   this->is_updated_points_xyz_structures_ =
       that.is_updated_points_xyz_structures_;
   this->line_cables_ = that.line_cables_;
   this->line_structures_ = that.line_structures_;
   this->origin_ = that.origin_;
+  this->points_xyz_alignment_ = that.points_xyz_alignment_;
+  this->points_xyz_structures_ = that.points_xyz_structures_;
 
   // adjusts the new line cable connections to reference the new line structures
   for (auto iter_cable = line_cables_.begin(); iter_cable != line_cables_.end();
        iter_cable++) {
     LineCable& line_cable = *iter_cable;
-    const std::list<LineCableConnection>* connections =
+    const std::vector<LineCableConnection>* connections =
         line_cable.connections();
     const int kSizeConnections = connections->size();
     for (int index_connection = 0; index_connection < kSizeConnections;
          index_connection++) {
-      LineCableConnection connection = *std::next(connections->cbegin(),
-                                                  index_connection);
+      LineCableConnection connection = (*connections)[index_connection];
 
       // gets the structure index, and switches connection reference
       const int index_structure =
           that.IndexLineStructure(connection.line_structure);
-      const LineStructure* structure = &*(std::next(line_structures_.cbegin(),
-                                                    index_structure));
+      const LineStructure* structure = &line_structures_[index_structure];
       connection.line_structure = structure;
 
       // modifies connection in line cable
@@ -55,9 +57,14 @@ TransmissionLine::~TransmissionLine() {
 }
 
 int TransmissionLine::AddAlignmentPoint(const AlignmentPoint& point) {
-  is_updated_points_xyz_alignment_ = false;
-  is_updated_points_xyz_structures_ = false;
-  return alignment_.AddPoint(point);
+  const int index = alignment_.AddPoint(point);
+
+  // flags the cached points downstream of the new point
+  if (index != -1) {
+    FlagStalePointsXyzAlignment(index);
+  }
+
+  return index;
 }
 
 int TransmissionLine::AddLineCable(const LineCable& line_cable) {
@@ -66,20 +73,34 @@ int TransmissionLine::AddLineCable(const LineCable& line_cable) {
     return -1;
   }
 
-  // checks all the line cable connections
-  const std::list<LineCableConnection>* connections = line_cable.connections();
+  // checks that all the connection structures are owned by line
+  const std::vector<LineCableConnection>* connections = line_cable.connections();
+  std::set<std::pair<const LineStructure*, int>> attachments_new;
   for (auto iter = connections->cbegin(); iter != connections->cend(); iter++) {
     const LineCableConnection& connection = *iter;
-
-    // checks that structure is owned by line
-    const int index_structure = IndexLineStructure(connection.line_structure);
-    if (index_structure == -1) {
+    if (IndexLineStructure(connection.line_structure) == -1) {
       return -1;
     }
 
-    // checks if the attachment is open
-    if (HasConnection(index_structure, connection.index_attachment) == true) {
-      return -1;
+    attachments_new.insert(std::make_pair(connection.line_structure,
+                                          connection.index_attachment));
+  }
+
+  // checks if the attachments are open
+  // the existing connections are searched once instead of once per new
+  // connection, so bulk loading a line does not scale quadratically
+  for (auto iter_cable = line_cables_.cbegin();
+       iter_cable != line_cables_.cend(); iter_cable++) {
+    const std::vector<LineCableConnection>* connections_list =
+        iter_cable->connections();
+    for (auto iter = connections_list->cbegin();
+         iter != connections_list->cend(); iter++) {
+      const LineCableConnection& connection = *iter;
+      if (attachments_new.count(std::make_pair(connection.line_structure,
+                                               connection.index_attachment))
+          != 0) {
+        return -1;
+      }
     }
   }
 
@@ -115,39 +136,42 @@ int TransmissionLine::AddLineCable(const LineCable& line_cable) {
 }
 
 int TransmissionLine::AddLineStructure(const LineStructure& structure) {
-  is_updated_points_xyz_structures_ = false;
-
   // checks station
   if (alignment_.IsValidStation(structure.station()) == false) {
     return -1;
   }
 
-  // searches list for the position to insert structure
-  auto iter = line_structures_.begin();
-  while (iter != line_structures_.end()) {
-    const LineStructure& list_structure = *iter;
-    if (structure.station() < list_structure.station()) {
-      // position is found
-      break;
-    } else if (structure.station() == list_structure.station()) {
-      // exits due to duplicate station
-      return -1;
-    } else {
-      iter++;
-    }
+  // searches for the position to insert structure
+  // the structures are sorted by station, so a binary search is used
+  auto iter = std::lower_bound(
+      line_structures_.cbegin(), line_structures_.cend(), structure,
+      [](const LineStructure& structure_list,
+         const LineStructure& structure_new) {
+        return structure_list.station() < structure_new.station();
+      });
+
+  // exits due to duplicate station
+  if ((iter != line_structures_.cend())
+      && (iter->station() == structure.station())) {
+    return -1;
   }
 
-  // inserts structure into list
-  iter = line_structures_.insert(iter, structure);
+  // inserts structure into container
+  auto iter_new = line_structures_.insert(iter, structure);
+  const int index = iter_new.position();
 
-  // gets index and returns
-  return std::distance(line_structures_.begin(), iter);
+  // inserts a stale cached point for the structure
+  is_stale_points_xyz_structures_.insert(
+      is_stale_points_xyz_structures_.cbegin() + index, true);
+  points_xyz_structures_.insert(points_xyz_structures_.cbegin() + index,
+                                Point3d<double>());
+  is_updated_points_xyz_structures_ = false;
+
+  // returns index
+  return index;
 }
 
 bool TransmissionLine::DeleteAlignmentPoint(const int& index) {
-  is_updated_points_xyz_alignment_ = false;
-  is_updated_points_xyz_structures_ = false;
-
   // determines if point will affect valid station bounds
   bool is_boundary_point = false;
   const int kSize = alignment_.points()->size();
@@ -157,6 +181,11 @@ bool TransmissionLine::DeleteAlignmentPoint(const int& index) {
 
   const bool is_deleted = alignment_.DeletePoint(index);
 
+  // flags the cached points downstream of the deleted point
+  if (is_deleted == true) {
+    FlagStalePointsXyzAlignment(index);
+  }
+
   // removes invalid dependency objects
   if ((is_deleted == true) && (is_boundary_point == true)) {
     DeleteInvalidLineStructures();
@@ -172,18 +201,13 @@ bool TransmissionLine::DeleteLineCable(const int& index) {
     return false;
   }
 
-  // gets iterator
-  auto iter = std::next(line_cables_.cbegin(), index);
-
   // erases from container
-  line_cables_.erase(iter);
+  line_cables_.erase(line_cables_.cbegin() + index);
 
   return true;
 }
 
 bool TransmissionLine::DeleteLineStructure(const int& index) {
-  is_updated_points_xyz_structures_ = false;
-
   // checks index
   if (IsValidLineStructureIndex(index) == false) {
     return false;
@@ -193,9 +217,11 @@ bool TransmissionLine::DeleteLineStructure(const int& index) {
   DeleteConnectionsFromStructure(index);
   DeleteInvalidLineCables();
 
-  // erases from list
-  auto iter_list = std::next(line_structures_.cbegin(), index);
-  line_structures_.erase(iter_list);
+  // erases from containers
+  line_structures_.erase(line_structures_.cbegin() + index);
+  is_stale_points_xyz_structures_.erase(
+      is_stale_points_xyz_structures_.cbegin() + index);
+  points_xyz_structures_.erase(points_xyz_structures_.cbegin() + index);
 
   return true;
 }
@@ -203,14 +229,13 @@ bool TransmissionLine::DeleteLineStructure(const int& index) {
 bool TransmissionLine::HasConnection(const int& index_structure,
                                      const int& index_attachment) const {
   // gets line structure
-  auto iter_structure = std::next(line_structures_.cbegin(), index_structure);
-  const LineStructure* line_structure = &(*iter_structure);
+  const LineStructure* line_structure = &line_structures_[index_structure];
 
   // searches line cables
   for (auto iter_cable = line_cables_.cbegin();
        iter_cable != line_cables_.cend(); iter_cable++) {
     const LineCable& line_cable = *iter_cable;
-    const std::list<LineCableConnection>* connections =
+    const std::vector<LineCableConnection>* connections =
         line_cable.connections();
 
     // searches connections
@@ -230,30 +255,12 @@ bool TransmissionLine::HasConnection(const int& index_structure,
 
 int TransmissionLine::IndexLineStructure(
     const LineStructure* line_structure) const {
-  // searches list for a memory address match
-  auto iter = line_structures_.cbegin();
-  while (iter != line_structures_.cend()) {
-    const LineStructure* line_structure_list = &(*iter);
-    if (line_structure == line_structure_list) {
-      break;
-    } else {
-      iter++;
-    }
-  }
-
-  // checks iterator and returns
-  if (iter == line_structures_.cend()) {
-    return -1;
-  } else {
-    return std::distance(line_structures_.cbegin(), iter);
-  }
+  // looks up the memory address
+  return line_structures_.IndexOf(line_structure);
 }
 
 int TransmissionLine::ModifyAlignmentPoint(const int& index,
                                            const AlignmentPoint& point) {
-  is_updated_points_xyz_alignment_ = false;
-  is_updated_points_xyz_structures_ = false;
-
   // determines if point will affect valid station bounds
   bool is_boundary_point = false;
   const int kSize = alignment_.points()->size();
@@ -264,6 +271,11 @@ int TransmissionLine::ModifyAlignmentPoint(const int& index,
   // modifies alignment
   const int index_new = alignment_.ModifyPoint(index, point);
 
+  // flags the cached points downstream of the old and new point positions
+  if (index_new != -1) {
+    FlagStalePointsXyzAlignment(std::min(index, index_new));
+  }
+
   // removes invalid dependency objects
   if ((index_new != -1) && (is_boundary_point == true)) {
     DeleteInvalidLineStructures();
@@ -281,8 +293,7 @@ int TransmissionLine::ModifyLineCable(const int& index,
   }
 
   // caches current line cable in case something goes wrong
-  auto iter = std::next(line_cables_.begin(), index);
-  const LineCable line_cable_cache = *iter;
+  const LineCable line_cable_cache = line_cables_[index];
 
   // deletes and then adds back
   bool status = DeleteLineCable(index);
@@ -301,8 +312,6 @@ int TransmissionLine::ModifyLineCable(const int& index,
 
 bool TransmissionLine::ModifyLineStructure(const int& index,
                                            const LineStructure& structure) {
-  is_updated_points_xyz_structures_ = false;
-
   // checks if index is valid
   if (IsValidLineStructureIndex(index) == false) {
     return false;
@@ -312,7 +321,7 @@ bool TransmissionLine::ModifyLineStructure(const int& index,
   double station_back = alignment_.points()->front().station - 1;
   const LineStructure* structure_back = nullptr;
   if (index != 0) {
-    structure_back = &(*std::next(line_structures_.cbegin(), index - 1));
+    structure_back = &line_structures_[index - 1];
     station_back = structure_back->station();
   }
 
@@ -321,7 +330,7 @@ bool TransmissionLine::ModifyLineStructure(const int& index,
   const LineStructure* structure_ahead = nullptr;
   const int kSizeLineStructures = line_structures_.size();
   if (index != (kSizeLineStructures - 1)) {
-    structure_ahead = &(*std::next(line_structures_.cbegin(), index + 1));
+    structure_ahead = &line_structures_[index + 1];
     station_ahead = structure_ahead->station();
   }
 
@@ -334,9 +343,13 @@ bool TransmissionLine::ModifyLineStructure(const int& index,
   }
 
   // updates the structure
-  LineStructure& line_structure = *std::next(line_structures_.begin(), index);
+  LineStructure& line_structure = line_structures_[index];
   line_structure = structure;
 
+  // flags the cached point for the structure
+  is_stale_points_xyz_structures_[index] = true;
+  is_updated_points_xyz_structures_ = false;
+
   // updates invalid dependencies
   DeleteInvalidConnectionsFromStructure(index);
   DeleteInvalidLineCables();
@@ -355,6 +368,16 @@ const std::vector<Point3d<double>>* TransmissionLine::PointsXyzAlignment()
   return &points_xyz_alignment_;
 }
 
+std::vector<Point3d<double>> TransmissionLine::PointsXyzAlignment(
+    const std::vector<double>& stations) const {
+  // updates class if necessary
+  if ((IsUpdated() == false) && (Update() == false)) {
+    return std::vector<Point3d<double>>(stations.size(), Point3d<double>());
+  }
+
+  return PointsXyzAlignmentFromStations(stations);
+}
+
 const std::vector<Point3d<double>>* TransmissionLine::PointsXyzLineStructures()
     const {
   // updates class if necessary
@@ -404,8 +427,7 @@ Point3d<double> TransmissionLine::PointXyzLineStructureAttachment(
   }
 
   // gets line structure
-  const LineStructure& line_structure = *std::next(line_structures_.cbegin(),
-                                                   index_structure);
+  const LineStructure& line_structure = line_structures_[index_structure];
 
   // checks if attachment index is valid
   const int kSizeAttachments = line_structure.structure()->attachments.size();
@@ -461,7 +483,9 @@ bool TransmissionLine::Validate(const bool& is_included_warnings,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "TRANSMISSION LINE";
+  if (messages != nullptr) {
+    message.title = "TRANSMISSION LINE";
+  }
 
   // validates alignment
   if (alignment_.Validate(is_included_warnings, messages) == false) {
@@ -502,11 +526,12 @@ const Alignment* TransmissionLine::alignment() const {
   return &alignment_;
 }
 
-const std::list<LineCable>* TransmissionLine::line_cables() const {
+const SlotVector<LineCable>* TransmissionLine::line_cables() const {
   return &line_cables_;
 }
 
-const std::list<LineStructure>* TransmissionLine::line_structures() const {
+const SlotVector<LineStructure>* TransmissionLine::line_structures()
+    const {
   return &line_structures_;
 }
 
@@ -516,21 +541,19 @@ Point3d<double> TransmissionLine::origin() const {
 
 void TransmissionLine::set_origin(const Point3d<double>& origin) {
   origin_ = origin;
-  is_updated_points_xyz_alignment_ = false;
-  is_updated_points_xyz_structures_ = false;
+  FlagStalePointsXyzAlignment(0);
 }
 
 void TransmissionLine::DeleteConnectionsFromStructure(
     const int& index_structure) {
-  auto iter = std::next(line_structures_.cbegin(), index_structure);
-  const LineStructure* line_structure = &(*iter);
+  const LineStructure* line_structure = &line_structures_[index_structure];
 
   // searches all line cables for reference to the structure
   for (auto iter = line_cables_.begin(); iter != line_cables_.end(); iter++) {
     LineCable& line_cable = *iter;
 
     // searches all line cable connections
-    const std::list<LineCableConnection>* connections =
+    const std::vector<LineCableConnection>* connections =
         line_cable.connections();
     auto iter_connection = connections->cbegin();
     while (iter_connection != connections->cend()) {
@@ -553,15 +576,14 @@ void TransmissionLine::DeleteConnectionsFromStructure(
 void TransmissionLine::DeleteInvalidConnectionsFromStructure(
     const int& index_structure) {
   // gets line structure and attachment count
-  auto iter_structure = std::next(line_structures_.cbegin(), index_structure);
-  const LineStructure* line_structure = &(*iter_structure);
+  const LineStructure* line_structure = &line_structures_[index_structure];
   const int kSizeAttachments = line_structure->structure()->attachments.size();
 
   // searches line cables
   for (auto iter_cable = line_cables_.begin();
        iter_cable != line_cables_.end(); iter_cable++) {
     LineCable& line_cable = *iter_cable;
-    const std::list<LineCableConnection>* connections =
+    const std::vector<LineCableConnection>* connections =
         line_cable.connections();
 
     // searches connections
@@ -610,6 +632,9 @@ void TransmissionLine::DeleteInvalidLineStructures() {
       const int index = std::distance(line_structures_.cbegin(), iter);
       DeleteConnectionsFromStructure(index);
       iter = line_structures_.erase(iter);
+      is_stale_points_xyz_structures_.erase(
+          is_stale_points_xyz_structures_.cbegin() + index);
+      points_xyz_structures_.erase(points_xyz_structures_.cbegin() + index);
     } else {
       // line structure is within the boundaries, keep searching
       iter++;
@@ -617,9 +642,40 @@ void TransmissionLine::DeleteInvalidLineStructures() {
   }
 }
 
+void TransmissionLine::FlagStalePointsXyzAlignment(const int& index) {
+  // removes the stale alignment points from the cache
+  const int kSizeCache = points_xyz_alignment_.size();
+  if (index < kSizeCache) {
+    points_xyz_alignment_.resize(index);
+  }
+
+  // determines the first line structure that may be affected
+  // an alignment point modifies the segments on both sides of it, so any
+  // structure ahead of the previous alignment point is flagged
+  const std::vector<AlignmentPoint>* points = alignment_.points();
+  const int kSizePoints = points->size();
+  int index_structure = 0;
+  if ((1 <= index) && (index - 1 < kSizePoints)) {
+    const double station = (*points)[index - 1].station;
+    auto iter = std::lower_bound(
+        line_structures_.cbegin(), line_structures_.cend(), station,
+        [](const LineStructure& line_structure, const double& station) {
+          return line_structure.station() < station;
+        });
+    index_structure = iter.position();
+  }
+
+  // flags the line structure points
+  const int kSizeStructures = line_structures_.size();
+  for (int i = index_structure; i < kSizeStructures; i++) {
+    is_stale_points_xyz_structures_[i] = true;
+    is_updated_points_xyz_structures_ = false;
+  }
+}
+
 bool TransmissionLine::IsUpdated() const {
-  return (is_updated_points_xyz_alignment_ == true)
-      || (is_updated_points_xyz_structures_ == true);
+  return (points_xyz_alignment_.size() == alignment_.points()->size())
+      && (is_updated_points_xyz_structures_ == true);
 }
 
 bool TransmissionLine::IsValidLineCableIndex(const int& index) const {
@@ -640,6 +696,12 @@ Point3d<double> TransmissionLine::PointXyzAlignmentFromStation(
     return Point3d<double>();
   }
 
+  return PointXyzAlignmentFromSegment(index_segment, station);
+}
+
+Point3d<double> TransmissionLine::PointXyzAlignmentFromSegment(
+    const int& index_segment,
+    const double& station) const {
   // gets the back and ahead xyz points
   const Point3d<double>& point_xyz_back =
       points_xyz_alignment_.at(index_segment);
@@ -648,13 +710,13 @@ Point3d<double> TransmissionLine::PointXyzAlignmentFromStation(
 
   // gets back and ahead alignment points
   const AlignmentPoint& point_align_back =
-      *std::next(alignment_.points()->cbegin(), index_segment);
+      (*alignment_.points())[index_segment];
   if (station == point_align_back.station) {
     return point_xyz_back;
   }
 
   const AlignmentPoint& point_align_ahead =
-      *std::next(alignment_.points()->cbegin(), index_segment + 1);
+      (*alignment_.points())[index_segment + 1];
   if (station == point_align_ahead.station) {
     return point_xyz_ahead;
   }
@@ -682,6 +744,26 @@ Point3d<double> TransmissionLine::PointXyzAlignmentFromStation(
                                      &vector_alignment);
 }
 
+std::vector<Point3d<double>> TransmissionLine::PointsXyzAlignmentFromStations(
+    const std::vector<double>& stations) const {
+  std::vector<Point3d<double>> points(stations.size(), Point3d<double>());
+
+  // gets segment indexes
+  const std::vector<int> indexes = alignment_.IndexesSegment(stations);
+
+  // solves points for valid segments
+  const int kSize = stations.size();
+  for (int index = 0; index < kSize; index++) {
+    const int& index_segment = indexes[index];
+    if (index_segment != -1) {
+      points[index] = PointXyzAlignmentFromSegment(index_segment,
+                                                   stations[index]);
+    }
+  }
+
+  return points;
+}
+
 Point3d<double> TransmissionLine::PointXyzAlignmentFromVector(
     const Point3d<double>& point_xyz, const double& distance_station,
     const double& distance_elevation, const double& rotation_xy,
@@ -701,9 +783,8 @@ Point3d<double> TransmissionLine::PointXyzAlignmentFromVector(
 
 bool TransmissionLine::Update() const {
   // updates the xyz points for the alignment
-  if (is_updated_points_xyz_alignment_ == false) {
-    is_updated_points_xyz_alignment_ = UpdatePointsXyzAlignment();
-    if (is_updated_points_xyz_alignment_ == false) {
+  if (points_xyz_alignment_.size() != alignment_.points()->size()) {
+    if (UpdatePointsXyzAlignment() == false) {
       return false;
     }
   }
@@ -722,57 +803,68 @@ bool TransmissionLine::Update() const {
 
 bool TransmissionLine::UpdatePointsXyzAlignment() const {
   // initializes
-  points_xyz_alignment_.clear();
-  const Point3d<double>* point_xyz_prev = nullptr;
-  const AlignmentPoint* point_align_prev = nullptr;
-  Vector2d vector(0, 0);
+  // the cache only contains the leading points that are still updated
+  const std::vector<AlignmentPoint>* points = alignment_.points();
+  const int kSize = points->size();
+  const int index_begin = points_xyz_alignment_.size();
+  points_xyz_alignment_.resize(kSize);
 
-  // iterates over all of the alignment points
-  const std::list<AlignmentPoint>* points = alignment_.points();
-  for (auto iter = points->cbegin(); iter != points->cend(); iter++) {
-    const AlignmentPoint& point_align = *iter;
+  // gets an xy vector along the segment behind the first stale point
+  Vector2d vector(1, 0);
+  if (2 <= index_begin) {
+    vector = VectorXyAlignmentSegment(index_begin - 2);
+  }
 
-    if (iter == points->cbegin()) {
+  // iterates over the stale alignment points
+  for (int index = index_begin; index < kSize; index++) {
+    if (index == 0) {
       // initializes for first point
-      points_xyz_alignment_.push_back(origin_);
-      vector.set_x(1);
-    } else {
-      // calculates station and elevation distances
-      const double distance_station = point_align.station
-                                      - point_align_prev->station;
-      const double distance_elevation = point_align.elevation
-                                        - point_align_prev->elevation;
-
-      // gets point and caches
-      Point3d<double> point = PointXyzAlignmentFromVector(
-          *point_xyz_prev,
-          distance_station,
-          distance_elevation,
-          point_align_prev->rotation,
-          &vector);
-
-      points_xyz_alignment_.push_back(point);
+      points_xyz_alignment_[index] = origin_;
+      continue;
     }
 
-    // updates previous points for next calculation
-    point_align_prev = &point_align;
-    point_xyz_prev = &points_xyz_alignment_.back();
+    const AlignmentPoint& point_align = (*points)[index];
+    const AlignmentPoint& point_align_prev = (*points)[index - 1];
+
+    // calculates station and elevation distances
+    const double distance_station = point_align.station
+                                    - point_align_prev.station;
+    const double distance_elevation = point_align.elevation
+                                      - point_align_prev.elevation;
+
+    // gets point and caches
+    points_xyz_alignment_[index] = PointXyzAlignmentFromVector(
+        points_xyz_alignment_[index - 1],
+        distance_station,
+        distance_elevation,
+        point_align_prev.rotation,
+        &vector);
   }
 
   return true;
 }
 
 bool TransmissionLine::UpdatePointsXyzLineStructures() const {
-  // initializes
-  points_xyz_structures_.clear();
+  // gets the stale line structure indexes and stations, which are sorted
+  std::vector<int> indexes;
+  std::vector<double> stations;
+  const int kSize = line_structures_.size();
+  for (int index = 0; index < kSize; index++) {
+    if (is_stale_points_xyz_structures_[index] == true) {
+      indexes.push_back(index);
+      stations.push_back(line_structures_[index].station());
+    }
+  }
 
-  // iterates over all of the line structures
-  for (auto iter = line_structures_.cbegin(); iter != line_structures_.cend();
-       iter++) {
-    const LineStructure& line_structure = *iter;
-    Point3d<double> point = PointXyzAlignmentFromStation(
-                                line_structure.station());
-    points_xyz_structures_.push_back(point);
+  // solves the stale points with a single pass over the alignment
+  const std::vector<Point3d<double>> points =
+      PointsXyzAlignmentFromStations(stations);
+
+  // caches the points
+  const int kSizeStale = indexes.size();
+  for (int index = 0; index < kSizeStale; index++) {
+    points_xyz_structures_[indexes[index]] = points[index];
+    is_stale_points_xyz_structures_[indexes[index]] = false;
   }
 
   return true;
@@ -792,11 +884,10 @@ Vector2d TransmissionLine::VectorXyAlignmentSegment(const int& index) const {
 
 Vector2d TransmissionLine::VectorXyAlignmentStructure(const int& index) const {
   // gets the line structure
-  const LineStructure& line_structure = *std::next(line_structures_.cbegin(),
-                                                   index);
+  const LineStructure& line_structure = line_structures_[index];
 
   // gets alignment data
-  const std::list<AlignmentPoint>* points = alignment_.points();
+  const std::vector<AlignmentPoint>* points = alignment_.points();
   const int index_segment = alignment_.IndexSegment(line_structure.station());
 
   // checks if line structure station matches first or last alignment point
@@ -808,18 +899,12 @@ Vector2d TransmissionLine::VectorXyAlignmentStructure(const int& index) const {
   }
 
   // determines if the line structure is on an alignment point
-  auto iter = points->cbegin();
-  while (iter != points->cend()) {
-    const AlignmentPoint& point = *iter;
-    if (line_structure.station() == point.station) {
-      break;
-    } else {
-      iter++;
-    }
-  }
-
-  // line structure is not on alignment point, returns alignment segment vector
-  if (iter == points->cend()) {
+  // a station on an alignment point returns the back segment, so only the
+  // ahead point of the segment needs to be checked
+  const AlignmentPoint& point_ahead = (*points)[index_segment + 1];
+  if (line_structure.station() != point_ahead.station) {
+    // line structure is not on alignment point, returns alignment segment
+    // vector
     return VectorXyAlignmentSegment(index_segment);
   }
 
@@ -0,0 +1,952 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/transmission_line_snapshot.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+#include "models/base/binary_file_format.h"
+#include "models/base/mapped_file.h"
+
+namespace {
+
+/// \par OVERVIEW
+///
+/// This enum contains the snapshot sections, in file order.
+enum SectionIndex {
+  kSectionStrings,
+  kSectionAlignmentPoints,
+  kSectionStructures,
+  kSectionAttachments,
+  kSectionHardwares,
+  kSectionCables,
+  kSectionCoefficients,
+  kSectionResistances,
+  kSectionWeathercases,
+  kSectionLineStructures,
+  kSectionHardwareIndexes,
+  kSectionLineCables,
+  kSectionConnections,
+  kSizeSections
+};
+
+/// \var kMagic
+///   The string that identifies a snapshot file.
+const char kMagic[8] = {'O', 'T', 'L', 'S', 'L', 'I', 'N', 'E'};
+
+/// \par OVERVIEW
+///
+/// This struct is the snapshot header.
+struct HeaderRecord {
+  binary_file::HeaderRecord common;
+  double origin[3];
+  binary_file::SectionRecord sections[kSizeSections];
+};
+
+/// \par OVERVIEW
+///
+/// This struct references an interned string in the string section.
+struct StringRecord {
+  std::uint32_t offset;
+  std::uint32_t length;
+};
+
+/// \par OVERVIEW
+///
+/// This struct references a contiguous range of records in another section.
+struct RangeRecord {
+  std::uint32_t begin;
+  std::uint32_t count;
+};
+
+struct AlignmentPointRecord {
+  double elevation;
+  double rotation;
+  double station;
+};
+
+struct AttachmentRecord {
+  double offset_longitudinal;
+  double offset_transverse;
+  double offset_vertical_top;
+};
+
+struct StructureRecord {
+  double height;
+  StringRecord name;
+  RangeRecord attachments;
+};
+
+struct HardwareRecord {
+  double area_cross_section;
+  double length;
+  double weight;
+  StringRecord name;
+  std::int32_t type;
+  std::int32_t padding;
+};
+
+struct ComponentRecord {
+  double capacity_heat;
+  double coefficient_expansion_linear_thermal;
+  double load_limit_polynomial_creep;
+  double load_limit_polynomial_loadstrain;
+  double modulus_compression_elastic_area;
+  double modulus_tension_elastic_area;
+  double scale_polynomial_x;
+  double scale_polynomial_y;
+  RangeRecord coefficients_polynomial_creep;
+  RangeRecord coefficients_polynomial_loadstrain;
+};
+
+struct ResistanceRecord {
+  double resistance;
+  double temperature;
+};
+
+struct CableRecord {
+  double absorptivity;
+  double area_physical;
+  ComponentRecord component_core;
+  ComponentRecord component_shell;
+  double diameter;
+  double emissivity;
+  StringRecord name;
+  RangeRecord resistances_ac;
+  double strength_rated;
+  double temperature_properties_components;
+  double weight_unit;
+};
+
+struct WeathercaseRecord {
+  double density_ice;
+  StringRecord description;
+  double pressure_wind;
+  double temperature_cable;
+  double thickness_ice;
+};
+
+struct LineStructureRecord {
+  double height_adjustment;
+  RangeRecord hardwares;
+  std::int32_t index_structure;
+  std::int32_t padding;
+  double offset;
+  double rotation;
+  double station;
+};
+
+struct LineCableRecord {
+  std::int32_t index_cable;
+  std::int32_t index_weathercase_constraint;
+  std::int32_t index_weathercase_stretch_creep;
+  std::int32_t index_weathercase_stretch_load;
+  std::int32_t type_condition;
+  std::int32_t type_limit;
+  RangeRecord connections;
+  double limit;
+  StringRecord note;
+  double spacing_attachments_ruling_span[3];
+};
+
+struct ConnectionRecord {
+  std::int32_t index_attachment;
+  std::int32_t index_line_structure;
+};
+
+/// \var kSizesRecord
+///   The record size of each section, in bytes.
+const std::size_t kSizesRecord[kSizeSections] = {
+  sizeof(char),
+  sizeof(AlignmentPointRecord),
+  sizeof(StructureRecord),
+  sizeof(AttachmentRecord),
+  sizeof(HardwareRecord),
+  sizeof(CableRecord),
+  sizeof(double),
+  sizeof(ResistanceRecord),
+  sizeof(WeathercaseRecord),
+  sizeof(LineStructureRecord),
+  sizeof(std::int32_t),
+  sizeof(LineCableRecord),
+  sizeof(ConnectionRecord)
+};
+
+/// \par OVERVIEW
+///
+/// This class builds the snapshot sections.
+class SnapshotWriter {
+ public:
+  /// \brief Gets an interned string record.
+  StringRecord AddString(const std::string& str) {
+    auto iter = strings_interned_.find(str);
+    if (iter != strings_interned_.end()) {
+      return iter->second;
+    }
+
+    StringRecord record;
+    record.offset = strings_.size();
+    record.length = str.size();
+    strings_.insert(strings_.end(), str.cbegin(), str.cend());
+    strings_interned_[str] = record;
+    return record;
+  }
+
+  /// \brief Gets the interned string data.
+  const std::vector<char>& strings() const {
+    return strings_;
+  }
+
+ private:
+  std::vector<char> strings_;
+  std::unordered_map<std::string, StringRecord> strings_interned_;
+};
+
+/// \brief Gets the record index of an object.
+/// \return The record index. If the object is a nullptr, -1 is returned.
+template <class T>
+std::int32_t IndexRecord(
+    const T* object,
+    std::unordered_map<const T*, std::int32_t>* indexes,
+    std::vector<const T*>* objects) {
+  if (object == nullptr) {
+    return -1;
+  }
+
+  auto iter = indexes->find(object);
+  if (iter != indexes->end()) {
+    return iter->second;
+  }
+
+  const std::int32_t index = objects->size();
+  (*indexes)[object] = index;
+  objects->push_back(object);
+  return index;
+}
+
+/// \brief Appends a range of values to a section.
+template <class T>
+RangeRecord AppendRange(const std::vector<T>& values,
+                        std::vector<T>* section) {
+  RangeRecord range;
+  range.begin = section->size();
+  range.count = values.size();
+  section->insert(section->end(), values.cbegin(), values.cend());
+  return range;
+}
+
+/// \brief Determines if a range fits within a section.
+bool IsValidRange(const RangeRecord& range, const std::uint64_t& count) {
+  return binary_file::IsValidRange(range.begin, range.count, count);
+}
+
+/// \brief Determines if a record index is valid, allowing -1 for a nullptr.
+bool IsValidIndex(const std::int32_t& index, const std::size_t& count) {
+  return (-1 <= index) && (index < static_cast<std::int64_t>(count));
+}
+
+}  // namespace
+
+const int TransmissionLineSnapshot::kVersion = 1;
+
+TransmissionLineSnapshot::TransmissionLineSnapshot() {
+}
+
+TransmissionLineSnapshot::~TransmissionLineSnapshot() {
+}
+
+bool TransmissionLineSnapshot::Deserialize(const char* data,
+                                           const std::size_t& size) {
+  Clear();
+
+  // checks header
+  if ((binary_file::IsValidHeader(data, size, kMagic, kVersion) == false)
+      || (size < sizeof(HeaderRecord))) {
+    return false;
+  }
+
+  // checks that every section is aligned and fits within the file
+  const HeaderRecord& header = *reinterpret_cast<const HeaderRecord*>(data);
+  if (binary_file::IsValidSections(header.sections, kSizesRecord,
+                                   kSizeSections, sizeof(HeaderRecord),
+                                   size) == false) {
+    return false;
+  }
+
+  // gets section records
+  const binary_file::SectionRecord* sections = header.sections;
+  const char* strings =
+      binary_file::Records<char>(data, sections[kSectionStrings]);
+  const std::uint64_t kSizeStrings = sections[kSectionStrings].count;
+
+  auto ResolveString = [strings, kSizeStrings](const StringRecord& record,
+                                               std::string* str) {
+    if ((kSizeStrings < record.offset)
+        || (kSizeStrings - record.offset < record.length)) {
+      return false;
+    }
+
+    str->assign(strings + record.offset, record.length);
+    return true;
+  };
+
+  std::uint64_t counts[kSizeSections];
+  for (int index = 0; index < kSizeSections; index++) {
+    counts[index] = sections[index].count;
+  }
+
+  const AttachmentRecord* attachments =
+      binary_file::Records<AttachmentRecord>(
+          data, sections[kSectionAttachments]);
+  const double* coefficients =
+      binary_file::Records<double>(data, sections[kSectionCoefficients]);
+  const ResistanceRecord* resistances =
+      binary_file::Records<ResistanceRecord>(
+          data, sections[kSectionResistances]);
+  const std::int32_t* indexes_hardware =
+      binary_file::Records<std::int32_t>(
+          data, sections[kSectionHardwareIndexes]);
+  const ConnectionRecord* connections =
+      binary_file::Records<ConnectionRecord>(
+          data, sections[kSectionConnections]);
+
+  // rebuilds structures
+  // the containers are reserved so the objects never move once referenced
+  const StructureRecord* records_structure =
+      binary_file::Records<StructureRecord>(data, sections[kSectionStructures]);
+  structures_.reserve(counts[kSectionStructures]);
+  for (std::uint64_t i = 0; i < counts[kSectionStructures]; i++) {
+    const StructureRecord& record = records_structure[i];
+    if (IsValidRange(record.attachments, counts[kSectionAttachments])
+        == false) {
+      Clear();
+      return false;
+    }
+
+    Structure structure;
+    structure.height = record.height;
+    if (ResolveString(record.name, &structure.name) == false) {
+      Clear();
+      return false;
+    }
+
+    structure.attachments.reserve(record.attachments.count);
+    for (std::uint32_t j = 0; j < record.attachments.count; j++) {
+      const AttachmentRecord& record_attachment =
+          attachments[record.attachments.begin + j];
+      StructureAttachment attachment;
+      attachment.offset_longitudinal = record_attachment.offset_longitudinal;
+      attachment.offset_transverse = record_attachment.offset_transverse;
+      attachment.offset_vertical_top = record_attachment.offset_vertical_top;
+      structure.attachments.push_back(attachment);
+    }
+
+    structures_.push_back(structure);
+  }
+
+  // rebuilds hardware
+  const HardwareRecord* records_hardware =
+      binary_file::Records<HardwareRecord>(data, sections[kSectionHardwares]);
+  hardwares_.reserve(counts[kSectionHardwares]);
+  for (std::uint64_t i = 0; i < counts[kSectionHardwares]; i++) {
+    const HardwareRecord& record = records_hardware[i];
+    if ((record.type < static_cast<int>(Hardware::HardwareType::kNull))
+        || (static_cast<int>(Hardware::HardwareType::kSuspension)
+            < record.type)) {
+      Clear();
+      return false;
+    }
+
+    Hardware hardware;
+    hardware.area_cross_section = record.area_cross_section;
+    hardware.length = record.length;
+    hardware.type = static_cast<Hardware::HardwareType>(record.type);
+    hardware.weight = record.weight;
+    if (ResolveString(record.name, &hardware.name) == false) {
+      Clear();
+      return false;
+    }
+
+    hardwares_.push_back(hardware);
+  }
+
+  // rebuilds cables
+  auto ResolveComponent = [&](const ComponentRecord& record,
+                              CableComponent* component) {
+    if ((IsValidRange(record.coefficients_polynomial_creep,
+                      counts[kSectionCoefficients]) == false)
+        || (IsValidRange(record.coefficients_polynomial_loadstrain,
+                         counts[kSectionCoefficients]) == false)) {
+      return false;
+    }
+
+    component->capacity_heat = record.capacity_heat;
+    component->coefficient_expansion_linear_thermal =
+        record.coefficient_expansion_linear_thermal;
+    component->coefficients_polynomial_creep.assign(
+        coefficients + record.coefficients_polynomial_creep.begin,
+        coefficients + record.coefficients_polynomial_creep.begin
+            + record.coefficients_polynomial_creep.count);
+    component->coefficients_polynomial_loadstrain.assign(
+        coefficients + record.coefficients_polynomial_loadstrain.begin,
+        coefficients + record.coefficients_polynomial_loadstrain.begin
+            + record.coefficients_polynomial_loadstrain.count);
+    component->load_limit_polynomial_creep = record.load_limit_polynomial_creep;
+    component->load_limit_polynomial_loadstrain =
+        record.load_limit_polynomial_loadstrain;
+    component->modulus_compression_elastic_area =
+        record.modulus_compression_elastic_area;
+    component->modulus_tension_elastic_area =
+        record.modulus_tension_elastic_area;
+    component->scale_polynomial_x = record.scale_polynomial_x;
+    component->scale_polynomial_y = record.scale_polynomial_y;
+    return true;
+  };
+
+  const CableRecord* records_cable =
+      binary_file::Records<CableRecord>(data, sections[kSectionCables]);
+  cables_.reserve(counts[kSectionCables]);
+  for (std::uint64_t i = 0; i < counts[kSectionCables]; i++) {
+    const CableRecord& record = records_cable[i];
+
+    Cable cable;
+    if ((IsValidRange(record.resistances_ac, counts[kSectionResistances])
+         == false)
+        || (ResolveComponent(record.component_core, &cable.component_core)
+            == false)
+        || (ResolveComponent(record.component_shell, &cable.component_shell)
+            == false)
+        || (ResolveString(record.name, &cable.name) == false)) {
+      Clear();
+      return false;
+    }
+
+    cable.absorptivity = record.absorptivity;
+    cable.area_physical = record.area_physical;
+    cable.diameter = record.diameter;
+    cable.emissivity = record.emissivity;
+    for (std::uint32_t j = 0; j < record.resistances_ac.count; j++) {
+      const ResistanceRecord& record_resistance =
+          resistances[record.resistances_ac.begin + j];
+      Cable::ResistancePoint point;
+      point.resistance = record_resistance.resistance;
+      point.temperature = record_resistance.temperature;
+      cable.resistances_ac.push_back(point);
+    }
+    cable.strength_rated = record.strength_rated;
+    cable.temperature_properties_components =
+        record.temperature_properties_components;
+    cable.weight_unit = record.weight_unit;
+
+    cables_.push_back(cable);
+  }
+
+  // rebuilds weathercases
+  const WeathercaseRecord* records_weathercase =
+      binary_file::Records<WeathercaseRecord>(
+          data, sections[kSectionWeathercases]);
+  weathercases_.reserve(counts[kSectionWeathercases]);
+  for (std::uint64_t i = 0; i < counts[kSectionWeathercases]; i++) {
+    const WeathercaseRecord& record = records_weathercase[i];
+
+    WeatherLoadCase weathercase;
+    weathercase.density_ice = record.density_ice;
+    weathercase.pressure_wind = record.pressure_wind;
+    weathercase.temperature_cable = record.temperature_cable;
+    weathercase.thickness_ice = record.thickness_ice;
+    if (ResolveString(record.description, &weathercase.description)
+        == false) {
+      Clear();
+      return false;
+    }
+
+    weathercases_.push_back(weathercase);
+  }
+
+  // rebuilds the alignment
+  line_.set_origin(Point3d<double>(header.origin[0], header.origin[1],
+                                   header.origin[2]));
+
+  const AlignmentPointRecord* records_point =
+      binary_file::Records<AlignmentPointRecord>(
+          data, sections[kSectionAlignmentPoints]);
+  for (std::uint64_t i = 0; i < counts[kSectionAlignmentPoints]; i++) {
+    const AlignmentPointRecord& record = records_point[i];
+
+    AlignmentPoint point;
+    point.elevation = record.elevation;
+    point.rotation = record.rotation;
+    point.station = record.station;
+    if (line_.AddAlignmentPoint(point) == -1) {
+      Clear();
+      return false;
+    }
+  }
+
+  // rebuilds line structures
+  // the line structure slots are stable, so the record indexes are fixed up
+  // into addresses as each line structure is added
+  const LineStructureRecord* records_line_structure =
+      binary_file::Records<LineStructureRecord>(
+          data, sections[kSectionLineStructures]);
+  std::vector<const LineStructure*> line_structures;
+  line_structures.reserve(counts[kSectionLineStructures]);
+  for (std::uint64_t i = 0; i < counts[kSectionLineStructures]; i++) {
+    const LineStructureRecord& record = records_line_structure[i];
+    if ((IsValidIndex(record.index_structure, structures_.size()) == false)
+        || (IsValidRange(record.hardwares, counts[kSectionHardwareIndexes])
+            == false)) {
+      Clear();
+      return false;
+    }
+
+    LineStructure line_structure;
+    line_structure.set_height_adjustment(record.height_adjustment);
+    line_structure.set_offset(record.offset);
+    line_structure.set_rotation(record.rotation);
+    line_structure.set_station(record.station);
+
+    const Structure* structure = nullptr;
+    if (record.index_structure != -1) {
+      structure = &structures_[record.index_structure];
+    }
+    line_structure.set_structure(structure);
+
+    // checks that the hardware matches the structure attachments
+    const std::size_t kSizeAttachments =
+        (structure == nullptr) ? 0 : structure->attachments.size();
+    if (kSizeAttachments < record.hardwares.count) {
+      Clear();
+      return false;
+    }
+
+    for (std::uint32_t j = 0; j < record.hardwares.count; j++) {
+      const std::int32_t index = indexes_hardware[record.hardwares.begin + j];
+      if (IsValidIndex(index, hardwares_.size()) == false) {
+        Clear();
+        return false;
+      }
+
+      if (index != -1) {
+        line_structure.AttachHardware(j, &hardwares_[index]);
+      }
+    }
+
+    const int index_line = line_.AddLineStructure(line_structure);
+    if (index_line == -1) {
+      Clear();
+      return false;
+    }
+
+    line_structures.push_back(&line_.line_structures()->at(index_line));
+  }
+
+  // rebuilds line cables
+  const LineCableRecord* records_line_cable =
+      binary_file::Records<LineCableRecord>(data, sections[kSectionLineCables]);
+  for (std::uint64_t i = 0; i < counts[kSectionLineCables]; i++) {
+    const LineCableRecord& record = records_line_cable[i];
+    if ((IsValidIndex(record.index_cable, cables_.size()) == false)
+        || (IsValidIndex(record.index_weathercase_constraint,
+                         weathercases_.size()) == false)
+        || (IsValidIndex(record.index_weathercase_stretch_creep,
+                         weathercases_.size()) == false)
+        || (IsValidIndex(record.index_weathercase_stretch_load,
+                         weathercases_.size()) == false)
+        || (record.type_condition
+            < static_cast<int>(CableConditionType::kNull))
+        || (static_cast<int>(CableConditionType::kLoad)
+            < record.type_condition)
+        || (record.type_limit
+            < static_cast<int>(CableConstraint::LimitType::kNull))
+        || (static_cast<int>(CableConstraint::LimitType::kSupportTension)
+            < record.type_limit)
+        || (IsValidRange(record.connections, counts[kSectionConnections])
+            == false)) {
+      Clear();
+      return false;
+    }
+
+    auto Weathercase = [this](const std::int32_t& index) {
+      return (index == -1) ? nullptr : &weathercases_[index];
+    };
+
+    CableConstraint constraint;
+    constraint.case_weather = Weathercase(record.index_weathercase_constraint);
+    constraint.condition =
+        static_cast<CableConditionType>(record.type_condition);
+    constraint.limit = record.limit;
+    constraint.type_limit =
+        static_cast<CableConstraint::LimitType>(record.type_limit);
+    if (ResolveString(record.note, &constraint.note) == false) {
+      Clear();
+      return false;
+    }
+
+    LineCable line_cable;
+    line_cable.set_cable((record.index_cable == -1)
+                         ? nullptr : &cables_[record.index_cable]);
+    line_cable.set_constraint(constraint);
+    line_cable.set_spacing_attachments_ruling_span(Vector3d(
+        record.spacing_attachments_ruling_span[0],
+        record.spacing_attachments_ruling_span[1],
+        record.spacing_attachments_ruling_span[2]));
+    line_cable.set_weathercase_stretch_creep(
+        Weathercase(record.index_weathercase_stretch_creep));
+    line_cable.set_weathercase_stretch_load(
+        Weathercase(record.index_weathercase_stretch_load));
+
+    for (std::uint32_t j = 0; j < record.connections.count; j++) {
+      const ConnectionRecord& record_connection =
+          connections[record.connections.begin + j];
+      if ((record_connection.index_line_structure < 0)
+          || (static_cast<std::int64_t>(line_structures.size())
+              <= record_connection.index_line_structure)) {
+        Clear();
+        return false;
+      }
+
+      LineCableConnection connection;
+      connection.index_attachment = record_connection.index_attachment;
+      connection.line_structure =
+          line_structures[record_connection.index_line_structure];
+      if (line_cable.AddConnection(connection) == -1) {
+        Clear();
+        return false;
+      }
+    }
+
+    if (line_.AddLineCable(line_cable) == -1) {
+      Clear();
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool TransmissionLineSnapshot::Load(const std::string& filepath) {
+  Clear();
+
+  MappedFile file;
+  if (file.Open(filepath) == false) {
+    return false;
+  }
+
+  // the objects are rebuilt from the mapped records, so the mapping is only
+  // needed while deserializing
+  return Deserialize(file.data(), file.size());
+}
+
+bool TransmissionLineSnapshot::Serialize(const TransmissionLine& line,
+                                         std::vector<char>* buffer) {
+  if (buffer == nullptr) {
+    return false;
+  }
+
+  SnapshotWriter writer;
+
+  // the referenced objects are assigned record indexes in the order they are
+  // first found
+  std::unordered_map<const Cable*, std::int32_t> indexes_cable;
+  std::unordered_map<const Hardware*, std::int32_t> indexes_hardware_object;
+  std::unordered_map<const Structure*, std::int32_t> indexes_structure;
+  std::unordered_map<const WeatherLoadCase*, std::int32_t>
+      indexes_weathercase;
+  std::vector<const Cable*> objects_cable;
+  std::vector<const Hardware*> objects_hardware;
+  std::vector<const Structure*> objects_structure;
+  std::vector<const WeatherLoadCase*> objects_weathercase;
+
+  // builds alignment records
+  std::vector<AlignmentPointRecord> records_point;
+  const std::vector<AlignmentPoint>* points = line.alignment()->points();
+  for (auto iter = points->cbegin(); iter != points->cend(); iter++) {
+    AlignmentPointRecord record;
+    record.elevation = iter->elevation;
+    record.rotation = iter->rotation;
+    record.station = iter->station;
+    records_point.push_back(record);
+  }
+
+  // builds line structure records
+  std::vector<LineStructureRecord> records_line_structure;
+  std::vector<std::int32_t> indexes_hardware;
+  const SlotVector<LineStructure>* line_structures = line.line_structures();
+  for (auto iter = line_structures->cbegin(); iter != line_structures->cend();
+       iter++) {
+    const LineStructure& line_structure = *iter;
+
+    std::vector<std::int32_t> indexes;
+    const std::vector<const Hardware*>* hardwares = line_structure.hardwares();
+    for (auto iter_hw = hardwares->cbegin(); iter_hw != hardwares->cend();
+         iter_hw++) {
+      indexes.push_back(IndexRecord(*iter_hw, &indexes_hardware_object,
+                                    &objects_hardware));
+    }
+
+    LineStructureRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.height_adjustment = line_structure.height_adjustment();
+    record.hardwares = AppendRange(indexes, &indexes_hardware);
+    record.index_structure = IndexRecord(line_structure.structure(),
+                                         &indexes_structure,
+                                         &objects_structure);
+    record.offset = line_structure.offset();
+    record.rotation = line_structure.rotation();
+    record.station = line_structure.station();
+    records_line_structure.push_back(record);
+  }
+
+  // builds line cable records
+  std::vector<LineCableRecord> records_line_cable;
+  std::vector<ConnectionRecord> records_connection;
+  const SlotVector<LineCable>* line_cables = line.line_cables();
+  for (auto iter = line_cables->cbegin(); iter != line_cables->cend();
+       iter++) {
+    const LineCable& line_cable = *iter;
+    const CableConstraint constraint = line_cable.constraint();
+    const Vector3d spacing = line_cable.spacing_attachments_ruling_span();
+
+    std::vector<ConnectionRecord> connections;
+    const std::vector<LineCableConnection>* connections_cable =
+        line_cable.connections();
+    for (auto iter_connection = connections_cable->cbegin();
+         iter_connection != connections_cable->cend(); iter_connection++) {
+      ConnectionRecord record;
+      record.index_attachment = iter_connection->index_attachment;
+      record.index_line_structure =
+          line.IndexLineStructure(iter_connection->line_structure);
+      if (record.index_line_structure == -1) {
+        return false;
+      }
+
+      connections.push_back(record);
+    }
+
+    LineCableRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.index_cable = IndexRecord(line_cable.cable(), &indexes_cable,
+                                     &objects_cable);
+    record.index_weathercase_constraint = IndexRecord(
+        constraint.case_weather, &indexes_weathercase, &objects_weathercase);
+    record.index_weathercase_stretch_creep = IndexRecord(
+        line_cable.weathercase_stretch_creep(), &indexes_weathercase,
+        &objects_weathercase);
+    record.index_weathercase_stretch_load = IndexRecord(
+        line_cable.weathercase_stretch_load(), &indexes_weathercase,
+        &objects_weathercase);
+    record.type_condition = static_cast<std::int32_t>(constraint.condition);
+    record.type_limit = static_cast<std::int32_t>(constraint.type_limit);
+    record.connections = AppendRange(connections, &records_connection);
+    record.limit = constraint.limit;
+    record.note = writer.AddString(constraint.note);
+    record.spacing_attachments_ruling_span[0] = spacing.x();
+    record.spacing_attachments_ruling_span[1] = spacing.y();
+    record.spacing_attachments_ruling_span[2] = spacing.z();
+    records_line_cable.push_back(record);
+  }
+
+  // builds structure records
+  std::vector<StructureRecord> records_structure;
+  std::vector<AttachmentRecord> records_attachment;
+  for (auto iter = objects_structure.cbegin();
+       iter != objects_structure.cend(); iter++) {
+    const Structure& structure = **iter;
+
+    std::vector<AttachmentRecord> attachments;
+    for (auto iter_attachment = structure.attachments.cbegin();
+         iter_attachment != structure.attachments.cend(); iter_attachment++) {
+      AttachmentRecord record;
+      record.offset_longitudinal = iter_attachment->offset_longitudinal;
+      record.offset_transverse = iter_attachment->offset_transverse;
+      record.offset_vertical_top = iter_attachment->offset_vertical_top;
+      attachments.push_back(record);
+    }
+
+    StructureRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.height = structure.height;
+    record.name = writer.AddString(structure.name);
+    record.attachments = AppendRange(attachments, &records_attachment);
+    records_structure.push_back(record);
+  }
+
+  // builds hardware records
+  std::vector<HardwareRecord> records_hardware;
+  for (auto iter = objects_hardware.cbegin(); iter != objects_hardware.cend();
+       iter++) {
+    const Hardware& hardware = **iter;
+
+    HardwareRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.area_cross_section = hardware.area_cross_section;
+    record.length = hardware.length;
+    record.weight = hardware.weight;
+    record.name = writer.AddString(hardware.name);
+    record.type = static_cast<std::int32_t>(hardware.type);
+    records_hardware.push_back(record);
+  }
+
+  // builds cable records
+  std::vector<CableRecord> records_cable;
+  std::vector<double> coefficients;
+  std::vector<ResistanceRecord> records_resistance;
+  auto ComponentToRecord = [&coefficients](const CableComponent& component) {
+    ComponentRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.capacity_heat = component.capacity_heat;
+    record.coefficient_expansion_linear_thermal =
+        component.coefficient_expansion_linear_thermal;
+    record.load_limit_polynomial_creep = component.load_limit_polynomial_creep;
+    record.load_limit_polynomial_loadstrain =
+        component.load_limit_polynomial_loadstrain;
+    record.modulus_compression_elastic_area =
+        component.modulus_compression_elastic_area;
+    record.modulus_tension_elastic_area =
+        component.modulus_tension_elastic_area;
+    record.scale_polynomial_x = component.scale_polynomial_x;
+    record.scale_polynomial_y = component.scale_polynomial_y;
+    record.coefficients_polynomial_creep = AppendRange(
+        component.coefficients_polynomial_creep, &coefficients);
+    record.coefficients_polynomial_loadstrain = AppendRange(
+        component.coefficients_polynomial_loadstrain, &coefficients);
+    return record;
+  };
+
+  for (auto iter = objects_cable.cbegin(); iter != objects_cable.cend();
+       iter++) {
+    const Cable& cable = **iter;
+
+    std::vector<ResistanceRecord> resistances;
+    for (auto iter_resistance = cable.resistances_ac.cbegin();
+         iter_resistance != cable.resistances_ac.cend(); iter_resistance++) {
+      ResistanceRecord record;
+      record.resistance = iter_resistance->resistance;
+      record.temperature = iter_resistance->temperature;
+      resistances.push_back(record);
+    }
+
+    CableRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.absorptivity = cable.absorptivity;
+    record.area_physical = cable.area_physical;
+    record.component_core = ComponentToRecord(cable.component_core);
+    record.component_shell = ComponentToRecord(cable.component_shell);
+    record.diameter = cable.diameter;
+    record.emissivity = cable.emissivity;
+    record.name = writer.AddString(cable.name);
+    record.resistances_ac = AppendRange(resistances, &records_resistance);
+    record.strength_rated = cable.strength_rated;
+    record.temperature_properties_components =
+        cable.temperature_properties_components;
+    record.weight_unit = cable.weight_unit;
+    records_cable.push_back(record);
+  }
+
+  // builds weathercase records
+  std::vector<WeathercaseRecord> records_weathercase;
+  for (auto iter = objects_weathercase.cbegin();
+       iter != objects_weathercase.cend(); iter++) {
+    const WeatherLoadCase& weathercase = **iter;
+
+    WeathercaseRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.density_ice = weathercase.density_ice;
+    record.description = writer.AddString(weathercase.description);
+    record.pressure_wind = weathercase.pressure_wind;
+    record.temperature_cable = weathercase.temperature_cable;
+    record.thickness_ice = weathercase.thickness_ice;
+    records_weathercase.push_back(record);
+  }
+
+  // writes the header and sections
+  HeaderRecord header;
+  std::memset(&header, 0, sizeof(header));
+  header.common = binary_file::Header(kMagic, kVersion);
+  header.origin[0] = line.origin().x;
+  header.origin[1] = line.origin().y;
+  header.origin[2] = line.origin().z;
+
+  binary_file::SectionRecord* sections = header.sections;
+  buffer->assign(sizeof(HeaderRecord), 0);
+  binary_file::AppendSection(writer.strings(),
+                             &sections[kSectionStrings], buffer);
+  binary_file::AppendSection(records_point,
+                             &sections[kSectionAlignmentPoints], buffer);
+  binary_file::AppendSection(records_structure,
+                             &sections[kSectionStructures], buffer);
+  binary_file::AppendSection(records_attachment,
+                             &sections[kSectionAttachments], buffer);
+  binary_file::AppendSection(records_hardware,
+                             &sections[kSectionHardwares], buffer);
+  binary_file::AppendSection(records_cable, &sections[kSectionCables], buffer);
+  binary_file::AppendSection(coefficients,
+                             &sections[kSectionCoefficients], buffer);
+  binary_file::AppendSection(records_resistance,
+                             &sections[kSectionResistances], buffer);
+  binary_file::AppendSection(records_weathercase,
+                             &sections[kSectionWeathercases], buffer);
+  binary_file::AppendSection(records_line_structure,
+                             &sections[kSectionLineStructures], buffer);
+  binary_file::AppendSection(indexes_hardware,
+                             &sections[kSectionHardwareIndexes], buffer);
+  binary_file::AppendSection(records_line_cable,
+                             &sections[kSectionLineCables], buffer);
+  binary_file::AppendSection(records_connection,
+                             &sections[kSectionConnections], buffer);
+
+  header.common.size_file = buffer->size();
+  std::memcpy(buffer->data(), &header, sizeof(header));
+
+  return true;
+}
+
+bool TransmissionLineSnapshot::Write(const TransmissionLine& line,
+                                     const std::string& filepath) {
+  std::vector<char> buffer;
+  if (Serialize(line, &buffer) == false) {
+    return false;
+  }
+
+  std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+  if (file.is_open() == false) {
+    return false;
+  }
+
+  file.write(buffer.data(), buffer.size());
+  return file.good();
+}
+
+const std::vector<Cable>* TransmissionLineSnapshot::cables() const {
+  return &cables_;
+}
+
+const std::vector<Hardware>* TransmissionLineSnapshot::hardwares() const {
+  return &hardwares_;
+}
+
+const std::vector<Structure>* TransmissionLineSnapshot::structures() const {
+  return &structures_;
+}
+
+const TransmissionLine* TransmissionLineSnapshot::transmission_line() const {
+  return &line_;
+}
+
+const std::vector<WeatherLoadCase>* TransmissionLineSnapshot::weathercases()
+    const {
+  return &weathercases_;
+}
+
+void TransmissionLineSnapshot::Clear() {
+  // clears the line first, because it references the other objects
+  line_ = TransmissionLine();
+  cables_.clear();
+  hardwares_.clear();
+  structures_.clear();
+  weathercases_.clear();
+}
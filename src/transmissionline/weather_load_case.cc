@@ -21,7 +21,9 @@ bool WeatherLoadCase::Validate(const bool& /*is_included_warnings*/,
   // initializes
   bool is_valid = true;
   ErrorMessage message;
-  message.title = "WEATHER LOAD CASE";
+  if (messages != nullptr) {
+    message.title = "WEATHER LOAD CASE";
+  }
 
   // validates density-ice
   if (density_ice < 0) {
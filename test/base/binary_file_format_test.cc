@@ -0,0 +1,121 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/base/binary_file_format.h"
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+/// \var kMagic
+///   The test file type.
+const char kMagic[8] = {'T', 'E', 'S', 'T', 'F', 'I', 'L', 'E'};
+
+/// \par OVERVIEW
+///
+/// This struct is the test file header.
+struct HeaderRecord {
+  binary_file::HeaderRecord common;
+  binary_file::SectionRecord sections[2];
+};
+
+/// \brief Builds a test file with a double section and a char section.
+std::vector<char> Buffer() {
+  HeaderRecord header;
+  std::memset(&header, 0, sizeof(header));
+  header.common = binary_file::Header(kMagic, 3);
+
+  std::vector<char> buffer(sizeof(HeaderRecord), 0);
+  binary_file::AppendSection(std::vector<char>{'a', 'b', 'c'},
+                             &header.sections[0], &buffer);
+  binary_file::AppendSection(std::vector<double>{1.5, 2.5},
+                             &header.sections[1], &buffer);
+
+  header.common.size_file = buffer.size();
+  std::memcpy(buffer.data(), &header, sizeof(header));
+  return buffer;
+}
+
+}  // namespace
+
+TEST(BinaryFileFormat, AppendSection) {
+  const std::vector<char> buffer = Buffer();
+  const HeaderRecord& header =
+      *reinterpret_cast<const HeaderRecord*>(buffer.data());
+
+  // the double section is padded to an aligned offset
+  EXPECT_EQ(sizeof(HeaderRecord), header.sections[0].offset);
+  EXPECT_EQ(3u, header.sections[0].count);
+  EXPECT_EQ(sizeof(HeaderRecord) + 8, header.sections[1].offset);
+  EXPECT_EQ(2u, header.sections[1].count);
+
+  const double* values =
+      binary_file::Records<double>(buffer.data(), header.sections[1]);
+  EXPECT_EQ(1.5, values[0]);
+  EXPECT_EQ(2.5, values[1]);
+}
+
+TEST(BinaryFileFormat, Hasher) {
+  // matches the published FNV-1a test vectors
+  binary_file::Hasher hasher;
+  EXPECT_EQ(14695981039346656037ULL, hasher.hash());
+
+  hasher.AddBytes("a", 1);
+  EXPECT_EQ(0xaf63dc4c8601ec8cULL, hasher.hash());
+
+  // negative zero is hashed as zero
+  binary_file::Hasher hasher_positive;
+  hasher_positive.AddDouble(0.0);
+  binary_file::Hasher hasher_negative;
+  hasher_negative.AddDouble(-0.0);
+  EXPECT_EQ(hasher_positive.hash(), hasher_negative.hash());
+}
+
+TEST(BinaryFileFormat, IsValidHeader) {
+  std::vector<char> buffer = Buffer();
+  EXPECT_TRUE(binary_file::IsValidHeader(buffer.data(), buffer.size(),
+                                         kMagic, 3));
+
+  // checks the version and file size
+  EXPECT_FALSE(binary_file::IsValidHeader(buffer.data(), buffer.size(),
+                                          kMagic, 4));
+  EXPECT_FALSE(binary_file::IsValidHeader(buffer.data(), buffer.size() - 8,
+                                          kMagic, 3));
+
+  // checks the byte order
+  HeaderRecord& header = *reinterpret_cast<HeaderRecord*>(buffer.data());
+  header.common.marker_byte_order = 0x04030201;
+  EXPECT_FALSE(binary_file::IsValidHeader(buffer.data(), buffer.size(),
+                                          kMagic, 3));
+}
+
+TEST(BinaryFileFormat, IsValidRange) {
+  EXPECT_TRUE(binary_file::IsValidRange(0, 3, 3));
+  EXPECT_TRUE(binary_file::IsValidRange(3, 0, 3));
+  EXPECT_FALSE(binary_file::IsValidRange(2, 2, 3));
+  EXPECT_FALSE(binary_file::IsValidRange(4, 0, 3));
+}
+
+TEST(BinaryFileFormat, IsValidSections) {
+  std::vector<char> buffer = Buffer();
+  HeaderRecord& header = *reinterpret_cast<HeaderRecord*>(buffer.data());
+  const std::size_t kSizesRecord[2] = {sizeof(char), sizeof(double)};
+  EXPECT_TRUE(binary_file::IsValidSections(header.sections, kSizesRecord, 2,
+                                           sizeof(HeaderRecord),
+                                           buffer.size()));
+
+  // checks a section that extends past the file
+  header.sections[1].count = 3;
+  EXPECT_FALSE(binary_file::IsValidSections(header.sections, kSizesRecord, 2,
+                                            sizeof(HeaderRecord),
+                                            buffer.size()));
+
+  // checks a section that is not aligned
+  header.sections[1].count = 2;
+  header.sections[1].offset += 4;
+  EXPECT_FALSE(binary_file::IsValidSections(header.sections, kSizesRecord, 2,
+                                            sizeof(HeaderRecord),
+                                            buffer.size()));
+}
@@ -0,0 +1,95 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/base/bounding_volume_hierarchy.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+
+class BoundingVolumeHierarchyTest : public ::testing::Test {
+ protected:
+  BoundingVolumeHierarchyTest() {
+    // builds a row of unit boxes along the x axis
+    for (int index = 0; index < 20; index++) {
+      BoundingBox3d box;
+      box.Expand(Point3d<double>(index * 10, 0, 0));
+      box.Expand(Point3d<double>(index * 10 + 1, 1, 1));
+      boxes_a_.push_back(box);
+    }
+
+    // builds a row of unit boxes along the y axis, raised above the first row
+    for (int index = 0; index < 15; index++) {
+      BoundingBox3d box;
+      box.Expand(Point3d<double>(95, index * 10 - 70, 20));
+      box.Expand(Point3d<double>(96, index * 10 - 69, 21));
+      boxes_b_.push_back(box);
+    }
+
+    a_.Build(boxes_a_);
+    b_.Build(boxes_b_);
+  }
+
+  // test data
+  std::vector<BoundingBox3d> boxes_a_;
+  std::vector<BoundingBox3d> boxes_b_;
+
+  // test objects
+  BoundingVolumeHierarchy a_;
+  BoundingVolumeHierarchy b_;
+};
+
+TEST_F(BoundingVolumeHierarchyTest, BoxDistance) {
+  // overlapping
+  EXPECT_EQ(0, boxes_a_[0].Distance(boxes_a_[0]));
+
+  // separated along one axis
+  EXPECT_EQ(9, boxes_a_[0].Distance(boxes_a_[1]));
+
+  // separated along two axes
+  EXPECT_EQ(95.90, helper::Round(boxes_a_[0].Distance(boxes_b_[7]), 2));
+
+  // separated along three axes
+  EXPECT_EQ(118.14, helper::Round(boxes_a_[0].Distance(boxes_b_[0]), 2));
+}
+
+TEST_F(BoundingVolumeHierarchyTest, Build) {
+  EXPECT_EQ(20, a_.size());
+  EXPECT_EQ(15, b_.size());
+
+  a_.Clear();
+  EXPECT_EQ(0, a_.size());
+}
+
+TEST_F(BoundingVolumeHierarchyTest, DistanceMinimum) {
+  // uses the box distance as the item distance, and counts the calls
+  int count = 0;
+  auto distance_items = [this, &count](const int& index_a,
+                                       const int& index_b) {
+    count++;
+    return boxes_a_[index_a].Distance(boxes_b_[index_b]);
+  };
+
+  // compares to a brute force search
+  double distance_brute = 999999;
+  for (auto iter_a = boxes_a_.cbegin(); iter_a != boxes_a_.cend(); iter_a++) {
+    for (auto iter_b = boxes_b_.cbegin(); iter_b != boxes_b_.cend();
+         iter_b++) {
+      distance_brute = std::min(distance_brute, iter_a->Distance(*iter_b));
+    }
+  }
+
+  const double distance =
+      BoundingVolumeHierarchy::DistanceMinimum(a_, b_, distance_items);
+  EXPECT_EQ(19.42, helper::Round(distance, 2));
+  EXPECT_EQ(distance_brute, distance);
+  EXPECT_GT(20 * 15, count);
+
+  // empty hierarchy
+  a_.Clear();
+  EXPECT_EQ(-999999,
+            BoundingVolumeHierarchy::DistanceMinimum(a_, b_, distance_items));
+}
@@ -0,0 +1,57 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/base/dual.h"
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+
+TEST(DualTest, Arithmetic) {
+  const Dual<double> x(3, 1);
+  Dual<double> y;
+
+  y = x + 2;
+  EXPECT_EQ(5, y.value);
+  EXPECT_EQ(1, y.derivative);
+
+  y = 2 - x;
+  EXPECT_EQ(-1, y.value);
+  EXPECT_EQ(-1, y.derivative);
+
+  y = x * x;
+  EXPECT_EQ(9, y.value);
+  EXPECT_EQ(6, y.derivative);
+
+  y = 1 / x;
+  EXPECT_EQ(0.3333, helper::Round(y.value, 4));
+  EXPECT_EQ(-0.1111, helper::Round(y.derivative, 4));
+
+  EXPECT_TRUE(x < 4);
+  EXPECT_TRUE(x == Dual<double>(3, 0));
+}
+
+TEST(DualTest, Functions) {
+  const Dual<double> x(0.5, 1);
+  Dual<double> y;
+
+  y = asinh(x);
+  EXPECT_EQ(0.4812, helper::Round(y.value, 4));
+  EXPECT_EQ(0.8944, helper::Round(y.derivative, 4));
+
+  y = cosh(x);
+  EXPECT_EQ(1.1276, helper::Round(y.value, 4));
+  EXPECT_EQ(0.5211, helper::Round(y.derivative, 4));
+
+  y = pow(x, 3);
+  EXPECT_EQ(0.125, helper::Round(y.value, 4));
+  EXPECT_EQ(0.75, helper::Round(y.derivative, 4));
+
+  y = sinh(x);
+  EXPECT_EQ(0.5211, helper::Round(y.value, 4));
+  EXPECT_EQ(1.1276, helper::Round(y.derivative, 4));
+
+  y = sqrt(x);
+  EXPECT_EQ(0.7071, helper::Round(y.value, 4));
+  EXPECT_EQ(0.7071, helper::Round(y.derivative, 4));
+}
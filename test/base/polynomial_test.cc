@@ -73,3 +73,9 @@ TEST_F(PolynomialTest, Y) {
   EXPECT_EQ(0, helper::Round(p_.Y(0), 0));
   EXPECT_EQ(990, helper::Round(p_.Y(1), 0));
 }
+
+TEST_F(PolynomialTest, YDual) {
+  const Dual<double> y = p_.Y(Dual<double>(1, 1));
+  EXPECT_EQ(p_.Y(1), y.value);
+  EXPECT_EQ(p_.Slope(1), y.derivative);
+}
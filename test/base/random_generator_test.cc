@@ -0,0 +1,116 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/base/random_generator.h"
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+
+TEST(CounterRandomGenerator, Next) {
+  // checks that the values are reproducible
+  CounterRandomGenerator a(42, 7);
+  CounterRandomGenerator b(42, 7);
+  for (int index = 0; index < 10; index++) {
+    EXPECT_EQ(a.Next(), b.Next());
+  }
+  EXPECT_EQ(10u, a.counter());
+
+  // checks that the counter can be rewound
+  const uint64_t value = a.Next();
+  a.set_counter(10);
+  EXPECT_EQ(value, a.Next());
+
+  // checks that adjacent streams and seeds are different
+  CounterRandomGenerator c(42, 8);
+  CounterRandomGenerator d(43, 7);
+  b.set_counter(0);
+  const uint64_t value_b = b.Next();
+  EXPECT_NE(value_b, c.Next());
+  EXPECT_NE(value_b, d.Next());
+}
+
+TEST(CounterRandomGenerator, Normal) {
+  CounterRandomGenerator generator(1, 0);
+
+  const int kSize = 100000;
+  double sum = 0;
+  double sum_squares = 0;
+  for (int index = 0; index < kSize; index++) {
+    const double value = generator.Normal();
+    sum += value;
+    sum_squares += value * value;
+  }
+  EXPECT_EQ(static_cast<uint64_t>(2 * kSize), generator.counter());
+
+  const double mean = sum / kSize;
+  const double deviation = std::sqrt(sum_squares / kSize - mean * mean);
+  EXPECT_EQ(0.0, helper::Round(mean, 2));
+  EXPECT_EQ(1.0, helper::Round(deviation, 2));
+}
+
+TEST(CounterRandomGenerator, Uniform) {
+  CounterRandomGenerator generator(1, 0);
+
+  const int kSize = 100000;
+  double sum = 0;
+  double min = 1;
+  double max = 0;
+  for (int index = 0; index < kSize; index++) {
+    const double value = generator.Uniform();
+    sum += value;
+    min = std::fmin(min, value);
+    max = std::fmax(max, value);
+  }
+
+  EXPECT_EQ(0.50, helper::Round(sum / kSize, 2));
+  EXPECT_LT(0, min);
+  EXPECT_GT(1, max);
+}
+
+TEST(RandomDistribution, Sample) {
+  CounterRandomGenerator generator(1, 0);
+  RandomDistribution distribution;
+
+  // normal, clamped to the bounds
+  distribution.type = RandomDistribution::DistributionType::kNormal;
+  distribution.mean = 0;
+  distribution.deviation = 10;
+  distribution.lower = -1;
+  distribution.upper = 1;
+  for (int index = 0; index < 100; index++) {
+    const double value = distribution.Sample(&generator);
+    EXPECT_LE(-1, value);
+    EXPECT_GE(1, value);
+  }
+
+  // uniform
+  distribution.type = RandomDistribution::DistributionType::kUniform;
+  distribution.lower = 10;
+  distribution.upper = 20;
+  for (int index = 0; index < 100; index++) {
+    const double value = distribution.Sample(&generator);
+    EXPECT_LT(10, value);
+    EXPECT_GT(20, value);
+  }
+}
+
+TEST(RandomDistribution, Validate) {
+  RandomDistribution distribution;
+  EXPECT_FALSE(distribution.Validate(false, nullptr));
+
+  distribution.type = RandomDistribution::DistributionType::kNormal;
+  distribution.mean = 60;
+  distribution.deviation = 10;
+  EXPECT_TRUE(distribution.Validate(false, nullptr));
+
+  // uniform requires finite bounds
+  distribution.type = RandomDistribution::DistributionType::kUniform;
+  EXPECT_FALSE(distribution.Validate(false, nullptr));
+
+  distribution.lower = 0;
+  distribution.upper = 100;
+  EXPECT_TRUE(distribution.Validate(false, nullptr));
+}
@@ -0,0 +1,88 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/base/slot_vector.h"
+
+#include "gtest/gtest.h"
+
+class SlotVectorTest : public ::testing::Test {
+ protected:
+  SlotVectorTest() {
+    // builds fixture object
+    for (int i = 0; i < 5; i++) {
+      s_.push_back(i * 10);
+    }
+  }
+
+  // test object
+  SlotVector<int> s_;
+};
+
+TEST_F(SlotVectorTest, Erase) {
+  const int* value = &s_[3];
+
+  // erases and checks order and addresses
+  auto iter = s_.erase(s_.cbegin() + 1);
+  EXPECT_EQ(4, static_cast<int>(s_.size()));
+  EXPECT_EQ(20, *iter);
+  EXPECT_EQ(value, &s_[2]);
+  EXPECT_EQ(2, s_.IndexOf(value));
+
+  // resets and reuses the erased slot
+  const int* value_erased = &s_[0];
+  SlotHandle handle = s_.Handle(0);
+  s_.erase(s_.cbegin());
+  EXPECT_EQ(0, *value_erased);
+  EXPECT_EQ(-1, s_.IndexOf(value_erased));
+  EXPECT_EQ(-1, s_.IndexOf(handle));
+
+  // the address resolves to the new element, but the handle does not
+  s_.insert(s_.cbegin(), 5);
+  EXPECT_EQ(5, s_.front());
+  EXPECT_EQ(value_erased, &s_.front());
+  EXPECT_EQ(0, s_.IndexOf(value_erased));
+  EXPECT_EQ(-1, s_.IndexOf(handle));
+  EXPECT_EQ(0, s_.IndexOf(s_.Handle(0)));
+}
+
+TEST_F(SlotVectorTest, IndexOf) {
+  // checks addresses
+  for (int index = 0; index < 5; index++) {
+    EXPECT_EQ(index, s_.IndexOf(&s_[index]));
+  }
+
+  int value = 0;
+  EXPECT_EQ(-1, s_.IndexOf(&value));
+
+  // checks a copy, which has new addresses
+  SlotVector<int> s_copy = s_;
+  EXPECT_EQ(-1, s_copy.IndexOf(&s_[1]));
+  EXPECT_EQ(1, s_copy.IndexOf(&s_copy[1]));
+
+  // checks handles, which are valid in a copy
+  SlotHandle handle = s_.Handle(4);
+  EXPECT_EQ(4, s_.IndexOf(handle));
+  EXPECT_EQ(4, s_copy.IndexOf(handle));
+  EXPECT_EQ(-1, s_.IndexOf(s_.Handle(5)));
+}
+
+TEST_F(SlotVectorTest, Insert) {
+  const int* value = &s_[2];
+
+  // inserts many elements at the front and checks the address is stable
+  for (int i = 0; i < 1000; i++) {
+    auto iter = s_.insert(s_.cbegin(), -i);
+    EXPECT_EQ(0, iter.position());
+  }
+
+  EXPECT_EQ(1005, static_cast<int>(s_.size()));
+  EXPECT_EQ(value, &s_[1002]);
+  EXPECT_EQ(20, *value);
+  EXPECT_EQ(1002, s_.IndexOf(value));
+
+  // checks iteration order
+  EXPECT_EQ(-999, s_.front());
+  EXPECT_EQ(40, s_.back());
+  EXPECT_EQ(1005, std::distance(s_.cbegin(), s_.cend()));
+  EXPECT_EQ(10, *std::next(s_.cbegin(), 1001));
+}
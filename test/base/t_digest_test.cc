@@ -0,0 +1,82 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/base/t_digest.h"
+
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+#include "models/base/random_generator.h"
+
+class TDigestTest : public ::testing::Test {
+ protected:
+  TDigestTest() {
+    // adds the values 1 to 10000 in a shuffled order
+    // the values are split between two digests
+    CounterRandomGenerator generator(1, 0);
+    std::vector<double> values(10000);
+    for (int index = 0; index < 10000; index++) {
+      values[index] = index + 1;
+    }
+    for (int index = 9999; 0 < index; index--) {
+      const int index_swap = generator.Next() % (index + 1);
+      std::swap(values[index], values[index_swap]);
+    }
+
+    for (int index = 0; index < 10000; index++) {
+      if (index < 6000) {
+        d_.Add(values[index]);
+      } else {
+        d_other_.Add(values[index]);
+      }
+    }
+  }
+
+  // test objects
+  TDigest d_;
+  TDigest d_other_;
+};
+
+TEST_F(TDigestTest, Clear) {
+  d_.Clear();
+  EXPECT_EQ(0, d_.count());
+  EXPECT_EQ(-999999, d_.Mean());
+  EXPECT_EQ(-999999, d_.Quantile(0.5));
+}
+
+TEST_F(TDigestTest, Merge) {
+  d_.Merge(d_other_);
+  EXPECT_EQ(10000, d_.count());
+  EXPECT_EQ(1, d_.min());
+  EXPECT_EQ(10000, d_.max());
+  EXPECT_EQ(5000.5, d_.Mean());
+
+  // checks quantiles within 0.5 percent of the range
+  EXPECT_NEAR(1000, d_.Quantile(0.1), 50);
+  EXPECT_NEAR(5000, d_.Quantile(0.5), 50);
+  EXPECT_NEAR(9500, d_.Quantile(0.95), 50);
+
+  // tail quantiles are more accurate
+  EXPECT_NEAR(9900, d_.Quantile(0.99), 5);
+  EXPECT_NEAR(9990, d_.Quantile(0.999), 2);
+}
+
+TEST_F(TDigestTest, Quantile) {
+  EXPECT_EQ(6000, d_.count());
+
+  // the first digest is a random subset of the values
+  EXPECT_NEAR(5000, d_.Quantile(0.5), 200);
+
+  // checks end points
+  EXPECT_EQ(d_.min(), d_.Quantile(0));
+  EXPECT_EQ(d_.max(), d_.Quantile(1));
+
+  // a single value
+  TDigest digest;
+  digest.Add(5);
+  EXPECT_EQ(5, digest.Quantile(0.25));
+  EXPECT_EQ(5, digest.Quantile(0.75));
+}
@@ -0,0 +1,72 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/base/thread_pool.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+TEST(ThreadPool, ParallelFor) {
+  ThreadPool pool(4);
+  EXPECT_EQ(4, pool.num_threads());
+
+  // executes every task exactly once
+  std::vector<int> counts(1000, 0);
+  pool.ParallelFor(1000, [&counts](const int& index) {
+    counts[index] += index;
+  });
+
+  for (int index = 0; index < 1000; index++) {
+    EXPECT_EQ(index, counts[index]);
+  }
+
+  // reuses the pool with uneven task durations and fewer tasks than threads
+  std::atomic<int> sum(0);
+  pool.ParallelFor(3, [&sum](const int& index) {
+    int value = 0;
+    for (int i = 0; i < (index + 1) * 100000; i++) {
+      value = (value + i) % 7;
+    }
+    sum += index + 1 + (value * 0);
+  });
+  EXPECT_EQ(6, sum);
+
+  // executes serially with a single thread
+  ThreadPool pool_serial(1);
+  EXPECT_EQ(1, pool_serial.num_threads());
+
+  std::vector<int> order;
+  pool_serial.ParallelFor(5, [&order](const int& index) {
+    order.push_back(index);
+  });
+
+  EXPECT_EQ(5, static_cast<int>(order.size()));
+  for (int index = 0; index < 5; index++) {
+    EXPECT_EQ(index, order[index]);
+  }
+}
+
+TEST(ThreadPool, Run) {
+  // executes serially without a pool
+  std::vector<int> order;
+  ThreadPool::Run(nullptr, 5, [&order](const int& index) {
+    order.push_back(index);
+  });
+
+  EXPECT_EQ(5, static_cast<int>(order.size()));
+  for (int index = 0; index < 5; index++) {
+    EXPECT_EQ(index, order[index]);
+  }
+
+  // executes every task exactly once with a pool
+  ThreadPool pool(4);
+  std::vector<int> counts(1000, 0);
+  ThreadPool::Run(&pool, 1000, [&counts](const int& index) {
+    counts[index] += index;
+  });
+
+  for (int index = 0; index < 1000; index++) {
+    EXPECT_EQ(index, counts[index]);
+  }
+}
@@ -9,6 +9,32 @@
 
 // The starting value should be a primary base unit (feet/meters, etc). If
 // converting between unit systems, the test should start with metric.
+TEST(Units, Convert) {
+  // checks that the factors are compile-time constants
+  static_assert(units::Factor<units::Feet, units::Inches>() == 12.0,
+                "Factor is not a constant expression");
+
+  // checks against the enum-based conversions
+  EXPECT_EQ(units::ConvertAngle(30,
+                                units::AngleConversionType::kDegreesToRadians),
+            (units::Convert<units::Degrees, units::Radians>(30)));
+  EXPECT_EQ(units::ConvertAngle(0.5,
+                                units::AngleConversionType::kRadiansToDegrees),
+            (units::Convert<units::Radians, units::Degrees>(0.5)));
+
+  // checks other dimensions
+  EXPECT_EQ(22.5, helper::Round(
+      units::Convert<units::Newtons, units::Pounds>(100), 1));
+  EXPECT_EQ(0.000379, helper::Round(
+      units::Convert<units::Feet, units::Miles>(2), 6));
+  EXPECT_EQ(3.281, helper::Round(
+      units::Convert<units::Meters, units::Feet>(1), 3));
+  EXPECT_EQ(2.089, helper::Round(
+      units::Convert<units::Pascals, units::Psf>(100), 3));
+  EXPECT_EQ(144, helper::Round(
+      units::Convert<units::Psi, units::Psf>(1), 6));
+}
+
 TEST(Units, ConvertAngle) {
   double value1 = 0;
   double value2 = 0;
@@ -193,3 +219,13 @@ TEST(Units, ConvertTemperature) {
       units::TemperatureConversionType::kFahrenheitToCelsius);
   EXPECT_EQ(20.00, helper::Round(value1, 2));
 }
+
+TEST(Units, Quantity) {
+  constexpr units::Quantity<units::Degrees> angle(180);
+  constexpr units::Quantity<units::Radians> angle_radians = angle;
+  EXPECT_EQ(units::kPi, angle_radians.value());
+
+  const units::Quantity<units::Millimeters> length(25.4);
+  const units::Quantity<units::Inches> length_inches = length;
+  EXPECT_EQ(1, helper::Round(length_inches.value(), 12));
+}
@@ -3,6 +3,8 @@
 
 #include "models/base/vector.h"
 
+#include <cmath>
+
 #include "gtest/gtest.h"
 
 #include "models/base/helper.h"
@@ -79,6 +81,22 @@ TEST(Vector2d, Rotate) {
   EXPECT_EQ(1, helper::Round(v.Magnitude(), 0));
 }
 
+TEST(Vector2d, RotateSinCos) {
+  Vector2d v(1, 0);
+
+  // positive rotation of 135 degrees
+  v.RotateSinCos(std::sqrt(0.5), -std::sqrt(0.5));
+  EXPECT_EQ(135, helper::Round(v.Angle(false), 0));
+
+  // matches the angle-based rotation
+  Vector2d v_angle(3, 4);
+  Vector2d v_sincos(3, 4);
+  v_angle.Rotate(-30);
+  v_sincos.RotateSinCos(-0.5, std::sqrt(0.75));
+  EXPECT_EQ(helper::Round(v_angle.x(), 12), helper::Round(v_sincos.x(), 12));
+  EXPECT_EQ(helper::Round(v_angle.y(), 12), helper::Round(v_sincos.y(), 12));
+}
+
 TEST(Vector2d, Scale) {
   Vector2d v(1, 0);
 
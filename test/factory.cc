@@ -415,7 +415,7 @@ TransmissionLine* BuildTransmissionLine() {
   // adds line cables
   LineCable line_cable;
   LineCableConnection connection;
-  const std::list<LineStructure>* line_structures = line->line_structures();
+  const SlotVector<LineStructure>* line_structures = line->line_structures();
 
   line_cable = *factory::BuildLineCable();
   line_cable.ClearConnections();
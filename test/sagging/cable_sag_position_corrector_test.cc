@@ -91,31 +91,40 @@ TEST_F(CableSagPositionCorrectorTest, CatenariesPulleyed) {
   const std::vector<Catenary3d>* catenaries = c_.CatenariesPulleyed();
 
   value = (*catenaries)[0].tension_horizontal();
-  EXPECT_EQ(5730.5, helper::Round(value, 1));
+  EXPECT_EQ(5730.4, helper::Round(value, 1));
 
   value = (*catenaries)[1].tension_horizontal();
-  EXPECT_EQ(5800.4, helper::Round(value, 1));
+  EXPECT_EQ(5800.3, helper::Round(value, 1));
 
   value = (*catenaries)[2].tension_horizontal();
-  EXPECT_EQ(5900.9, helper::Round(value, 1));
+  EXPECT_EQ(5900.8, helper::Round(value, 1));
 
   value = (*catenaries)[3].tension_horizontal();
-  EXPECT_EQ(6073.2, helper::Round(value, 1));
+  EXPECT_EQ(6073.1, helper::Round(value, 1));
 
   value = (*catenaries)[4].tension_horizontal();
-  EXPECT_EQ(6069.6, helper::Round(value, 1));
+  EXPECT_EQ(6069.5, helper::Round(value, 1));
 
   value = (*catenaries)[5].tension_horizontal();
-  EXPECT_EQ(6073.2, helper::Round(value, 1));
+  EXPECT_EQ(6073.1, helper::Round(value, 1));
 
   value = (*catenaries)[6].tension_horizontal();
-  EXPECT_EQ(5900.9, helper::Round(value, 1));
+  EXPECT_EQ(5900.8, helper::Round(value, 1));
 
   value = (*catenaries)[7].tension_horizontal();
-  EXPECT_EQ(5800.4, helper::Round(value, 1));
+  EXPECT_EQ(5800.3, helper::Round(value, 1));
 
   value = (*catenaries)[8].tension_horizontal();
-  EXPECT_EQ(5730.5, helper::Round(value, 1));
+  EXPECT_EQ(5730.4, helper::Round(value, 1));
+
+  // checks that support tensions are equal at every pulley
+  for (auto iter = catenaries->cbegin(); iter != catenaries->cend() - 1;
+       iter++) {
+    const Catenary3d& catenary_back = *iter;
+    const Catenary3d& catenary_ahead = *(iter + 1);
+    value = catenary_back.Tension(1) - catenary_ahead.Tension(0);
+    EXPECT_EQ(0, helper::Round(value, 3));
+  }
 }
 
 TEST_F(CableSagPositionCorrectorTest, ClippingOffsets) {
@@ -162,7 +171,7 @@ TEST_F(CableSagPositionCorrectorTest, SagCorrections) {
   std::vector<double> corrections = c_.SagCorrections();
 
   value = corrections[0];
-  EXPECT_EQ(1.5, helper::Round(value, 1));
+  EXPECT_EQ(1.6, helper::Round(value, 1));
 
   value = corrections[1];
   EXPECT_EQ(0.8, helper::Round(value, 1));
@@ -186,7 +195,7 @@ TEST_F(CableSagPositionCorrectorTest, SagCorrections) {
   EXPECT_EQ(0.8, helper::Round(value, 1));
 
   value = corrections[8];
-  EXPECT_EQ(1.5, helper::Round(value, 1));
+  EXPECT_EQ(1.6, helper::Round(value, 1));
 }
 
 TEST_F(CableSagPositionCorrectorTest, Validate) {
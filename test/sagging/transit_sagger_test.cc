@@ -3,6 +3,10 @@
 
 #include "models/sagging/transit_sagger.h"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "models/base/helper.h"
@@ -149,6 +153,73 @@ TEST_F(TransitSaggerTest, PointTarget) {
   EXPECT_EQ(-999999.00, helper::Round(point.z, 2));
 }
 
+TEST_F(TransitSaggerTest, PointCatenaryLowSearch) {
+  // builds a catenary with transverse load
+  Catenary3d catenary = t_.catenary();
+  catenary.set_weight_unit(Vector3d(0, 0.5, 1));
+  t_.set_catenary(catenary);
+
+  // checks transit positions against a fine search of catenary points
+  const std::vector<Point3d<double>> points_transit = {
+      Point3d<double>(0, 0, -50),
+      Point3d<double>(600, 0, -80),
+      Point3d<double>(1000, 50, -100),
+      Point3d<double>(2500, -100, -20)};
+  for (auto iter = points_transit.cbegin(); iter != points_transit.cend();
+       iter++) {
+    const Point3d<double>& point_transit = *iter;
+    t_.set_point_transit(point_transit);
+
+    double angle_search = 999999;
+    for (int i = 1; i < 10000; i++) {
+      const Point3d<double> point = catenary.Coordinate(i / 10000.0);
+      Vector2d vector;
+      vector.set_x(std::hypot(point.x - point_transit.x,
+                              point.y - point_transit.y));
+      vector.set_y(point.z - point_transit.z);
+      angle_search = std::min(angle_search, vector.Angle(true));
+    }
+
+    EXPECT_LE(t_.AngleLow(), angle_search);
+    EXPECT_EQ(helper::Round(angle_search, 4),
+              helper::Round(t_.AngleLow(), 4));
+  }
+}
+
+TEST_F(TransitSaggerTest, SolveSetups) {
+  // builds a section of two spans
+  std::vector<Catenary3d> catenaries;
+  catenaries.push_back(t_.catenary());
+  Catenary3d catenary = t_.catenary();
+  catenary.set_spacing_endpoints(Vector3d(1200, 0, -40));
+  catenaries.push_back(catenary);
+
+  std::vector<Point3d<double>> points_transit = {
+      Point3d<double>(0, 0, -50),
+      Point3d<double>(1200, 0, -100)};
+
+  // checks set-ups against individually solved spans
+  std::vector<TransitSetup> setups;
+  EXPECT_TRUE(TransitSagger::SolveSetups(catenaries, points_transit,
+                                         &setups));
+  EXPECT_EQ(2, static_cast<int>(setups.size()));
+  EXPECT_EQ(-0.520, helper::Round(setups[0].angle_low, 3));
+  EXPECT_EQ(-68.16, helper::Round(setups[0].point_target.z, 2));
+
+  t_.set_catenary(catenaries[1]);
+  t_.set_point_transit(points_transit[1]);
+  EXPECT_EQ(t_.AngleLow(), setups[1].angle_low);
+  EXPECT_EQ(t_.FactorControl(), setups[1].factor_control);
+  EXPECT_EQ(t_.PointTarget().z, setups[1].point_target.z);
+
+  // checks a span that does not solve
+  points_transit[1] = Point3d<double>(600, 0, 50);
+  EXPECT_FALSE(TransitSagger::SolveSetups(catenaries, points_transit,
+                                          &setups));
+  EXPECT_EQ(-0.520, helper::Round(setups[0].angle_low, 3));
+  EXPECT_EQ(-999999, setups[1].angle_low);
+}
+
 TEST_F(TransitSaggerTest, Validate) {
   EXPECT_TRUE(t_.Validate(true, nullptr));
 }
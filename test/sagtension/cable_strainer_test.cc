@@ -76,6 +76,35 @@ TEST_F(CableStrainerTest, LengthFinish) {
   EXPECT_EQ(length_start, helper::Round(c_.LengthFinish(), 3));
 }
 
+TEST_F(CableStrainerTest, LengthFinishDual) {
+  const double load_finish = c_.load_finish();
+  const Dual<double> length =
+      c_.LengthFinish(Dual<double>(load_finish, 1));
+  EXPECT_EQ(c_.LengthFinish(), length.value);
+
+  // compares derivative to a central difference
+  const double step = 1;
+  c_.set_load_finish(load_finish + step);
+  const double length_upper = c_.LengthFinish();
+  c_.set_load_finish(load_finish - step);
+  const double length_lower = c_.LengthFinish();
+  const double derivative = (length_upper - length_lower) / (2 * step);
+  EXPECT_EQ(helper::Round(derivative, 8),
+            helper::Round(length.derivative, 8));
+}
+
+TEST_F(CableStrainerTest, LengthFinishDualStrainStart) {
+  // compares to solving the start strain from the start model
+  const Dual<double> load_finish(c_.load_finish(), 1);
+  const double strain_start = model_start_->Strain(
+      CableElongationModel::ComponentType::kCombined, c_.load_start());
+
+  const Dual<double> length = c_.LengthFinish(load_finish);
+  const Dual<double> length_known = c_.LengthFinish(load_finish, strain_start);
+  EXPECT_EQ(length.value, length_known.value);
+  EXPECT_EQ(length.derivative, length_known.derivative);
+}
+
 TEST_F(CableStrainerTest, Validate) {
   EXPECT_TRUE(c_.Validate(false, nullptr));
 }
@@ -184,6 +184,47 @@ TEST_F(CatenaryCableReloaderTest, CatenaryReloaded) {
   EXPECT_EQ(12146, helper::Round(value, 0));
 }
 
+TEST_F(CatenaryCableReloaderTest, CatenaryReloadedLengthMatch) {
+  // reloads to a colder temperature and heavier load
+  CableState state = c_.model_reloaded()->state();
+  state.temperature = 0;
+  model_reloaded_->set_state(state);
+  c_.set_model_reloaded(model_reloaded_);
+
+  weight_unit_reloaded_.set_y(1.405);
+  weight_unit_reloaded_.set_z(2.099);
+  c_.set_weight_unit_reloaded(&weight_unit_reloaded_);
+  const Catenary3d catenary = c_.CatenaryReloaded();
+
+  // strains the reference catenary to the reloaded catenary tension
+  CableStrainer strainer;
+  strainer.set_length_start(catenary_.Length());
+  strainer.set_load_finish(catenary.TensionAverage());
+  strainer.set_load_start(catenary_.TensionAverage());
+  strainer.set_model_finish(model_reloaded_);
+  strainer.set_model_start(model_reference_);
+
+  // the catenary and strained cable lengths match
+  EXPECT_EQ(helper::Round(strainer.LengthFinish(), 2),
+            helper::Round(catenary.Length(), 2));
+}
+
+TEST_F(CatenaryCableReloaderTest, TensionHorizontalGuess) {
+  // reloads to a colder temperature without a guess
+  CableState state = c_.model_reloaded()->state();
+  state.temperature = 0;
+  model_reloaded_->set_state(state);
+  c_.set_model_reloaded(model_reloaded_);
+  const double value = c_.TensionHorizontal();
+
+  // guesses above and below the solution converge to the same value
+  c_.set_tension_horizontal_guess(20000);
+  EXPECT_EQ(helper::Round(value, 1), helper::Round(c_.TensionHorizontal(), 1));
+
+  c_.set_tension_horizontal_guess(1000);
+  EXPECT_EQ(helper::Round(value, 1), helper::Round(c_.TensionHorizontal(), 1));
+}
+
 TEST_F(CatenaryCableReloaderTest, Validate) {
   EXPECT_TRUE(c_.Validate(false, nullptr));
 }
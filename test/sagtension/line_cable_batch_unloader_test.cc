@@ -0,0 +1,115 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/sagtension/line_cable_batch_unloader.h"
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+#include "models/sagtension/line_cable_unloader.h"
+#include "models/sagtension/stretch_state_cache.h"
+#include "test/factory.h"
+
+class LineCableBatchUnloaderTest : public ::testing::Test {
+ protected:
+  LineCableBatchUnloaderTest() {
+    // gets a sag-tension cable from factory and removes compression
+    cable_ = factory::BuildCable();
+    cable_->component_core.modulus_compression_elastic_area = 0;
+    cable_->component_shell.modulus_compression_elastic_area = 0;
+
+    // gets line cable from factory
+    // replaces with custom cable
+    linecable_ = factory::BuildLineCable();
+    linecable_->set_cable(cable_);
+
+    // builds dependency objects - spacings and temperatures
+    spacings_ = {Vector3d(1500, 0, 0), Vector3d(1000, 0, 100),
+                 Vector3d(800, 0, -50)};
+    temperatures_ = {0, 60, 120, 212};
+
+    // builds fixture object
+    l_.set_line_cable(linecable_);
+    l_.set_condition_unloaded(CableConditionType::kInitial);
+    l_.set_spacings_attachments(&spacings_);
+    l_.set_temperatures_unloaded(&temperatures_);
+  }
+
+  ~LineCableBatchUnloaderTest() {
+    factory::DestroyLineCable(linecable_);
+  }
+
+  // allocated dependency objects
+  Cable* cable_;
+  LineCable* linecable_;
+  std::vector<Vector3d> spacings_;
+  std::vector<double> temperatures_;
+
+  // test object
+  LineCableBatchUnloader l_;
+};
+
+TEST_F(LineCableBatchUnloaderTest, LengthUnloaded) {
+  // checks every condition against the single unloader
+  const std::vector<CableConditionType> conditions = {
+      CableConditionType::kInitial,
+      CableConditionType::kCreep,
+      CableConditionType::kLoad};
+
+  LineCableUnloader unloader;
+  unloader.set_line_cable(linecable_);
+  for (auto iter = conditions.cbegin(); iter != conditions.cend(); iter++) {
+    const CableConditionType& condition = *iter;
+    l_.set_condition_unloaded(condition);
+    unloader.set_condition_unloaded(condition);
+
+    for (int i = 0; i < 4; i++) {
+      unloader.set_temperature_unloaded(temperatures_[i]);
+      for (int j = 0; j < 3; j++) {
+        unloader.set_spacing_attachments(spacings_[j]);
+        EXPECT_EQ(unloader.LengthUnloaded(), l_.LengthUnloaded(i, j));
+      }
+    }
+  }
+
+  // checks the benchmark from the single unloader
+  l_.set_condition_unloaded(CableConditionType::kInitial);
+  EXPECT_EQ(1502.973, helper::Round(l_.LengthUnloaded(1, 0), 3));
+
+  // checks invalid indexes
+  EXPECT_EQ(-999999, l_.LengthUnloaded(4, 0));
+  EXPECT_EQ(-999999, l_.LengthUnloaded(0, 3));
+}
+
+TEST_F(LineCableBatchUnloaderTest, LengthsUnloaded) {
+  const std::vector<double> lengths = *l_.LengthsUnloaded();
+  ASSERT_EQ(12, static_cast<int>(lengths.size()));
+  EXPECT_EQ(l_.LengthUnloaded(2, 1), lengths[(2 * 3) + 1]);
+
+  // checks that a thread pool gives identical results
+  ThreadPool pool(4);
+  l_.set_thread_pool(&pool);
+  l_.set_temperatures_unloaded(&temperatures_);
+  EXPECT_EQ(lengths, *l_.LengthsUnloaded());
+
+  // checks that a cached stretch gives identical results on a thread pool
+  ThreadPool pool_cached(2);
+  StretchStateCache cache;
+  l_.set_cache_stretch(&cache);
+  l_.set_temperatures_unloaded(&temperatures_);
+  EXPECT_EQ(lengths, *l_.LengthsUnloaded());
+  EXPECT_EQ(1, cache.size());
+
+  LineCableBatchUnloader unloader_cached;
+  unloader_cached.set_cache_stretch(&cache);
+  unloader_cached.set_condition_unloaded(CableConditionType::kInitial);
+  unloader_cached.set_line_cable(linecable_);
+  unloader_cached.set_spacings_attachments(&spacings_);
+  unloader_cached.set_temperatures_unloaded(&temperatures_);
+  unloader_cached.set_thread_pool(&pool_cached);
+  EXPECT_EQ(lengths, *unloader_cached.LengthsUnloaded());
+}
+
+TEST_F(LineCableBatchUnloaderTest, Validate) {
+  EXPECT_TRUE(l_.Validate(true, nullptr));
+}
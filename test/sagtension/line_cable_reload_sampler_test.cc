@@ -0,0 +1,127 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/sagtension/line_cable_reload_sampler.h"
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+#include "models/sagtension/line_cable_reloader.h"
+#include "test/factory.h"
+
+class LineCableReloadSamplerTest : public ::testing::Test {
+ protected:
+  LineCableReloadSamplerTest() {
+    // gets line cable from factory
+    linecable_ = factory::BuildLineCable();
+
+    // builds reloaded weather case
+    weathercase_reloaded_ = new WeatherLoadCase();
+    weathercase_reloaded_->description = "0-0-60";
+    weathercase_reloaded_->thickness_ice = 0;
+    weathercase_reloaded_->density_ice = 0;
+    weathercase_reloaded_->pressure_wind = 0;
+    weathercase_reloaded_->temperature_cable = 60;
+
+    // builds distributions
+    distributions_.temperature_cable.type =
+        RandomDistribution::DistributionType::kNormal;
+    distributions_.temperature_cable.mean = 60;
+    distributions_.temperature_cable.deviation = 20;
+
+    // builds fixture object
+    s_.set_condition_reloaded(CableConditionType::kInitial);
+    s_.set_distributions(&distributions_);
+    s_.set_line_cable(linecable_);
+    s_.set_num_samples(1000);
+    s_.set_seed(1);
+    s_.set_weathercase_reloaded(weathercase_reloaded_);
+  }
+
+  ~LineCableReloadSamplerTest() {
+    factory::DestroyLineCable(linecable_);
+    delete weathercase_reloaded_;
+  }
+
+  // allocated dependency objects
+  ReloadDistributions distributions_;
+  LineCable* linecable_;
+  WeatherLoadCase* weathercase_reloaded_;
+
+  // test object
+  LineCableReloadSampler s_;
+};
+
+TEST_F(LineCableReloadSamplerTest, DigestSag) {
+  const TDigest* digest = s_.DigestSag();
+  EXPECT_EQ(1000, digest->count());
+  EXPECT_EQ(30.85, helper::Round(digest->Quantile(0.05), 2));
+  EXPECT_EQ(32.86, helper::Round(digest->Quantile(0.50), 2));
+  EXPECT_EQ(34.87, helper::Round(digest->Quantile(0.95), 2));
+  EXPECT_EQ(0, s_.NumSamplesFailed());
+}
+
+TEST_F(LineCableReloadSamplerTest, DigestTensionHorizontal) {
+  const TDigest* digest = s_.DigestTensionHorizontal();
+  EXPECT_EQ(1000, digest->count());
+  EXPECT_EQ(5654, helper::Round(digest->Quantile(0.05), 0));
+  EXPECT_EQ(5998, helper::Round(digest->Quantile(0.50), 0));
+  EXPECT_EQ(6391, helper::Round(digest->Quantile(0.95), 0));
+
+  // removes the distributions, so every sample matches a single reload
+  distributions_.temperature_cable.type =
+      RandomDistribution::DistributionType::kNull;
+  s_.set_distributions(&distributions_);
+
+  LineCableReloader reloader;
+  reloader.set_condition_reloaded(CableConditionType::kInitial);
+  reloader.set_line_cable(linecable_);
+  reloader.set_weathercase_reloaded(weathercase_reloaded_);
+  const double tension = reloader.TensionHorizontal();
+
+  digest = s_.DigestTensionHorizontal();
+  EXPECT_EQ(tension, digest->min());
+  EXPECT_EQ(tension, digest->max());
+}
+
+TEST_F(LineCableReloadSamplerTest, Seed) {
+  const double quantile = s_.DigestSag()->Quantile(0.95);
+
+  // the same seed reproduces the samples
+  s_.set_seed(1);
+  EXPECT_EQ(quantile, s_.DigestSag()->Quantile(0.95));
+
+  // a different seed changes the samples
+  s_.set_seed(2);
+  EXPECT_NE(quantile, s_.DigestSag()->Quantile(0.95));
+}
+
+TEST_F(LineCableReloadSamplerTest, ThreadPool) {
+  // samples the constraint limit, so every sample solves the stretch again
+  distributions_.limit_constraint.type =
+      RandomDistribution::DistributionType::kUniform;
+  distributions_.limit_constraint.lower = 5500;
+  distributions_.limit_constraint.upper = 6500;
+  s_.set_distributions(&distributions_);
+  s_.set_num_samples(600);
+
+  const TDigest digest_serial = *s_.DigestSag();
+
+  // solves on a thread pool, which matches the serial results exactly
+  ThreadPool pool(4);
+  s_.set_thread_pool(&pool);
+  s_.set_seed(1);
+
+  const TDigest* digest = s_.DigestSag();
+  EXPECT_EQ(600, digest->count());
+  EXPECT_EQ(digest_serial.Mean(), digest->Mean());
+  EXPECT_EQ(digest_serial.Quantile(0.05), digest->Quantile(0.05));
+  EXPECT_EQ(digest_serial.Quantile(0.95), digest->Quantile(0.95));
+}
+
+TEST_F(LineCableReloadSamplerTest, Validate) {
+  EXPECT_TRUE(s_.Validate(false, nullptr));
+
+  distributions_.temperature_cable.deviation = -1;
+  EXPECT_FALSE(s_.Validate(false, nullptr));
+}
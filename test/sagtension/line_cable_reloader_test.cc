@@ -49,6 +49,65 @@ TEST_F(LineCableReloaderTest, CatenaryReloaded) {
   // more reloading tests are done in the horizontal tension test
 }
 
+TEST_F(LineCableReloaderTest, CatenaryReloadedTableUnitLoads) {
+  // builds a unit load table with the reloaded and stretch weathercases
+  CableUnitLoadTable table;
+  table.AddCable(linecable_->cable()->diameter,
+                 linecable_->cable()->weight_unit);
+  table.AddWeathercase(weathercase_reloaded_);
+  table.AddWeathercase(linecable_->weathercase_stretch_creep());
+  table.AddWeathercase(linecable_->weathercase_stretch_load());
+
+  // checks that the results match the solved unit loads
+  l_.set_condition_reloaded(CableConditionType::kLoad);
+  const double tension = l_.CatenaryReloaded().tension_horizontal();
+
+  l_.set_table_unit_loads(&table);
+  Catenary3d catenary = l_.CatenaryReloaded();
+  EXPECT_EQ(tension, catenary.tension_horizontal());
+  EXPECT_EQ(5561, helper::Round(catenary.tension_horizontal(), 0));
+}
+
+TEST_F(LineCableReloaderTest, Solve) {
+  EXPECT_TRUE(l_.Solve());
+  EXPECT_EQ(6000, helper::Round(l_.CatenaryReloaded().tension_horizontal(), 0));
+
+  // re-targets the condition and weathercase, and checks that the results
+  // match a new reloader
+  WeatherLoadCase weathercase = *linecable_->weathercase_stretch_load();
+  l_.set_condition_reloaded(CableConditionType::kLoad);
+  l_.set_weathercase_reloaded(&weathercase);
+  EXPECT_TRUE(l_.Solve());
+
+  LineCableReloader reloader;
+  reloader.set_line_cable(linecable_);
+  reloader.set_weathercase_reloaded(&weathercase);
+  reloader.set_condition_reloaded(CableConditionType::kLoad);
+  EXPECT_EQ(reloader.CatenaryReloaded().tension_horizontal(),
+            l_.CatenaryReloaded().tension_horizontal());
+
+  // switches back to the original condition and weathercase
+  l_.set_condition_reloaded(CableConditionType::kInitial);
+  l_.set_weathercase_reloaded(weathercase_reloaded_);
+  EXPECT_TRUE(l_.Solve());
+  EXPECT_EQ(6000, helper::Round(l_.CatenaryReloaded().tension_horizontal(), 0));
+
+  // fails without dereferencing missing inputs
+  l_.set_weathercase_reloaded(nullptr);
+  EXPECT_FALSE(l_.Solve());
+  l_.set_weathercase_reloaded(weathercase_reloaded_);
+
+  LineCable line_cable = *linecable_;
+  CableConstraint constraint = line_cable.constraint();
+  constraint.case_weather = nullptr;
+  line_cable.set_constraint(constraint);
+  l_.set_line_cable(&line_cable);
+  EXPECT_FALSE(l_.Solve());
+
+  l_.set_line_cable(nullptr);
+  EXPECT_FALSE(l_.Solve());
+}
+
 TEST_F(LineCableReloaderTest, StateReloaded) {
   CableState state = l_.StateReloaded();
 
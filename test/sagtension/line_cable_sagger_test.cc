@@ -102,6 +102,15 @@ TEST_F(LineCableSaggerTest, CatenaryConstantActual) {
 
   value = l_.CatenaryConstantActual(2);
   EXPECT_EQ(4066, helper::Round(value, 0));
+
+  // fails without dereferencing a missing design weathercase
+  const WeatherLoadCase* weathercase = constraints_[2].case_weather;
+  constraints_[2].case_weather = nullptr;
+  l_.set_constraints_design(&constraints_);
+  value = l_.CatenaryConstantActual(2);
+  EXPECT_EQ(-999999, value);
+
+  constraints_[2].case_weather = weathercase;
 }
 
 TEST_F(LineCableSaggerTest, IndexConstraintControlling) {
@@ -0,0 +1,127 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/sagtension/line_cable_sagging_sheet.h"
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+#include "models/sagging/cable_sag_position_corrector.h"
+#include "models/sagging/stopwatch_sagger.h"
+#include "models/sagging/transit_sagger.h"
+#include "test/factory.h"
+
+class LineCableSaggingSheetTest : public ::testing::Test {
+ protected:
+  LineCableSaggingSheetTest() {
+    // builds dependency object - line cable
+    linecable_ = factory::BuildLineCable();
+
+    // builds dependency object - attachment points
+    points_attachment_.push_back(Point3d<double>(0, 0, 0));
+    points_attachment_.push_back(Point3d<double>(1200, 0, 50));
+    points_attachment_.push_back(Point3d<double>(2200, 0, 150));
+    points_attachment_.push_back(Point3d<double>(3800, 0, 100));
+    points_attachment_.push_back(Point3d<double>(5000, 0, 0));
+
+    // builds dependency object - temperatures
+    temperatures_ = {0, 60, 120};
+
+    // builds fixture object
+    s_.set_condition_sagging(CableConditionType::kInitial);
+    s_.set_distance_transit(20);
+    s_.set_line_cable(linecable_);
+    s_.set_location_dyno(DynoSagger::SpanEndLocation::kBack);
+    s_.set_points_attachment(&points_attachment_);
+    s_.set_temperatures(&temperatures_);
+    s_.set_units(units::UnitSystem::kImperial);
+    s_.set_wave_stopwatch(3);
+  }
+
+  ~LineCableSaggingSheetTest() {
+    factory::DestroyLineCable(linecable_);
+  }
+
+  // allocated dependency objects
+  LineCable* linecable_;
+  std::vector<Point3d<double>> points_attachment_;
+  std::vector<double> temperatures_;
+
+  // test object
+  LineCableSaggingSheet s_;
+};
+
+TEST_F(LineCableSaggingSheetTest, Cells) {
+  const std::vector<SaggingSheetCell>* cells = s_.Cells();
+  ASSERT_NE(nullptr, cells);
+  EXPECT_EQ(12, static_cast<int>(cells->size()));
+
+  // the constraint is at 60 degrees, so the ruling span is not reloaded
+  EXPECT_EQ(6000, helper::Round(s_.TensionHorizontal(1), 1));
+  EXPECT_LT(s_.TensionHorizontal(1), s_.TensionHorizontal(0));
+  EXPECT_LT(s_.TensionHorizontal(2), s_.TensionHorizontal(1));
+
+  // checks the 60 degree cells against hand-wired saggers
+  CableSagPositionCorrector corrector;
+  corrector.set_linecable(linecable_);
+  corrector.set_points_attachment(&points_attachment_);
+  const std::vector<Catenary3d>* catenaries = corrector.CatenariesPulleyed();
+  const std::vector<double> offsets = corrector.ClippingOffsets();
+
+  for (int i = 0; i < 4; i++) {
+    const SaggingSheetCell* cell = s_.Cell(1, i);
+    ASSERT_NE(nullptr, cell);
+    EXPECT_EQ(cells->data() + 4 + i, cell);
+
+    TransitSagger sagger_transit;
+    sagger_transit.set_catenary((*catenaries)[i]);
+    sagger_transit.set_point_transit(Point3d<double>(0, 0, -20));
+    EXPECT_EQ(helper::Round(sagger_transit.AngleLow(), 3),
+              helper::Round(cell->angle_transit, 3));
+
+    StopwatchSagger sagger_stopwatch;
+    sagger_stopwatch.set_catenary((*catenaries)[i]);
+    sagger_stopwatch.set_units(units::UnitSystem::kImperial);
+    EXPECT_EQ(helper::Round(sagger_stopwatch.TimeReturn(3), 3),
+              helper::Round(cell->time_stopwatch, 3));
+
+    DynoSagger sagger_dyno;
+    sagger_dyno.set_catenary((*catenaries)[i]);
+    sagger_dyno.set_location(DynoSagger::SpanEndLocation::kBack);
+    EXPECT_EQ(helper::Round(sagger_dyno.Tension(), 1),
+              helper::Round(cell->tension_dyno, 1));
+
+    EXPECT_EQ(helper::Round(offsets[i + 1], 3),
+              helper::Round(cell->offset_clipping, 3));
+  }
+
+  // checks that the dead end offset is zero, and that sags increase with
+  // temperature
+  EXPECT_EQ(0, s_.Cell(0, 3)->offset_clipping);
+  EXPECT_LT(s_.Cell(0, 0)->time_stopwatch, s_.Cell(2, 0)->time_stopwatch);
+
+  // checks invalid indexes
+  EXPECT_EQ(nullptr, s_.Cell(3, 0));
+  EXPECT_EQ(nullptr, s_.Cell(0, 4));
+}
+
+TEST_F(LineCableSaggingSheetTest, ThreadPool) {
+  const std::vector<SaggingSheetCell> cells = *s_.Cells();
+
+  ThreadPool pool(4);
+  s_.set_thread_pool(&pool);
+  s_.set_temperatures(&temperatures_);
+
+  const std::vector<SaggingSheetCell>* cells_pool = s_.Cells();
+  ASSERT_EQ(cells.size(), cells_pool->size());
+  for (int i = 0; i < static_cast<int>(cells.size()); i++) {
+    EXPECT_EQ(cells[i].angle_transit, (*cells_pool)[i].angle_transit);
+    EXPECT_EQ(cells[i].offset_clipping, (*cells_pool)[i].offset_clipping);
+    EXPECT_EQ(cells[i].tension_dyno, (*cells_pool)[i].tension_dyno);
+    EXPECT_EQ(cells[i].time_stopwatch, (*cells_pool)[i].time_stopwatch);
+  }
+}
+
+TEST_F(LineCableSaggingSheetTest, Validate) {
+  EXPECT_TRUE(s_.Validate(true, nullptr));
+}
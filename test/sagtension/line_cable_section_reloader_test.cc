@@ -0,0 +1,111 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/sagtension/line_cable_section_reloader.h"
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+#include "models/sagtension/line_cable_reloader.h"
+#include "test/factory.h"
+
+class LineCableSectionReloaderTest : public ::testing::Test {
+ protected:
+  LineCableSectionReloaderTest() {
+    // builds dependency object - transmission line
+    line_ = factory::BuildTransmissionLine();
+    linecable_ = &line_->line_cables()->at(2);
+
+    // builds fixture object
+    l_.set_line_cable(linecable_);
+    l_.set_transmission_line(line_);
+    l_.set_weathercase_reloaded(linecable_->weathercase_stretch_load());
+    l_.set_condition_reloaded(CableConditionType::kLoad);
+    l_.set_type_model_span(
+        LineCableSectionReloader::SpanModelType::kRulingSpan);
+  }
+
+  // allocated dependency objects
+  const LineCable* linecable_;
+  TransmissionLine* line_;
+
+  // test object
+  LineCableSectionReloader l_;
+};
+
+TEST_F(LineCableSectionReloaderTest, CatenariesReloaded) {
+  const std::vector<Catenary3d>* catenaries = nullptr;
+
+  // checks the ruling span model against a line cable reloader
+  LineCableReloader reloader;
+  reloader.set_line_cable(linecable_);
+  reloader.set_weathercase_reloaded(linecable_->weathercase_stretch_load());
+  reloader.set_condition_reloaded(CableConditionType::kLoad);
+  const double tension_horizontal = reloader.TensionHorizontal();
+
+  catenaries = l_.CatenariesReloaded();
+  ASSERT_EQ(2, static_cast<int>(catenaries->size()));
+  for (auto iter = catenaries->cbegin(); iter != catenaries->cend(); iter++) {
+    const Catenary3d& catenary = *iter;
+    EXPECT_EQ(tension_horizontal, catenary.tension_horizontal());
+  }
+  EXPECT_EQ(26.15, helper::Round(catenaries->at(0).Sag(), 2));
+  EXPECT_EQ(26.14, helper::Round(catenaries->at(1).Sag(), 2));
+
+  // checks the individual span model
+  l_.set_type_model_span(
+      LineCableSectionReloader::SpanModelType::kIndividual);
+  catenaries = l_.CatenariesReloaded();
+  ASSERT_EQ(2, static_cast<int>(catenaries->size()));
+  EXPECT_EQ(11751, helper::Round(catenaries->at(0).tension_horizontal(), 0));
+  EXPECT_EQ(27.03, helper::Round(catenaries->at(0).Sag(), 2));
+  EXPECT_EQ(11751, helper::Round(catenaries->at(1).tension_horizontal(), 0));
+  EXPECT_EQ(27.02, helper::Round(catenaries->at(1).Sag(), 2));
+
+  // checks that a thread pool gives identical results
+  const std::vector<Catenary3d> catenaries_serial = *catenaries;
+  ThreadPool pool(2);
+  l_.set_thread_pool(&pool);
+  l_.set_weathercase_reloaded(linecable_->weathercase_stretch_load());
+  catenaries = l_.CatenariesReloaded();
+  for (int index = 0; index < 2; index++) {
+    EXPECT_EQ(catenaries_serial[index].tension_horizontal(),
+              (*catenaries)[index].tension_horizontal());
+  }
+
+  // checks that reloading at the constraint matches the constraint
+  l_.set_weathercase_reloaded(linecable_->constraint().case_weather);
+  l_.set_condition_reloaded(CableConditionType::kInitial);
+  catenaries = l_.CatenariesReloaded();
+  for (auto iter = catenaries->cbegin(); iter != catenaries->cend(); iter++) {
+    const Catenary3d& catenary = *iter;
+    EXPECT_EQ(6000, helper::Round(catenary.tension_horizontal(), 0));
+  }
+}
+
+TEST_F(LineCableSectionReloaderTest, SpacingsSpan) {
+  const std::vector<Vector3d>* spacings = l_.SpacingsSpan();
+  ASSERT_EQ(2, static_cast<int>(spacings->size()));
+  EXPECT_EQ(999.29, helper::Round(spacings->at(0).x(), 2));
+  EXPECT_EQ(0, helper::Round(spacings->at(0).y(), 2));
+  EXPECT_EQ(100, helper::Round(spacings->at(0).z(), 2));
+  EXPECT_EQ(999, helper::Round(spacings->at(1).x(), 2));
+  EXPECT_EQ(0, helper::Round(spacings->at(1).y(), 2));
+  EXPECT_EQ(-100, helper::Round(spacings->at(1).z(), 2));
+
+  // checks a line cable without connections
+  LineCable linecable = *linecable_;
+  linecable.ClearConnections();
+  l_.set_line_cable(&linecable);
+  EXPECT_EQ(nullptr, l_.SpacingsSpan());
+}
+
+TEST_F(LineCableSectionReloaderTest, Validate) {
+  EXPECT_TRUE(l_.Validate(false, nullptr));
+
+  // checks a line cable that is not connected to the transmission line
+  LineCable* linecable = factory::BuildLineCable();
+  l_.set_line_cable(linecable);
+  EXPECT_FALSE(l_.Validate(false, nullptr));
+  factory::DestroyLineCable(linecable);
+}
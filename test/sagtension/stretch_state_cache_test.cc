@@ -0,0 +1,163 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/sagtension/stretch_state_cache.h"
+
+#include <cstdio>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+#include "models/sagtension/line_cable_reloader.h"
+#include "test/factory.h"
+
+class StretchStateCacheTest : public ::testing::Test {
+ protected:
+  StretchStateCacheTest() {
+    filepath_ = "stretch_state_cache_test.otls";
+
+    // builds dependency object - line cable
+    linecable_ = factory::BuildLineCable();
+
+    CableConstraint constraint = linecable_->constraint();
+    constraint.condition = CableConditionType::kLoad;
+    constraint.limit = 5561.5;
+    linecable_->set_constraint(constraint);
+
+    // builds dependency object - entry
+    entry_.state_stretch_creep.load = 5595;
+    entry_.state_stretch_creep.temperature = 60;
+    entry_.state_stretch_creep.type_polynomial =
+        SagTensionCableComponent::PolynomialType::kCreep;
+    entry_.state_stretch_load.load = 12179;
+    entry_.state_stretch_load.temperature = 0;
+    entry_.state_stretch_load.type_polynomial =
+        SagTensionCableComponent::PolynomialType::kLoadStrain;
+    entry_.tension_horizontal_constraint = 5561.5;
+  }
+
+  ~StretchStateCacheTest() {
+    c_.Close();
+    std::remove(filepath_.c_str());
+    factory::DestroyLineCable(linecable_);
+  }
+
+  // allocated dependency objects
+  StretchStateCacheEntry entry_;
+  std::string filepath_;
+  LineCable* linecable_;
+
+  // test object
+  StretchStateCache c_;
+};
+
+TEST_F(StretchStateCacheTest, AddFind) {
+  StretchStateCacheEntry entry;
+  EXPECT_FALSE(c_.Find(1, &entry));
+
+  c_.Add(1, entry_);
+  EXPECT_TRUE(c_.Find(1, &entry));
+  EXPECT_EQ(12179, entry.state_stretch_load.load);
+  EXPECT_EQ(5561.5, entry.tension_horizontal_constraint);
+  EXPECT_FALSE(c_.Find(2, &entry));
+  EXPECT_EQ(1, c_.size());
+}
+
+TEST_F(StretchStateCacheTest, Key) {
+  const std::uint64_t key = StretchStateCache::Key(*linecable_);
+
+  // a copy has the same key
+  LineCable linecable = *linecable_;
+  EXPECT_EQ(key, StretchStateCache::Key(linecable));
+
+  // descriptions do not change the key
+  WeatherLoadCase weathercase = *linecable.weathercase_stretch_creep();
+  weathercase.description = "renamed";
+  linecable.set_weathercase_stretch_creep(&weathercase);
+  EXPECT_EQ(key, StretchStateCache::Key(linecable));
+
+  // inputs change the key
+  weathercase.temperature_cable += 1;
+  EXPECT_NE(key, StretchStateCache::Key(linecable));
+
+  linecable = *linecable_;
+  CableConstraint constraint = linecable.constraint();
+  constraint.limit += 1;
+  linecable.set_constraint(constraint);
+  EXPECT_NE(key, StretchStateCache::Key(linecable));
+}
+
+TEST_F(StretchStateCacheTest, LineCableReloader) {
+  // solves without a cache
+  LineCableReloader reloader;
+  reloader.set_condition_reloaded(CableConditionType::kLoad);
+  reloader.set_line_cable(linecable_);
+  reloader.set_weathercase_reloaded(linecable_->constraint().case_weather);
+  const double tension = reloader.TensionHorizontal();
+  const CableStretchState state_creep = reloader.StretchStateCreep();
+  const CableStretchState state_load = reloader.StretchStateLoad();
+
+  // solves and adds to the cache
+  reloader.set_cache_stretch(&c_);
+  EXPECT_EQ(tension, reloader.TensionHorizontal());
+  EXPECT_EQ(1, c_.size());
+
+  // writes and reopens the cache, and solves from the file
+  EXPECT_TRUE(c_.Write(filepath_));
+
+  StretchStateCache cache;
+  EXPECT_TRUE(cache.Open(filepath_));
+  EXPECT_EQ(1, cache.size());
+
+  LineCableReloader reloader_cached;
+  reloader_cached.set_cache_stretch(&cache);
+  reloader_cached.set_condition_reloaded(CableConditionType::kLoad);
+  reloader_cached.set_line_cable(linecable_);
+  reloader_cached.set_weathercase_reloaded(
+      linecable_->constraint().case_weather);
+  EXPECT_EQ(tension, reloader_cached.TensionHorizontal());
+  EXPECT_EQ(state_creep.load, reloader_cached.StretchStateCreep().load);
+  EXPECT_EQ(state_load.load, reloader_cached.StretchStateLoad().load);
+  EXPECT_EQ(1, cache.size());
+}
+
+TEST_F(StretchStateCacheTest, WriteOpen) {
+  c_.Add(3, entry_);
+  c_.Add(1, entry_);
+  EXPECT_TRUE(c_.Write(filepath_));
+
+  // reopens the file and adds another entry
+  StretchStateCache cache;
+  EXPECT_TRUE(cache.Open(filepath_));
+  EXPECT_EQ(2, cache.size());
+
+  StretchStateCacheEntry entry;
+  EXPECT_TRUE(cache.Find(3, &entry));
+  EXPECT_EQ(5595, entry.state_stretch_creep.load);
+  EXPECT_EQ(SagTensionCableComponent::PolynomialType::kCreep,
+            entry.state_stretch_creep.type_polynomial);
+  EXPECT_FALSE(cache.Find(2, &entry));
+
+  // an added entry that replaces a file entry is counted once
+  cache.Add(3, entry_);
+  EXPECT_EQ(2, cache.size());
+
+  entry_.tension_horizontal_constraint = 6000;
+  cache.Add(2, entry_);
+  EXPECT_EQ(3, cache.size());
+  EXPECT_TRUE(cache.Write(filepath_));
+
+  // the rewritten file merges the opened and added entries
+  EXPECT_TRUE(c_.Open(filepath_));
+  EXPECT_TRUE(c_.Find(2, &entry));
+  EXPECT_EQ(6000, entry.tension_horizontal_constraint);
+  EXPECT_TRUE(c_.Find(1, &entry));
+  EXPECT_EQ(5561.5, entry.tension_horizontal_constraint);
+
+  // an invalid file does not open
+  std::FILE* file = std::fopen(filepath_.c_str(), "wb");
+  std::fputs("invalid", file);
+  std::fclose(file);
+  EXPECT_FALSE(cache.Open(filepath_));
+}
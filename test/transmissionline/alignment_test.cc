@@ -127,6 +127,30 @@ TEST_F(AlignmentTest, IndexSegment) {
   EXPECT_EQ(1, index);
 }
 
+TEST_F(AlignmentTest, IndexesSegment) {
+  std::vector<double> stations;
+  std::vector<int> indexes;
+
+  // checks sorted stations, including invalid and coincident stations
+  stations = {-50, 0, 50, 100, 150, 200, 250};
+  indexes = a_.IndexesSegment(stations);
+  EXPECT_EQ(7, static_cast<int>(indexes.size()));
+  EXPECT_EQ(-1, indexes[0]);
+  EXPECT_EQ(0, indexes[1]);
+  EXPECT_EQ(0, indexes[2]);
+  EXPECT_EQ(0, indexes[3]);
+  EXPECT_EQ(1, indexes[4]);
+  EXPECT_EQ(1, indexes[5]);
+  EXPECT_EQ(-1, indexes[6]);
+
+  // checks unsorted stations
+  stations = {150, 50, 200, 100};
+  indexes = a_.IndexesSegment(stations);
+  for (unsigned int index = 0; index < stations.size(); index++) {
+    EXPECT_EQ(a_.IndexSegment(stations[index]), indexes[index]);
+  }
+}
+
 TEST_F(AlignmentTest, IsValidStation) {
   double station;
   bool is_valid = false;
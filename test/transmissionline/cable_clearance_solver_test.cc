@@ -0,0 +1,129 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/cable_clearance_solver.h"
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+
+class CableClearanceSolverTest : public ::testing::Test {
+ protected:
+  CableClearanceSolverTest() {
+    ClearanceCable cable;
+    cable.direction_transverse = AxisDirectionType::kPositive;
+    cable.tension_horizontal = 1000;
+    cable.weight_unit = Vector3d(0, 0, 0.5);
+
+    // builds a two span cable along the x axis
+    cable.points_attachment.push_back(Point3d<double>(0, 0, 100));
+    cable.points_attachment.push_back(Point3d<double>(1000, 0, 100));
+    cable.points_attachment.push_back(Point3d<double>(2000, 0, 100));
+    cables_.push_back(cable);
+
+    // builds a parallel cable offset transversely
+    cable.points_attachment.clear();
+    cable.points_attachment.push_back(Point3d<double>(0, 10, 100));
+    cable.points_attachment.push_back(Point3d<double>(1000, 10, 100));
+    cable.points_attachment.push_back(Point3d<double>(2000, 10, 100));
+    cables_.push_back(cable);
+
+    // builds a single span cable that crosses above the first span
+    cable.points_attachment.clear();
+    cable.points_attachment.push_back(Point3d<double>(500, -500, 150));
+    cable.points_attachment.push_back(Point3d<double>(500, 500, 150));
+    cables_.push_back(cable);
+
+    // builds a flat terrain profile under the cables
+    for (int index = 0; index <= 22; index++) {
+      points_terrain_.push_back(Point3d<double>(index * 100 - 100, 0, 0));
+    }
+
+    c_.set_cables(&cables_);
+    c_.set_points_terrain(&points_terrain_);
+  }
+
+  // test data
+  std::vector<ClearanceCable> cables_;
+  std::vector<Point3d<double>> points_terrain_;
+
+  // test object
+  CableClearanceSolver c_;
+};
+
+TEST_F(CableClearanceSolverTest, ClearanceCables) {
+  ClearanceResult result;
+
+  // parallel cables
+  result = c_.ClearanceCables(0, 1);
+  EXPECT_EQ(10, helper::Round(result.distance, 2));
+  EXPECT_EQ(10, helper::Round(result.point_other.y - result.point_cable.y, 2));
+
+  // crossing cables
+  result = c_.ClearanceCables(0, 2);
+  EXPECT_EQ(50, helper::Round(result.distance, 2));
+  EXPECT_EQ(0, result.index_span);
+  EXPECT_EQ(0, result.index_other);
+  EXPECT_EQ(500, helper::Round(result.point_cable.x, 2));
+  EXPECT_EQ(37.17, helper::Round(result.point_cable.z, 2));
+  EXPECT_EQ(0, helper::Round(result.point_other.y, 2));
+  EXPECT_EQ(87.17, helper::Round(result.point_other.z, 2));
+
+  // invalid indexes
+  result = c_.ClearanceCables(0, 0);
+  EXPECT_EQ(-999999, result.distance);
+  result = c_.ClearanceCables(0, 3);
+  EXPECT_EQ(-999999, result.distance);
+}
+
+TEST_F(CableClearanceSolverTest, ClearanceCablesSkewed) {
+  ClearanceResult result;
+
+  // builds a cable that crosses above the first span at a shallow angle, so
+  // the closest sample pair is not in the closest clearance basin
+  cables_[0].points_attachment.pop_back();
+
+  ClearanceCable cable = cables_[0];
+  cable.tension_horizontal = 1100;
+  cable.points_attachment.clear();
+  cable.points_attachment.push_back(Point3d<double>(1136, 12, 135));
+  cable.points_attachment.push_back(Point3d<double>(478, -8, 120));
+  cables_.push_back(cable);
+  c_.set_cables(&cables_);
+
+  result = c_.ClearanceCables(0, 3);
+  EXPECT_EQ(17.45, helper::Round(result.distance, 2));
+  EXPECT_EQ(1000, helper::Round(result.point_cable.x, 2));
+  EXPECT_EQ(998.06, helper::Round(result.point_other.x, 2));
+  EXPECT_EQ(115.48, helper::Round(result.point_other.z, 2));
+}
+
+TEST_F(CableClearanceSolverTest, ClearanceTerrain) {
+  ClearanceResult result;
+
+  result = c_.ClearanceTerrain(0);
+  EXPECT_EQ(37.17, helper::Round(result.distance, 2));
+  EXPECT_EQ(37.17, helper::Round(result.point_cable.z, 2));
+  EXPECT_EQ(0, helper::Round(result.point_other.z, 2));
+
+  result = c_.ClearanceTerrain(2);
+  EXPECT_EQ(87.17, helper::Round(result.distance, 2));
+
+  // moves the cable and checks that the solver updates
+  cables_[0].tension_horizontal = 2000;
+  c_.set_cables(&cables_);
+  result = c_.ClearanceTerrain(0);
+  EXPECT_EQ(68.71, helper::Round(result.distance, 2));
+
+  // removes the terrain
+  c_.set_points_terrain(nullptr);
+  result = c_.ClearanceTerrain(0);
+  EXPECT_EQ(-999999, result.distance);
+}
+
+TEST_F(CableClearanceSolverTest, Validate) {
+  EXPECT_TRUE(c_.Validate(true, nullptr));
+
+  cables_[1].tension_horizontal = 0;
+  EXPECT_FALSE(c_.Validate(true, nullptr));
+}
@@ -0,0 +1,125 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/cable_library.h"
+
+#include <cstdio>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+#include "test/factory.h"
+
+class CableLibraryTest : public ::testing::Test {
+ protected:
+  CableLibraryTest() {
+    filepath_ = "cable_library_test.otls";
+
+    // builds dependency objects
+    Cable* cable = factory::BuildCable();
+    cables_.push_back(*cable);
+
+    cable->name = "ACSR Drake Modified";
+    cable->diameter = 0.1;
+    cable->resistances_ac.pop_back();
+    cable->component_shell.coefficients_polynomial_creep.clear();
+    cables_.push_back(*cable);
+
+    cable->name = "";
+    cables_.push_back(*cable);
+    delete cable;
+
+    // builds fixture object
+    CableLibrary::Write(cables_, filepath_);
+    c_.Open(filepath_);
+  }
+
+  ~CableLibraryTest() {
+    c_.Close();
+    std::remove(filepath_.c_str());
+  }
+
+  // allocated dependency objects
+  std::vector<Cable> cables_;
+  std::string filepath_;
+
+  // test object
+  CableLibrary c_;
+};
+
+TEST_F(CableLibraryTest, CableObject) {
+  const Cable* cable = c_.CableObject(1);
+  EXPECT_EQ("ACSR Drake Modified", cable->name);
+  EXPECT_EQ(0.1, cable->diameter);
+  EXPECT_EQ(1, static_cast<int>(cable->resistances_ac.size()));
+  EXPECT_EQ(0, static_cast<int>(
+      cable->component_shell.coefficients_polynomial_creep.size()));
+  EXPECT_EQ(cables_[1].component_core.coefficients_polynomial_loadstrain,
+            cable->component_core.coefficients_polynomial_loadstrain);
+  EXPECT_TRUE(cable->Validate(false, nullptr));
+
+  // checks that the object is only built once
+  EXPECT_EQ(cable, c_.CableObject(1));
+
+  EXPECT_EQ(nullptr, c_.CableObject(3));
+}
+
+TEST_F(CableLibraryTest, IndexCable) {
+  EXPECT_EQ(3, c_.size());
+  EXPECT_EQ(0, c_.IndexCable("ACSR Drake"));
+  EXPECT_EQ(1, c_.IndexCable("ACSR Drake Modified"));
+  EXPECT_EQ(2, c_.IndexCable(""));
+  EXPECT_EQ(-1, c_.IndexCable("ACSR Dra"));
+}
+
+TEST_F(CableLibraryTest, Open) {
+  // checks a library with duplicate names
+  cables_.push_back(cables_.front());
+  std::vector<char> buffer;
+  EXPECT_FALSE(CableLibrary::Serialize(cables_, &buffer));
+
+  // checks a corrupted file
+  cables_.pop_back();
+  EXPECT_TRUE(CableLibrary::Serialize(cables_, &buffer));
+  buffer.resize(buffer.size() - 4);
+
+  const std::string filepath = "cable_library_test_truncated.otls";
+  std::FILE* file = std::fopen(filepath.c_str(), "wb");
+  std::fwrite(buffer.data(), 1, buffer.size(), file);
+  std::fclose(file);
+
+  CableLibrary library;
+  EXPECT_FALSE(library.Open(filepath));
+  EXPECT_EQ(0, library.size());
+  EXPECT_EQ(-1, library.IndexCable("ACSR Drake"));
+  std::remove(filepath.c_str());
+
+  // checks a missing file
+  EXPECT_FALSE(library.Open(filepath));
+}
+
+TEST_F(CableLibraryTest, View) {
+  const CableView* view = c_.View(0);
+  const Cable& cable = cables_[0];
+  EXPECT_EQ(cable.name, view->name());
+  EXPECT_EQ(cable.absorptivity, view->absorptivity());
+  EXPECT_EQ(cable.area_physical, view->area_physical());
+  EXPECT_EQ(cable.diameter, view->diameter());
+  EXPECT_EQ(cable.emissivity, view->emissivity());
+  EXPECT_EQ(cable.strength_rated, view->strength_rated());
+  EXPECT_EQ(cable.weight_unit, view->weight_unit());
+
+  ASSERT_EQ(2, view->size_resistances_ac());
+  EXPECT_EQ(cable.resistances_ac.back().resistance,
+            view->resistances_ac()[1].resistance);
+
+  const CableComponentView component = view->component_core();
+  ASSERT_EQ(5, component.size_coefficients_polynomial_creep());
+  EXPECT_EQ(cable.component_core.coefficients_polynomial_creep[4],
+            component.coefficients_polynomial_creep()[4]);
+  EXPECT_EQ(cable.component_core.modulus_tension_elastic_area,
+            component.modulus_tension_elastic_area());
+
+  EXPECT_EQ(nullptr, c_.View(-1));
+}
@@ -161,6 +161,133 @@ TEST_F(CablePositionLocatorTest, PointsCableAttachment) {
   EXPECT_EQ(100.00, helper::Round(point.z, 2));
 }
 
+TEST_F(CablePositionLocatorTest, PointsCableAttachmentNewton) {
+  const std::vector<Point3d<double>>* points = nullptr;
+  Point3d<double> point;
+
+  c_.set_type_solver(CablePositionLocator::SolverType::kNewton);
+
+  // checks with no wind
+  points = c_.PointsCableAttachment();
+
+  point = points->at(1);
+  EXPECT_EQ(1993.20, helper::Round(point.x, 2));
+  EXPECT_EQ(1006.81, helper::Round(point.y, 2));
+  EXPECT_EQ(197.28, helper::Round(point.z, 2));
+
+  // checks with wind
+  weight_unit_->set_y(10);
+  c_.set_weight_unit(weight_unit_);
+  points = c_.PointsCableAttachment();
+
+  point = points->at(1);
+  EXPECT_EQ(1992.96, helper::Round(point.x, 2));
+  EXPECT_EQ(1007.05, helper::Round(point.y, 2));
+  EXPECT_EQ(199.17, helper::Round(point.z, 2));
+
+  // reverses direction of wind
+  c_.set_direction_wind(AxisDirectionType::kNegative);
+  points = c_.PointsCableAttachment();
+
+  point = points->at(1);
+  EXPECT_EQ(2006.37, helper::Round(point.x, 2));
+  EXPECT_EQ(993.63, helper::Round(point.y, 2));
+  EXPECT_EQ(195.67, helper::Round(point.z, 2));
+}
+
+TEST_F(CablePositionLocatorTest, PointsCableAttachmentNewtonLongSection) {
+  // builds a line section with many suspension structures, alternating
+  // offsets, and varying elevations
+  const int kNumSpans = 200;
+
+  TransmissionLine line;
+  line.set_origin(Point3d<double>(0, 0, 0));
+
+  AlignmentPoint point_alignment;
+  point_alignment.elevation = 0;
+  point_alignment.rotation = 0;
+  point_alignment.station = 0;
+  line.AddAlignmentPoint(point_alignment);
+
+  point_alignment.station = kNumSpans * 1000;
+  line.AddAlignmentPoint(point_alignment);
+
+  Hardware hardware_deadend = *factory::BuildHardware();
+  hardware_deadend.type = Hardware::HardwareType::kDeadEnd;
+
+  Hardware hardware_suspension = *factory::BuildHardware();
+  hardware_suspension.type = Hardware::HardwareType::kSuspension;
+
+  Structure structure = *factory::BuildStructure();
+
+  LineStructure line_structure;
+  line_structure.set_rotation(0);
+  line_structure.set_structure(&structure);
+  for (int index = 0; index <= kNumSpans; index++) {
+    line_structure.DetachHardware(1);
+    if ((index == 0) || (index == kNumSpans)) {
+      line_structure.AttachHardware(1, &hardware_deadend);
+    } else {
+      line_structure.AttachHardware(1, &hardware_suspension);
+    }
+
+    line_structure.set_height_adjustment(150 * (index % 3));
+    line_structure.set_offset(20 * (index % 2));
+    line_structure.set_station(index * 1000 + 100 * (index % 2));
+    line.AddLineStructure(line_structure);
+  }
+
+  LineCable line_cable = *factory::BuildLineCable();
+  line_cable.ClearConnections();
+  LineCableConnection connection;
+  connection.index_attachment = 1;
+  const SlotVector<LineStructure>* line_structures = line.line_structures();
+  for (auto iter = line_structures->cbegin(); iter != line_structures->cend();
+       iter++) {
+    connection.line_structure = &(*iter);
+    line_cable.AddConnection(connection);
+  }
+  line.AddLineCable(line_cable);
+
+  c_.set_index_line_cable(0);
+  c_.set_transmission_line(&line);
+
+  // solves with fixed point iteration
+  c_.set_type_solver(CablePositionLocator::SolverType::kFixedPoint);
+  const std::vector<Point3d<double>> points_fixed =
+      *c_.PointsCableAttachment();
+  int iterations_fixed = c_.iterations();
+
+  // solves with newton iteration and compares
+  c_.set_type_solver(CablePositionLocator::SolverType::kNewton);
+  const std::vector<Point3d<double>>* points_newton =
+      c_.PointsCableAttachment();
+  ASSERT_NE(nullptr, points_newton);
+  ASSERT_EQ(points_fixed.size(), points_newton->size());
+
+  for (unsigned int index = 0; index < points_fixed.size(); index++) {
+    const Point3d<double>& point_fixed = points_fixed.at(index);
+    const Point3d<double>& point_newton = points_newton->at(index);
+    EXPECT_NEAR(point_fixed.x, point_newton.x, 0.01);
+    EXPECT_NEAR(point_fixed.y, point_newton.y, 0.01);
+    EXPECT_NEAR(point_fixed.z, point_newton.z, 0.01);
+  }
+
+  // checks that newton converges in fewer iterations
+  EXPECT_LT(0, c_.iterations());
+  EXPECT_LT(c_.iterations(), iterations_fixed);
+
+  // increases the tension, which couples the hardware angles more strongly
+  // and slows down the fixed point iteration
+  c_.set_tension_horizontal(15000);
+  c_.set_type_solver(CablePositionLocator::SolverType::kFixedPoint);
+  iterations_fixed = c_.iterations();
+  EXPECT_EQ(8, iterations_fixed);
+
+  c_.set_type_solver(CablePositionLocator::SolverType::kNewton);
+  EXPECT_EQ(3, c_.iterations());
+}
+
 TEST_F(CablePositionLocatorTest, Validate) {
   EXPECT_TRUE(c_.Validate(true, nullptr));
 }
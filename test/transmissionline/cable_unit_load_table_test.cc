@@ -0,0 +1,90 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/cable_unit_load_table.h"
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+#include "models/base/units.h"
+#include "test/factory.h"
+
+class CableUnitLoadTableTest : public ::testing::Test {
+ protected:
+  CableUnitLoadTableTest() {
+    cable_ = factory::BuildCable();
+
+    // builds dependency objects - weathercases
+    case_ice_.description = "1-0-0";
+    case_ice_.density_ice = 57.3;
+    case_ice_.pressure_wind = 0;
+    case_ice_.temperature_cable = 0;
+    case_ice_.thickness_ice =
+      units::ConvertLength(1, units::LengthConversionType::kInchesToFeet);
+
+    case_both_.description = "0.5-8-0";
+    case_both_.density_ice = 57.3;
+    case_both_.pressure_wind = 8;
+    case_both_.temperature_cable = 0;
+    case_both_.thickness_ice =
+      units::ConvertLength(0.5, units::LengthConversionType::kInchesToFeet);
+
+    // builds fixture object
+    c_.AddWeathercase(&case_ice_);
+    c_.AddCable(cable_->diameter, cable_->weight_unit);
+  }
+
+  ~CableUnitLoadTableTest() {
+    delete cable_;
+  }
+
+  // allocated dependency objects
+  const Cable* cable_;
+  WeatherLoadCase case_both_;
+  WeatherLoadCase case_ice_;
+
+  // test object
+  CableUnitLoadTable c_;
+};
+
+TEST_F(CableUnitLoadTableTest, AddCable) {
+  // adds a duplicate cable
+  EXPECT_EQ(0, c_.AddCable(cable_->diameter, cable_->weight_unit));
+  EXPECT_EQ(1, c_.size_cables());
+
+  // adds a new cable, which is solved for the existing weathercase
+  EXPECT_EQ(1, c_.AddCable(cable_->diameter, 2));
+  const Vector3d* load_unit = c_.UnitLoad(cable_->diameter, 2, &case_ice_);
+  EXPECT_EQ(4.635, helper::Round(load_unit->z(), 3));
+}
+
+TEST_F(CableUnitLoadTableTest, AddWeathercase) {
+  EXPECT_EQ(-1, c_.AddWeathercase(nullptr));
+  EXPECT_EQ(0, c_.AddWeathercase(&case_ice_));
+
+  // adds a new weathercase, which is solved for the existing cable
+  EXPECT_EQ(1, c_.AddWeathercase(&case_both_));
+  EXPECT_EQ(2, c_.size_weathercases());
+
+  const Vector3d* load_unit =
+      c_.UnitLoad(cable_->diameter, cable_->weight_unit, &case_both_);
+  EXPECT_EQ(1.405, helper::Round(load_unit->y(), 3));
+  EXPECT_EQ(2.099, helper::Round(load_unit->z(), 3));
+}
+
+TEST_F(CableUnitLoadTableTest, UnitLoad) {
+  const Vector3d* load_unit = nullptr;
+
+  load_unit = c_.UnitLoad(cable_->diameter, cable_->weight_unit, &case_ice_);
+  EXPECT_EQ(0, helper::Round(load_unit->y(), 3));
+  EXPECT_EQ(3.729, helper::Round(load_unit->z(), 3));
+
+  // checks keys that are not in the table
+  EXPECT_EQ(nullptr,
+            c_.UnitLoad(cable_->diameter, cable_->weight_unit, &case_both_));
+  EXPECT_EQ(nullptr, c_.UnitLoad(cable_->diameter, 2, &case_ice_));
+
+  c_.Clear();
+  EXPECT_EQ(nullptr,
+            c_.UnitLoad(cable_->diameter, cable_->weight_unit, &case_ice_));
+}
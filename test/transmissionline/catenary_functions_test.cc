@@ -0,0 +1,78 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/catenary_functions.h"
+
+#include "gtest/gtest.h"
+
+#include "models/base/dual.h"
+#include "models/base/helper.h"
+#include "models/transmissionline/catenary.h"
+
+class CatenaryFunctionsTest : public ::testing::Test {
+ protected:
+  CatenaryFunctionsTest() {
+    Vector2d spacing_endpoints(1000, 100);
+
+    c_.set_spacing_endpoints(spacing_endpoints);
+    c_.set_tension_horizontal(1000);
+    c_.set_weight_unit(0.5);
+  }
+
+  // gets a catenary with a modified horizontal tension
+  Catenary2d CatenaryModified(const double& tension_horizontal) {
+    Catenary2d catenary = c_;
+    catenary.set_tension_horizontal(tension_horizontal);
+    return catenary;
+  }
+
+  // comparison object
+  Catenary2d c_;
+};
+
+TEST_F(CatenaryFunctionsTest, Length) {
+  const double length = catenary::Length(1000.0, 0.5, 1000.0, 100.0);
+  EXPECT_EQ(helper::Round(c_.Length(), 6), helper::Round(length, 6));
+
+  // checks derivative with respect to horizontal tension
+  const Dual<double> length_dual = catenary::Length(
+      Dual<double>(1000, 1), Dual<double>(0.5), Dual<double>(1000),
+      Dual<double>(100));
+  const double derivative = (CatenaryModified(1001).Length()
+                             - CatenaryModified(999).Length()) / 2;
+  EXPECT_EQ(helper::Round(length, 6), helper::Round(length_dual.value, 6));
+  EXPECT_EQ(helper::Round(derivative, 6),
+            helper::Round(length_dual.derivative, 6));
+}
+
+TEST_F(CatenaryFunctionsTest, Sag) {
+  const double sag = catenary::Sag(1000.0, 0.5, 1000.0, 100.0);
+  EXPECT_EQ(helper::Round(c_.Sag(), 6), helper::Round(sag, 6));
+
+  // checks derivative with respect to horizontal tension
+  const Dual<double> sag_dual = catenary::Sag(
+      Dual<double>(1000, 1), Dual<double>(0.5), Dual<double>(1000),
+      Dual<double>(100));
+  const double derivative = (CatenaryModified(1001).Sag()
+                             - CatenaryModified(999).Sag()) / 2;
+  EXPECT_EQ(helper::Round(derivative, 4),
+            helper::Round(sag_dual.derivative, 4));
+}
+
+TEST_F(CatenaryFunctionsTest, TensionMax) {
+  const double tension = catenary::TensionMax(1000.0, 0.5, 1000.0, 100.0);
+  EXPECT_EQ(helper::Round(c_.TensionMax(), 6), helper::Round(tension, 6));
+
+  // checks derivative with respect to unit weight
+  const Dual<double> tension_dual = catenary::TensionMax(
+      Dual<double>(1000), Dual<double>(0.5, 1), Dual<double>(1000),
+      Dual<double>(100));
+  Catenary2d catenary_upper = c_;
+  catenary_upper.set_weight_unit(0.501);
+  Catenary2d catenary_lower = c_;
+  catenary_lower.set_weight_unit(0.499);
+  const double derivative =
+      (catenary_upper.TensionMax() - catenary_lower.TensionMax()) / 0.002;
+  EXPECT_EQ(helper::Round(derivative, 2),
+            helper::Round(tension_dual.derivative, 2));
+}
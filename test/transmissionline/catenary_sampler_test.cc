@@ -0,0 +1,88 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/catenary_sampler.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+class CatenarySamplerTest : public ::testing::Test {
+ protected:
+  CatenarySamplerTest() {
+    // builds dependency object - catenary
+    catenary_.set_direction_transverse(AxisDirectionType::kPositive);
+    catenary_.set_spacing_endpoints(Vector3d(1200, 0, 0));
+    catenary_.set_tension_horizontal(6000);
+    catenary_.set_weight_unit(Vector3d(0, 0, 1.094));
+
+    // builds fixture object
+    s_.set_catenary(catenary_);
+  }
+
+  /// \brief Gets the maximum distance between sampled points and catenary
+  ///   coordinates.
+  template <class T>
+  double ErrorMaximum(const int& num) const {
+    std::vector<Point3d<T>> points(num);
+    if (s_.Points(num, points.data()) == false) {
+      return -999999;
+    }
+
+    double error = 0;
+    for (int i = 0; i < num; i++) {
+      const double fraction = static_cast<double>(i) / (num - 1);
+      const Point3d<double> coordinate = catenary_.Coordinate(fraction);
+      const Vector3d vector(points[i].x - coordinate.x,
+                            points[i].y - coordinate.y,
+                            points[i].z - coordinate.z);
+      error = std::max(error, vector.Magnitude());
+    }
+
+    return error;
+  }
+
+  // allocated dependency object
+  Catenary3d catenary_;
+
+  // test object
+  CatenarySampler s_;
+};
+
+TEST_F(CatenarySamplerTest, Points) {
+  // the float error bound is 2e-7 * (|catenary constant| + length)
+  const std::vector<Vector3d> spacings = {Vector3d(1200, 0, 0),
+                                          Vector3d(1500, 0, 300),
+                                          Vector3d(800, 0, -400)};
+  const std::vector<Vector3d> weights = {Vector3d(0, 0, 1.094),
+                                         Vector3d(0, 0.8, 1.094)};
+
+  for (auto iter = spacings.cbegin(); iter != spacings.cend(); iter++) {
+    for (auto it = weights.cbegin(); it != weights.cend(); it++) {
+      catenary_.set_spacing_endpoints(*iter);
+      catenary_.set_weight_unit(*it);
+      s_.set_catenary(catenary_);
+
+      const double kBound = 2e-7 * (catenary_.Constant() + catenary_.Length());
+      EXPECT_GT(1e-8, ErrorMaximum<double>(101));
+      EXPECT_GT(kBound, ErrorMaximum<float>(101));
+      EXPECT_GT(0.003, ErrorMaximum<float>(101));
+    }
+  }
+
+  // checks the end points
+  Point3d<float> points[2];
+  EXPECT_TRUE(s_.Points(2, points));
+  EXPECT_EQ(0, points[0].x);
+  EXPECT_EQ(0, points[0].z);
+  EXPECT_NEAR(800, points[1].x, 0.001);
+  EXPECT_NEAR(-400, points[1].z, 0.001);
+
+  // checks an invalid number of points
+  EXPECT_FALSE(s_.Points(1, points));
+}
+
+TEST_F(CatenarySamplerTest, Validate) {
+  EXPECT_TRUE(s_.Validate(true, nullptr));
+}
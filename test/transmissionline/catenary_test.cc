@@ -3,9 +3,12 @@
 
 #include "models/transmissionline/catenary.h"
 
+#include <cmath>
+
 #include "gtest/gtest.h"
 
 #include "models/base/helper.h"
+#include "models/base/units.h"
 
 class Catenary2dTest : public ::testing::Test {
  protected:
@@ -177,6 +180,26 @@ TEST_F(Catenary2dTest, Sag) {
   EXPECT_EQ(46.94, helper::Round(value, 2));
 }
 
+TEST_F(Catenary2dTest, TangentSlope) {
+  double value = -999999;
+
+  // checks the slope in both directions
+  value = c_.TangentSlope(0, AxisDirectionType::kPositive);
+  EXPECT_EQ(-0.2526, helper::Round(value, 4));
+  value = c_.TangentSlope(0, AxisDirectionType::kNegative);
+  EXPECT_EQ(0.2526, helper::Round(value, 4));
+
+  // checks against the tangent angle and vector
+  const double angle = c_.TangentAngle(0.25, AxisDirectionType::kNegative);
+  const Vector2d vector = c_.TangentVector(0.25, AxisDirectionType::kNegative);
+  value = c_.TangentSlope(0.25, AxisDirectionType::kNegative);
+  EXPECT_EQ(helper::Round(std::tan(angle * units::kPi / 180), 8),
+            helper::Round(value, 8));
+  EXPECT_EQ(helper::Round(vector.y() / vector.x(), 8),
+            helper::Round(-value, 8));
+  EXPECT_EQ(1, helper::Round(vector.Magnitude(), 8));
+}
+
 TEST_F(Catenary2dTest, Tension) {
   EXPECT_EQ(1031.41, helper::Round(c_.Tension(0), 2));
   EXPECT_EQ(1000.00, helper::Round(c_.Tension(0.5), 2));
@@ -319,6 +342,32 @@ TEST_F(Catenary3dTest, CoordinateChord) {
   EXPECT_EQ(100, helper::Round(coord.z, 1));
 }
 
+TEST_F(Catenary3dTest, Projection) {
+  // inclined geometry with transverse load
+  c_.set_spacing_endpoints(Vector3d(1000, 0, 100));
+  c_.set_weight_unit(Vector3d(0, 0.3535533, 0.3535533));
+
+  CatenaryProjection projection = c_.Projection();
+  EXPECT_EQ(1002.50, helper::Round(projection.spacing_endpoints.x(), 2));
+  EXPECT_EQ(70.71, helper::Round(projection.spacing_endpoints.y(), 2));
+  EXPECT_EQ(0.5, helper::Round(projection.weight_unit, 4));
+  EXPECT_EQ(0.7071, helper::Round(projection.cos_rotation_swing, 4));
+  EXPECT_EQ(0.7071, helper::Round(projection.sin_rotation_swing, 4));
+
+  // the spacing rotation maps the 2D spacing to the 3D spacing
+  Vector3d spacing(projection.spacing_endpoints.x(), 0,
+                   projection.spacing_endpoints.y());
+  spacing.RotateSinCos(Plane2dType::kXz, projection.sin_rotation_spacing,
+                       projection.cos_rotation_spacing);
+  EXPECT_EQ(1000, helper::Round(spacing.x(), 4));
+  EXPECT_EQ(100, helper::Round(spacing.z(), 4));
+
+  // the swing rotation includes the transverse direction
+  c_.set_direction_transverse(AxisDirectionType::kNegative);
+  projection = c_.Projection();
+  EXPECT_EQ(-0.7071, helper::Round(projection.sin_rotation_swing, 4));
+}
+
 TEST_F(Catenary3dTest, Sag) {
   double value = -999999;
 
@@ -0,0 +1,128 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/multi_cable_position_locator.h"
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+#include "test/factory.h"
+
+class MultiCablePositionLocatorTest : public ::testing::Test {
+ protected:
+  MultiCablePositionLocatorTest() {
+    // builds dependency object
+    line_ = factory::BuildTransmissionLine();
+
+    // builds dependency object - line cable indexes
+    indexes_ = {0, 1, 2};
+
+    // builds dependency object - load states
+    CablePositionLoadState state;
+    state.direction_wind = AxisDirectionType::kPositive;
+    state.tension_horizontal = 5000;
+    state.weight_unit = Vector3d(0, 0, 1);
+    states_.push_back(state);
+
+    state.weight_unit = Vector3d(0, 10, 1);
+    states_.push_back(state);
+
+    state.direction_wind = AxisDirectionType::kNegative;
+    states_.push_back(state);
+
+    // builds fixture object
+    c_.set_indexes_line_cable(&indexes_);
+    c_.set_load_states(&states_);
+    c_.set_transmission_line(line_);
+  }
+
+  // allocated dependency objects
+  std::vector<int> indexes_;
+  TransmissionLine* line_;
+  std::vector<CablePositionLoadState> states_;
+
+  // test object
+  MultiCablePositionLocator c_;
+};
+
+TEST_F(MultiCablePositionLocatorTest, PointsCableAttachment) {
+  const std::vector<Point3d<double>>* points = nullptr;
+  Point3d<double> point;
+
+  // solves on a thread pool
+  ThreadPool pool(4);
+  c_.set_thread_pool(&pool);
+
+  // checks the suspension point of the last line cable for each load state
+  points = c_.PointsCableAttachment(2, 0);
+  point = points->at(1);
+  EXPECT_EQ(1993.20, helper::Round(point.x, 2));
+  EXPECT_EQ(1006.81, helper::Round(point.y, 2));
+  EXPECT_EQ(197.28, helper::Round(point.z, 2));
+
+  points = c_.PointsCableAttachment(2, 1);
+  point = points->at(1);
+  EXPECT_EQ(1992.96, helper::Round(point.x, 2));
+  EXPECT_EQ(1007.05, helper::Round(point.y, 2));
+  EXPECT_EQ(199.17, helper::Round(point.z, 2));
+
+  points = c_.PointsCableAttachment(2, 2);
+  point = points->at(1);
+  EXPECT_EQ(2006.37, helper::Round(point.x, 2));
+  EXPECT_EQ(993.63, helper::Round(point.y, 2));
+  EXPECT_EQ(195.67, helper::Round(point.z, 2));
+
+  // compares every solution to an individual locator
+  for (int index_cable = 0; index_cable < 3; index_cable++) {
+    for (int index_state = 0; index_state < 3; index_state++) {
+      const CablePositionLoadState& state = states_[index_state];
+
+      CablePositionLocator locator;
+      locator.set_direction_wind(state.direction_wind);
+      locator.set_index_line_cable(indexes_[index_cable]);
+      locator.set_tension_horizontal(state.tension_horizontal);
+      locator.set_transmission_line(line_);
+      locator.set_weight_unit(&state.weight_unit);
+
+      const std::vector<Point3d<double>>* points_expected =
+          locator.PointsCableAttachment();
+      points = c_.PointsCableAttachment(index_cable, index_state);
+      ASSERT_EQ(points_expected->size(), points->size());
+
+      for (unsigned int index = 0; index < points->size(); index++) {
+        EXPECT_EQ(points_expected->at(index).x, points->at(index).x);
+        EXPECT_EQ(points_expected->at(index).y, points->at(index).y);
+        EXPECT_EQ(points_expected->at(index).z, points->at(index).z);
+      }
+    }
+  }
+
+  // checks invalid indexes
+  EXPECT_EQ(nullptr, c_.PointsCableAttachment(3, 0));
+  EXPECT_EQ(nullptr, c_.PointsCableAttachment(0, 3));
+
+  // checks serial solution without a thread pool
+  c_.set_thread_pool(nullptr);
+  c_.set_type_solver(CablePositionLocator::SolverType::kNewton);
+
+  points = c_.PointsCableAttachment(2, 0);
+  point = points->at(1);
+  EXPECT_EQ(1993.20, helper::Round(point.x, 2));
+  EXPECT_EQ(1006.81, helper::Round(point.y, 2));
+  EXPECT_EQ(197.28, helper::Round(point.z, 2));
+}
+
+TEST_F(MultiCablePositionLocatorTest, Validate) {
+  EXPECT_TRUE(c_.Validate(true, nullptr));
+
+  // checks the error messages for an invalid load state
+  states_[1].tension_horizontal = 0;
+  EXPECT_FALSE(c_.Validate(true, nullptr));
+
+  std::list<ErrorMessage> messages;
+  EXPECT_FALSE(c_.Validate(true, &messages));
+  ASSERT_EQ(1, static_cast<int>(messages.size()));
+  EXPECT_EQ("MULTI CABLE POSITION LOCATOR", messages.front().title);
+  EXPECT_EQ("Load state 1: Invalid horizontal tension",
+            messages.front().description);
+}
@@ -0,0 +1,175 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/terrain_clearance_sweeper.h"
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+#include "test/factory.h"
+
+class TerrainClearanceSweeperTest : public ::testing::Test {
+ protected:
+  TerrainClearanceSweeperTest() {
+    // builds dependency object
+    line_ = factory::BuildTransmissionLine();
+
+    // builds dependency object - line cable indexes
+    indexes_ = {0, 2};
+
+    // builds dependency object - load states
+    CablePositionLoadState state;
+    state.direction_wind = AxisDirectionType::kPositive;
+    state.tension_horizontal = 5000;
+    state.weight_unit = Vector3d(0, 0, 1);
+    states_.push_back(state);
+
+    state.weight_unit = Vector3d(0, 1, 1);
+    states_.push_back(state);
+
+    // builds dependency object - terrain profile
+    // the ground rises across the alignment, so the blowout direction changes
+    // the clearance
+    TerrainPoint point;
+    for (int station = 0; station <= 4000; station += 10) {
+      for (int offset = -30; offset <= 30; offset += 10) {
+        point.elevation = 50 + offset;
+        point.offset = offset;
+        point.station = station;
+        terrain_.AddPoint(point);
+      }
+    }
+
+    // builds fixture object
+    s_.set_indexes_line_cable(&indexes_);
+    s_.set_load_states(&states_);
+    s_.set_terrain_profile(&terrain_);
+    s_.set_tolerance_horizontal(5);
+    s_.set_transmission_line(line_);
+  }
+
+  // allocated dependency objects
+  std::vector<int> indexes_;
+  TransmissionLine* line_;
+  std::vector<CablePositionLoadState> states_;
+  TerrainProfile terrain_;
+
+  // test object
+  TerrainClearanceSweeper s_;
+};
+
+TEST_F(TerrainClearanceSweeperTest, Clearances) {
+  const std::vector<TerrainClearance>* clearances = nullptr;
+
+  // single span line cable without wind
+  clearances = s_.Clearances(0, 0);
+  EXPECT_EQ(1, static_cast<int>(clearances->size()));
+  EXPECT_EQ(17.89, helper::Round(clearances->at(0).distance_radial, 2));
+  EXPECT_EQ(354, clearances->at(0).index_point_radial);
+  EXPECT_EQ(25.06, helper::Round(clearances->at(0).distance_vertical, 2));
+  EXPECT_EQ(353, clearances->at(0).index_point_vertical);
+
+  // single span line cable with wind, which blows the cable away from the
+  // rising ground
+  clearances = s_.Clearances(0, 1);
+  EXPECT_EQ(34.89, helper::Round(clearances->at(0).distance_radial, 2));
+
+  // multiple span line cable
+  clearances = s_.Clearances(1, 1);
+  EXPECT_EQ(2, static_cast<int>(clearances->size()));
+  EXPECT_EQ(20.39, helper::Round(clearances->at(0).distance_radial, 2));
+  EXPECT_EQ(20.05, helper::Round(clearances->at(0).distance_vertical, 2));
+  EXPECT_EQ(36.07, helper::Round(clearances->at(1).distance_radial, 2));
+  EXPECT_EQ(50.00, helper::Round(clearances->at(1).distance_vertical, 2));
+
+  // terrain points that are not beneath the cable are not measured
+  // vertically
+  s_.set_tolerance_horizontal(0);
+  clearances = s_.Clearances(0, 0);
+  EXPECT_EQ(-1, clearances->at(0).index_point_vertical);
+  EXPECT_EQ(17.89, helper::Round(clearances->at(0).distance_radial, 2));
+  s_.set_tolerance_horizontal(5);
+
+  // invalid indexes
+  EXPECT_EQ(nullptr, s_.Clearances(2, 0));
+  EXPECT_EQ(nullptr, s_.Clearances(0, 2));
+}
+
+TEST_F(TerrainClearanceSweeperTest, ClearancesBruteForce) {
+  // solves the radial clearance for every terrain point beneath the first
+  // line cable, without skipping points
+  MultiCablePositionLocator locator;
+  locator.set_indexes_line_cable(&indexes_);
+  locator.set_load_states(&states_);
+  locator.set_transmission_line(line_);
+
+  const CablePositionLoadState& state = states_[1];
+  ClearanceCable cable;
+  cable.direction_transverse = state.direction_wind;
+  cable.points_attachment = *locator.PointsCableAttachment(0, 1);
+  cable.tension_horizontal = state.tension_horizontal;
+  cable.weight_unit = state.weight_unit;
+
+  ClearanceSpanGeometry span;
+  EXPECT_TRUE(CableClearanceSolver::SolveSpanGeometry(cable, 0, &span));
+
+  const std::vector<Point3d<double>> points = terrain_.PointsXyz(*line_);
+  const int index_begin = terrain_.IndexPoint(0);
+  const int index_end = terrain_.IndexPoint(1000.1);
+  double distance = 999999;
+  for (int index = index_begin; index < index_end; index++) {
+    const ClearanceResult result =
+        CableClearanceSolver::ClearancePoint(span, points[index]);
+    if (result.distance < distance) {
+      distance = result.distance;
+    }
+  }
+
+  const std::vector<TerrainClearance>* clearances = s_.Clearances(0, 1);
+  EXPECT_EQ(helper::Round(distance, 6),
+            helper::Round(clearances->at(0).distance_radial, 6));
+}
+
+TEST_F(TerrainClearanceSweeperTest, ClearancesThreadPool) {
+  // solves serially and caches the results
+  std::vector<std::vector<TerrainClearance>> clearances_serial;
+  for (int index_cable = 0; index_cable < 2; index_cable++) {
+    for (int index_state = 0; index_state < 2; index_state++) {
+      clearances_serial.push_back(*s_.Clearances(index_cable, index_state));
+    }
+  }
+
+  // solves on a thread pool and compares
+  ThreadPool pool(4);
+  s_.set_thread_pool(&pool);
+  s_.set_terrain_profile(&terrain_);
+
+  int index = 0;
+  for (int index_cable = 0; index_cable < 2; index_cable++) {
+    for (int index_state = 0; index_state < 2; index_state++) {
+      const std::vector<TerrainClearance>* clearances =
+          s_.Clearances(index_cable, index_state);
+      const std::vector<TerrainClearance>& expected =
+          clearances_serial[index];
+      EXPECT_EQ(expected.size(), clearances->size());
+      for (unsigned int i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(expected[i].distance_radial,
+                  clearances->at(i).distance_radial);
+        EXPECT_EQ(expected[i].distance_vertical,
+                  clearances->at(i).distance_vertical);
+      }
+      index++;
+    }
+  }
+}
+
+TEST_F(TerrainClearanceSweeperTest, Validate) {
+  EXPECT_TRUE(s_.Validate(false, nullptr));
+
+  s_.set_tolerance_horizontal(-1);
+  EXPECT_FALSE(s_.Validate(false, nullptr));
+  s_.set_tolerance_horizontal(5);
+
+  s_.set_terrain_profile(nullptr);
+  EXPECT_FALSE(s_.Validate(false, nullptr));
+}
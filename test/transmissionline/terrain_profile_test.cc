@@ -0,0 +1,111 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/terrain_profile.h"
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+#include "test/factory.h"
+
+class TerrainProfileTest : public ::testing::Test {
+ protected:
+  TerrainProfileTest() {
+    // builds dependency object
+    line_ = factory::BuildTransmissionLine();
+
+    // builds fixture object
+    // the points are added out of order
+    TerrainPoint point;
+    point.elevation = 5;
+    point.offset = 10;
+    point.station = 500;
+    t_.AddPoint(point);
+
+    point.elevation = 20;
+    point.offset = 10;
+    point.station = 1500;
+    t_.AddPoint(point);
+
+    point.elevation = 0;
+    point.offset = 0;
+    point.station = 1000;
+    t_.AddPoint(point);
+
+    point.elevation = 0;
+    point.offset = 0;
+    point.station = 5000;
+    t_.AddPoint(point);
+  }
+
+  // allocated dependency object
+  TransmissionLine* line_;
+
+  // test object
+  TerrainProfile t_;
+};
+
+TEST_F(TerrainProfileTest, IndexesSegment) {
+  const std::vector<int> indexes = t_.IndexesSegment(*line_->alignment());
+  EXPECT_EQ(0, indexes[0]);
+  EXPECT_EQ(0, indexes[1]);
+  EXPECT_EQ(1, indexes[2]);
+  EXPECT_EQ(-1, indexes[3]);
+}
+
+TEST_F(TerrainProfileTest, IndexPoint) {
+  EXPECT_EQ(0, t_.IndexPoint(0));
+  EXPECT_EQ(1, t_.IndexPoint(1000));
+  EXPECT_EQ(2, t_.IndexPoint(1000.1));
+  EXPECT_EQ(4, t_.IndexPoint(6000));
+}
+
+TEST_F(TerrainProfileTest, Points) {
+  // checks that the points are sorted
+  const std::vector<TerrainPoint>* points = t_.points();
+  EXPECT_EQ(500, points->at(0).station);
+  EXPECT_EQ(1000, points->at(1).station);
+  EXPECT_EQ(1500, points->at(2).station);
+  EXPECT_EQ(5000, points->at(3).station);
+
+  // adds more points in order, and clears
+  TerrainPoint point;
+  point.elevation = 0;
+  point.offset = 0;
+  point.station = 6000;
+  t_.AddPoints(std::vector<TerrainPoint>(2, point));
+  EXPECT_EQ(6, static_cast<int>(t_.points()->size()));
+
+  t_.Clear();
+  EXPECT_TRUE(t_.points()->empty());
+}
+
+TEST_F(TerrainProfileTest, PointsXyz) {
+  const std::vector<Point3d<double>> points = t_.PointsXyz(*line_);
+
+  // first segment, with a positive offset to the right
+  EXPECT_EQ(500, helper::Round(points[0].x, 2));
+  EXPECT_EQ(-10, helper::Round(points[0].y, 2));
+  EXPECT_EQ(5, helper::Round(points[0].z, 2));
+
+  // on an alignment point
+  EXPECT_EQ(1000, helper::Round(points[1].x, 2));
+  EXPECT_EQ(0, helper::Round(points[1].y, 2));
+  EXPECT_EQ(0, helper::Round(points[1].z, 2));
+
+  // second segment, which is rotated
+  EXPECT_EQ(1010, helper::Round(points[2].x, 2));
+  EXPECT_EQ(500, helper::Round(points[2].y, 2));
+  EXPECT_EQ(20, helper::Round(points[2].z, 2));
+
+  // off the alignment
+  EXPECT_EQ(-999999, points[3].x);
+}
+
+TEST_F(TerrainProfileTest, Validate) {
+  EXPECT_TRUE(t_.Validate(false, nullptr));
+
+  TerrainPoint point;
+  t_.AddPoint(point);
+  EXPECT_FALSE(t_.Validate(false, nullptr));
+}
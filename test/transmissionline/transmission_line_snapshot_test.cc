@@ -0,0 +1,106 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "models/transmissionline/transmission_line_snapshot.h"
+
+#include <cstdio>
+
+#include "gtest/gtest.h"
+
+#include "models/base/helper.h"
+#include "test/factory.h"
+
+class TransmissionLineSnapshotTest : public ::testing::Test {
+ protected:
+  TransmissionLineSnapshotTest() {
+    // builds dependency object
+    line_ = factory::BuildTransmissionLine();
+  }
+
+  /// \brief Compares a loaded line to the original line.
+  void ExpectEqualLine(const TransmissionLine& line) {
+    EXPECT_EQ(line_->alignment()->points()->size(),
+              line.alignment()->points()->size());
+    EXPECT_EQ(line_->line_structures()->size(),
+              line.line_structures()->size());
+    ASSERT_EQ(line_->line_cables()->size(), line.line_cables()->size());
+
+    // compares the structure attachment points
+    const int kSizeStructures = line_->line_structures()->size();
+    for (int index = 0; index < kSizeStructures; index++) {
+      const LineStructure& structure = (*line_->line_structures())[index];
+      const int kSizeAttachments = structure.structure()->attachments.size();
+      for (int index_attachment = 0; index_attachment < kSizeAttachments;
+           index_attachment++) {
+        const Point3d<double> p_expected =
+            line_->PointXyzLineStructureAttachment(index, index_attachment);
+        const Point3d<double> p =
+            line.PointXyzLineStructureAttachment(index, index_attachment);
+        EXPECT_EQ(helper::Round(p_expected.x, 6), helper::Round(p.x, 6));
+        EXPECT_EQ(helper::Round(p_expected.y, 6), helper::Round(p.y, 6));
+        EXPECT_EQ(helper::Round(p_expected.z, 6), helper::Round(p.z, 6));
+      }
+
+      EXPECT_EQ(structure.hardwares()->size(),
+                (*line.line_structures())[index].hardwares()->size());
+    }
+
+    // compares the line cables
+    const int kSizeCables = line_->line_cables()->size();
+    for (int index = 0; index < kSizeCables; index++) {
+      const LineCable& cable_expected = (*line_->line_cables())[index];
+      const LineCable& cable = (*line.line_cables())[index];
+      EXPECT_EQ(cable_expected.cable()->name, cable.cable()->name);
+      EXPECT_EQ(cable_expected.constraint().limit, cable.constraint().limit);
+      EXPECT_EQ(cable_expected.constraint().case_weather->description,
+                cable.constraint().case_weather->description);
+      EXPECT_EQ(cable_expected.connections()->size(),
+                cable.connections()->size());
+      EXPECT_TRUE(cable.Validate(false, nullptr));
+    }
+
+    EXPECT_TRUE(line.Validate(false, nullptr));
+  }
+
+  // allocated dependency objects
+  TransmissionLine* line_;
+};
+
+TEST_F(TransmissionLineSnapshotTest, Deserialize) {
+  std::vector<char> buffer;
+  EXPECT_TRUE(TransmissionLineSnapshot::Serialize(*line_, &buffer));
+
+  TransmissionLineSnapshot snapshot;
+  EXPECT_TRUE(snapshot.Deserialize(buffer.data(), buffer.size()));
+  ExpectEqualLine(*snapshot.transmission_line());
+
+  // checks that shared objects are only stored once
+  EXPECT_EQ(3, static_cast<int>(snapshot.cables()->size()));
+  EXPECT_EQ(2, static_cast<int>(snapshot.hardwares()->size()));
+  EXPECT_EQ(5, static_cast<int>(snapshot.structures()->size()));
+  EXPECT_EQ(9, static_cast<int>(snapshot.weathercases()->size()));
+
+  // checks a truncated snapshot
+  EXPECT_FALSE(snapshot.Deserialize(buffer.data(), buffer.size() - 8));
+  EXPECT_EQ(0, static_cast<int>(
+      snapshot.transmission_line()->line_structures()->size()));
+  EXPECT_EQ(0, static_cast<int>(snapshot.cables()->size()));
+
+  // checks a corrupted header
+  buffer[0] = 'X';
+  EXPECT_FALSE(snapshot.Deserialize(buffer.data(), buffer.size()));
+}
+
+TEST_F(TransmissionLineSnapshotTest, Load) {
+  const std::string filepath = "transmission_line_snapshot_test.otls";
+  EXPECT_TRUE(TransmissionLineSnapshot::Write(*line_, filepath));
+
+  TransmissionLineSnapshot snapshot;
+  EXPECT_TRUE(snapshot.Load(filepath));
+  ExpectEqualLine(*snapshot.transmission_line());
+
+  std::remove(filepath.c_str());
+
+  // checks a missing file
+  EXPECT_FALSE(snapshot.Load(filepath));
+}
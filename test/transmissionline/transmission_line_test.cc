@@ -34,7 +34,7 @@ TEST_F(TransmissionLineTest, AddLineCable) {
   Hardware* hardware_deadend = factory::BuildHardware();
   hardware_deadend->type = Hardware::HardwareType::kDeadEnd;
 
-  const std::list<LineStructure>* line_structures = t_.line_structures();
+  const SlotVector<LineStructure>* line_structures = t_.line_structures();
   LineStructure line_structure;
 
   // modifies first and second line structures and adds dead-end hardware
@@ -61,8 +61,12 @@ TEST_F(TransmissionLineTest, AddLineCable) {
   line_cable.AddConnection(connection);
 
   // adds to transmission line and tests if it was sorted correctly
+  const LineCable* line_cable_back = &t_.line_cables()->back();
   const int index = t_.AddLineCable(line_cable);
   EXPECT_EQ(0, index);
+
+  // checks that the existing line cables did not move
+  EXPECT_EQ(line_cable_back, &t_.line_cables()->back());
 }
 
 TEST_F(TransmissionLineTest, AddLineStructure) {
@@ -103,9 +107,11 @@ TEST_F(TransmissionLineTest, DeleteAlignmentPoint) {
 TEST_F(TransmissionLineTest, DeleteLineCable) {
   bool status = false;
 
-  // deletes the second line cable
+  // deletes the second line cable, and checks that the others did not move
+  const LineCable* line_cable_back = &t_.line_cables()->back();
   status = t_.DeleteLineCable(1);
   EXPECT_TRUE(status);
+  EXPECT_EQ(line_cable_back, &t_.line_cables()->back());
 
   // attempts invalid index
   status = t_.DeleteLineCable(5);
@@ -156,7 +162,7 @@ TEST_F(TransmissionLineTest, ModifyLineCable) {
   Hardware* hardware_deadend = factory::BuildHardware();
   hardware_deadend->type = Hardware::HardwareType::kDeadEnd;
 
-  const std::list<LineStructure>* line_structures = t_.line_structures();
+  const SlotVector<LineStructure>* line_structures = t_.line_structures();
   LineStructure line_structure;
 
   // modifies first line structures and adds dead-end hardware
@@ -230,6 +236,85 @@ TEST_F(TransmissionLineTest, PointsXyzAlignment) {
   EXPECT_EQ(2000, helper::Round(point.x, 2));
   EXPECT_EQ(2000, helper::Round(point.y, 2));
   EXPECT_EQ(0, helper::Round(point.z, 2));
+
+  // checks multiple stations, which should match the individual points
+  std::vector<double> stations;
+  for (int station = -500; station <= 5000; station += 250) {
+    stations.push_back(station);
+  }
+
+  const std::vector<Point3d<double>> points = t_.PointsXyzAlignment(stations);
+  EXPECT_EQ(stations.size(), points.size());
+  for (unsigned int index = 0; index < stations.size(); index++) {
+    point = t_.PointXyzAlignment(stations[index]);
+    EXPECT_EQ(point.x, points[index].x);
+    EXPECT_EQ(point.y, points[index].y);
+    EXPECT_EQ(point.z, points[index].z);
+  }
+
+  point = points.front();
+  EXPECT_EQ(-999999, point.x);
+
+  point = points.at(10);
+  EXPECT_EQ(1000, helper::Round(point.x, 2));
+  EXPECT_EQ(1000, helper::Round(point.y, 2));
+  EXPECT_EQ(0, helper::Round(point.z, 2));
+}
+
+TEST_F(TransmissionLineTest, PointsXyzIncrementalUpdate) {
+  // caches all points
+  t_.PointsXyzLineStructures();
+
+  // modifies an alignment point and a line structure, which will only update
+  // part of the cached points
+  AlignmentPoint point = t_.alignment()->points()->at(2);
+  point.elevation = 50;
+  point.rotation = -45;
+  t_.ModifyAlignmentPoint(2, point);
+
+  LineStructure line_structure = t_.line_structures()->at(1);
+  line_structure.set_station(1250);
+  t_.ModifyLineStructure(1, line_structure);
+
+  // builds a line with the same modifications
+  // the origin is reset to force a full update of the points
+  TransmissionLine line = *factory::BuildTransmissionLine();
+  line.ModifyAlignmentPoint(2, point);
+  line.ModifyLineStructure(1, line_structure);
+  line.set_origin(line.origin());
+
+  // compares alignment points
+  const std::vector<Point3d<double>>* points = t_.PointsXyzAlignment();
+  const std::vector<Point3d<double>>* points_expected =
+      line.PointsXyzAlignment();
+  ASSERT_EQ(points_expected->size(), points->size());
+  for (unsigned int index = 0; index < points->size(); index++) {
+    EXPECT_EQ(helper::Round(points_expected->at(index).x, 6),
+              helper::Round(points->at(index).x, 6));
+    EXPECT_EQ(helper::Round(points_expected->at(index).y, 6),
+              helper::Round(points->at(index).y, 6));
+    EXPECT_EQ(helper::Round(points_expected->at(index).z, 6),
+              helper::Round(points->at(index).z, 6));
+  }
+
+  // compares line structure points
+  points = t_.PointsXyzLineStructures();
+  points_expected = line.PointsXyzLineStructures();
+  ASSERT_EQ(points_expected->size(), points->size());
+  for (unsigned int index = 0; index < points->size(); index++) {
+    EXPECT_EQ(helper::Round(points_expected->at(index).x, 6),
+              helper::Round(points->at(index).x, 6));
+    EXPECT_EQ(helper::Round(points_expected->at(index).y, 6),
+              helper::Round(points->at(index).y, 6));
+    EXPECT_EQ(helper::Round(points_expected->at(index).z, 6),
+              helper::Round(points->at(index).z, 6));
+  }
+
+  // checks the modified structure, which is now on the second segment
+  Point3d<double> point_xyz = points->at(1);
+  EXPECT_EQ(1000, helper::Round(point_xyz.x, 2));
+  EXPECT_EQ(250, helper::Round(point_xyz.y, 2));
+  EXPECT_EQ(12.5, helper::Round(point_xyz.z, 2));
 }
 
 TEST_F(TransmissionLineTest, PointsXyzLineStructures) {